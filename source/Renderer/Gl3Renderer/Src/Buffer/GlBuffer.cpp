@@ -23,7 +23,13 @@ namespace gl_renderer
 	{
 		onDestroy( m_name );
 		m_storage.reset();
-		glLogCall( gl::DeleteBuffers, 1, &m_name );
+
+		// A suballocated buffer's range is released with its storage, the shared buffer lives on.
+		if ( !m_suballocated )
+		{
+			static_cast< Device const & >( m_device ).onBufferDeleted( m_name );
+			glLogCall( gl::DeleteBuffers, 1, &m_name );
+		}
 	}
 
 	renderer::MemoryRequirements Buffer::getMemoryRequirements()const
@@ -36,6 +42,16 @@ namespace gl_renderer
 
 	void Buffer::doBindMemory()
 	{
-		static_cast< DeviceMemory & >( *m_storage ).bindToBuffer( m_name, m_target );
+		auto & memory = static_cast< DeviceMemory & >( *m_storage );
+		memory.bindToBuffer( m_name, m_target );
+
+		if ( memory.isSuballocated() )
+		{
+			// The buffer is a range of a shared buffer, its own name is not needed anymore.
+			glLogCall( gl::DeleteBuffers, 1, &m_name );
+			m_name = memory.getBufferAllocation().name;
+			m_offset = memory.getBufferAllocation().offset;
+			m_suballocated = true;
+		}
 	}
 }
@@ -29,6 +29,8 @@ namespace gl_renderer
 		/**
 		*\return
 		*	Le tampon.
+		*\remarks
+		*	Pour un tampon sous-alloué, c'est le tampon partagé, à utiliser avec getOffset().
 		*/
 		inline GLuint getBuffer()const
 		{
@@ -37,6 +39,22 @@ namespace gl_renderer
 		}
 		/**
 		*\return
+		*	Le décalage du tampon dans getBuffer(), non nul pour un tampon sous-alloué.
+		*/
+		inline GLintptr getOffset()const
+		{
+			return m_offset;
+		}
+		/**
+		*\return
+		*	\p true si le tampon est un intervalle d'un tampon partagé.
+		*/
+		inline bool isSuballocated()const
+		{
+			return m_suballocated;
+		}
+		/**
+		*\return
 		*	La cible du tampon.
 		*/
 		inline GlBufferTarget getTarget()const
@@ -52,6 +70,8 @@ namespace gl_renderer
 
 	private:
 		GLuint m_name{ GL_INVALID_INDEX };
+		GLintptr m_offset{ 0 };
+		bool m_suballocated{ false };
 		GlBufferTarget m_target;
 		mutable GlBufferTarget m_copyTarget;
 	};
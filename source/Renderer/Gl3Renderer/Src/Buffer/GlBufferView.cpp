@@ -14,25 +14,26 @@ namespace gl_renderer
 		, uint32_t offset
 		, uint32_t range )
 		: renderer::BufferView{ device, buffer, format, offset, range }
+		, m_device{ device }
 	{
 		glLogCall( gl::GenTextures, 1, &m_name );
-		glLogCall( gl::ActiveTexture, GL_TEXTURE0 );
-		glLogCall( gl::BindTexture, GL_BUFFER_TARGET_TEXTURE, m_name );
+		m_device.bindTexture( 0u, GL_BUFFER_TARGET_TEXTURE, m_name );
 
 		if ( device.getRenderer().getFeatures().hasTexBufferRange )
 		{
-			glLogCall( gl::TexBufferRange_ARB, GL_BUFFER_TARGET_TEXTURE, getInternal( format ), buffer.getBuffer(), offset, range );
+			glLogCall( gl::TexBufferRange_ARB, GL_BUFFER_TARGET_TEXTURE, getInternal( format ), buffer.getBuffer(), GLintptr( offset ) + buffer.getOffset(), range );
 		}
 		else
 		{
 			glLogCall( gl::TexBuffer, GL_BUFFER_TARGET_TEXTURE, getInternal( format ), buffer.getBuffer() );
 		}
 
-		glLogCall( gl::BindTexture, GL_BUFFER_TARGET_TEXTURE, 0u );
+		m_device.bindTexture( 0u, GL_BUFFER_TARGET_TEXTURE, 0u );
 	}
 
 	BufferView::~BufferView()
 	{
+		m_device.onTextureDeleted( m_name );
 		glLogCall( gl::DeleteTextures, 1, &m_name );
 	}
 }
@@ -32,9 +32,4 @@ namespace gl_renderer
 			save = m_program;
 		}
 	}
-
-	CommandPtr BindComputePipelineCommand::clone()const
-	{
-		return std::make_unique< BindComputePipelineCommand >( *this );
-	}
 }
@@ -29,7 +29,6 @@ namespace gl_renderer
 			, renderer::PipelineBindPoint bindingPoint );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		Device const & m_device;
@@ -4,274 +4,12 @@ See LICENSE file in root folder.
 */
 #include "GlBindDescriptorSetCommand.hpp"
 
-#include "Buffer/GlBuffer.hpp"
-#include "Buffer/GlBufferView.hpp"
+#include "Core/GlDevice.hpp"
 #include "Descriptor/GlDescriptorSet.hpp"
 #include "Pipeline/GlPipelineLayout.hpp"
-#include "Image/GlSampler.hpp"
-#include "Image/GlTexture.hpp"
-#include "Image/GlTextureView.hpp"
-#include "Buffer/GlUniformBuffer.hpp"
-
-#include <Descriptor/DescriptorSetLayoutBinding.hpp>
 
 namespace gl_renderer
 {
-	namespace
-	{
-		static constexpr GLenum GL_TEXTURE_FILTER_CONTROL = 0x8500;
-		static constexpr GLenum GL_TEXTURE_LOD_BIAS = 0x8501;
-
-		renderer::TextureView const & getView( renderer::WriteDescriptorSet const & write, uint32_t index )
-		{
-			assert( index < write.imageInfo.size() );
-			return write.imageInfo[index].imageView.value().get();
-		}
-
-		renderer::Sampler const & getSampler( renderer::WriteDescriptorSet const & write, uint32_t index )
-		{
-			assert( index < write.imageInfo.size() );
-			return write.imageInfo[index].sampler.value().get();
-		}
-
-		renderer::BufferBase const & getBuffer( renderer::WriteDescriptorSet const & write, uint32_t index )
-		{
-			assert( index < write.bufferInfo.size() );
-			return write.bufferInfo[index].buffer.get();
-		}
-
-		GlTextureType convert( renderer::TextureViewType const & mode
-			, uint32_t layers )
-		{
-			switch ( mode )
-			{
-			case renderer::TextureViewType::e1D:
-				return layers > 1u
-					? GL_TEXTURE_1D_ARRAY
-					: GL_TEXTURE_1D;
-
-			case renderer::TextureViewType::e2D:
-				return layers > 1u
-					? GL_TEXTURE_2D_ARRAY
-					: GL_TEXTURE_2D;
-
-			case renderer::TextureViewType::e3D:
-				return GL_TEXTURE_3D;
-
-			case renderer::TextureViewType::eCube:
-				return layers > 6u
-					? GL_TEXTURE_CUBE_ARRAY
-					: GL_TEXTURE_CUBE;
-
-			case renderer::TextureViewType::e1DArray:
-				return GL_TEXTURE_1D_ARRAY;
-
-			case renderer::TextureViewType::e2DArray:
-				return GL_TEXTURE_2D_ARRAY;
-
-			case renderer::TextureViewType::eCubeArray:
-				return GL_TEXTURE_CUBE_ARRAY;
-
-			default:
-				assert( false && "Unsupported TextureViewType" );
-				return GL_TEXTURE_2D;
-			}
-		}
-
-		void bindCombinedSampler( renderer::WriteDescriptorSet const & write )
-		{
-			for ( auto i = 0u; i < write.imageInfo.size(); ++i )
-			{
-				uint32_t bindingIndex = write.dstBinding + write.dstArrayElement + i;
-				auto & view = getView( write, i );
-				auto & sampler = getSampler( write, i );
-				glLogCall( gl::ActiveTexture
-					, GlTextureUnit( GL_TEXTURE0 + bindingIndex ) );
-				auto target = convert( view.getType(), view.getTexture().getLayerCount() );
-				glLogCall( gl::BindTexture
-					, target
-					, static_cast< Texture const & >( view.getTexture() ).getImage() );
-				//auto & range = view.getSubResourceRange();
-
-				//if ( range.levelCount > 1 )
-				//{
-				//	glLogCall( gl::TexParameteri
-				//		, target
-				//		, GL_SAMPLER_PARAMETER_MIN_LOD
-				//		, GLint( range.baseMipLevel ) );
-				//	glLogCall( gl::TexParameteri
-				//		, target
-				//		, GL_SAMPLER_PARAMETER_MAX_LOD
-				//		, GLint( range.baseMipLevel + range.levelCount ) );
-				//}
-
-				glLogCall( gl::BindSampler
-					, bindingIndex
-					, static_cast< Sampler const & >( sampler ).getSampler() );
-			}
-		}
-
-		void bindSampler( renderer::WriteDescriptorSet const & write )
-		{
-			for ( auto i = 0u; i < write.imageInfo.size(); ++i )
-			{
-				uint32_t bindingIndex = write.dstBinding + write.dstArrayElement + i;
-				auto & sampler = getSampler( write, i );
-				glLogCall( gl::BindSampler
-					, bindingIndex
-					, static_cast< Sampler const & >( sampler ).getSampler() );
-			}
-		}
-
-		void bindSampledTexture( renderer::WriteDescriptorSet const & write )
-		{
-			for ( auto i = 0u; i < write.imageInfo.size(); ++i )
-			{
-				uint32_t bindingIndex = write.dstBinding + write.dstArrayElement + i;
-				auto & view = getView( write, i );
-				glLogCall( gl::ActiveTexture
-					, GlTextureUnit( GL_TEXTURE0 + bindingIndex ) );
-				auto target = convert( view.getType(), view.getTexture().getLayerCount() );
-				glLogCall( gl::BindTexture
-					, target
-					, static_cast< Texture const & >( view.getTexture() ).getImage() );
-				//auto & range = view.getSubResourceRange();
-
-				//if ( range.levelCount > 1 )
-				//{
-				//	glLogCall( gl::TexParameteri
-				//		, target
-				//		, GL_SAMPLER_PARAMETER_MIN_LOD
-				//		, GLint( range.baseMipLevel ) );
-				//	glLogCall( gl::TexParameteri
-				//		, target
-				//		, GL_SAMPLER_PARAMETER_MAX_LOD
-				//		, GLint( range.baseMipLevel + range.levelCount ) );
-				//}
-			}
-		}
-
-		void bindStorageTexture( Device const & device
-			, renderer::WriteDescriptorSet const & write )
-		{
-			for ( auto i = 0u; i < write.imageInfo.size(); ++i )
-			{
-				uint32_t bindingIndex = write.dstBinding + write.dstArrayElement + i;
-				auto & view = getView( write, i );
-				auto & range = view.getSubResourceRange();
-				glLogCall( gl::ActiveTexture
-					, GlTextureUnit( GL_TEXTURE0 + bindingIndex ) );
-				glLogCall( gl::BindImageTexture_ARB
-					, bindingIndex
-					, static_cast< Texture const & >( view.getTexture() ).getImage()
-					, range.baseMipLevel
-					, range.layerCount
-					, range.baseArrayLayer
-					, GL_ACCESS_TYPE_READ_WRITE
-					, getInternal( view.getFormat() ) );
-			}
-		}
-
-		void bindUniformBuffer( renderer::WriteDescriptorSet const & write )
-		{
-			for ( auto i = 0u; i < write.bufferInfo.size(); ++i )
-			{
-				uint32_t bindingIndex = write.dstBinding + write.dstArrayElement + i;
-				auto & buffer = getBuffer( write, i );
-				glLogCall( gl::BindBufferRange
-					, GL_BUFFER_TARGET_UNIFORM
-					, bindingIndex
-					, static_cast< Buffer const & >( buffer ).getBuffer()
-					, GLintptr( write.bufferInfo[i].offset )
-					, GLsizeiptr( write.bufferInfo[i].range ) );
-			}
-		}
-
-		void bindStorageBuffer( renderer::WriteDescriptorSet const & write )
-		{
-			for ( auto i = 0u; i < write.bufferInfo.size(); ++i )
-			{
-				uint32_t bindingIndex = write.dstBinding + write.dstArrayElement + i;
-				auto & buffer = getBuffer( write, i );
-				glLogCall( gl::BindBufferRange
-					, GL_BUFFER_TARGET_SHADER_STORAGE
-					, bindingIndex
-					, static_cast< Buffer const & >( buffer ).getBuffer()
-					, GLintptr( write.bufferInfo[i].offset )
-					, GLsizeiptr( write.bufferInfo[i].range ) );
-			}
-		}
-
-		void bindTexelBuffer( renderer::WriteDescriptorSet const & write )
-		{
-			for ( auto i = 0u; i < write.bufferInfo.size(); ++i )
-			{
-				uint32_t bindingIndex = write.dstBinding + write.dstArrayElement + i;
-				auto & buffer = getBuffer( write, i );
-				glLogCall( gl::ActiveTexture
-					, GlTextureUnit( GL_TEXTURE0 + bindingIndex ) );
-				glLogCall( gl::BindTexture
-					, GL_BUFFER_TARGET_TEXTURE
-					, static_cast< BufferView const & >( write.texelBufferView[i].get() ).getImage() );
-			}
-		}
-
-		void bindDynamicUniformBuffer( renderer::WriteDescriptorSet const & write, uint32_t offset )
-		{
-			for ( auto i = 0u; i < write.bufferInfo.size(); ++i )
-			{
-				uint32_t bindingIndex = write.dstBinding + write.dstArrayElement + i;
-				auto & buffer = getBuffer( write, i );
-				glLogCall( gl::BindBufferRange
-					, GL_BUFFER_TARGET_UNIFORM
-					, bindingIndex
-					, static_cast< Buffer const & >( buffer ).getBuffer()
-					, GLintptr( write.bufferInfo[i].offset + offset )
-					, GLsizeiptr( write.bufferInfo[i].range ) );
-			}
-		}
-
-		void bindDynamicStorageBuffer( renderer::WriteDescriptorSet const & write, uint32_t offset )
-		{
-			for ( auto i = 0u; i < write.bufferInfo.size(); ++i )
-			{
-				uint32_t bindingIndex = write.dstBinding + write.dstArrayElement + i;
-				auto & buffer = getBuffer( write, i );
-				glLogCall( gl::BindBufferRange
-					, GL_BUFFER_TARGET_SHADER_STORAGE
-					, bindingIndex
-					, static_cast< Buffer const & >( buffer ).getBuffer()
-					, GLintptr( write.bufferInfo[i].offset + offset )
-					, GLsizeiptr( write.bufferInfo[i].range ) );
-			}
-		}
-
-		void bindDynamicBuffers( renderer::WriteDescriptorSetArray const & writes
-			, renderer::UInt32Array const & offsets )
-		{
-			for ( auto i = 0u; i < offsets.size(); ++i )
-			{
-				auto & write = writes[i];
-
-				switch ( write.descriptorType )
-				{
-				case renderer::DescriptorType::eUniformBufferDynamic:
-					bindDynamicUniformBuffer( write, offsets[i] );
-					break;
-
-				case renderer::DescriptorType::eStorageBufferDynamic:
-					bindDynamicStorageBuffer( write, offsets[i] );
-					break;
-
-				default:
-					assert( false && "Unsupported dynamic descriptor type" );
-					throw std::runtime_error{ "Unsupported dynamic descriptor type" };
-					break;
-				}
-			}
-		}
-	}
-
 	BindDescriptorSetCommand::BindDescriptorSetCommand( Device const & device
 		, renderer::DescriptorSet const & descriptorSet
 		, renderer::PipelineLayout const & layout
@@ -290,46 +28,62 @@ namespace gl_renderer
 	void BindDescriptorSetCommand::apply()const
 	{
 		glLogCommand( "BindDescriptorSetCommand" );
-		for ( auto & write : m_descriptorSet.getCombinedTextureSamplers() )
-		{
-			bindCombinedSampler( write );
-		}
-
-		for ( auto & write : m_descriptorSet.getSamplers() )
+		for ( auto & bindings : m_descriptorSet.getTextureBindings() )
 		{
-			bindSampler( write );
+			m_device.bindTextures( bindings.first
+				, uint32_t( bindings.names.size() )
+				, bindings.targets.data()
+				, bindings.names.data() );
 		}
 
-		for ( auto & write : m_descriptorSet.getSampledTextures() )
+		for ( auto & bindings : m_descriptorSet.getSamplerBindings() )
 		{
-			bindSampledTexture( write );
+			m_device.bindSamplers( bindings.first
+				, uint32_t( bindings.names.size() )
+				, bindings.names.data() );
 		}
 
-		for ( auto & write : m_descriptorSet.getStorageTextures() )
+		for ( auto & bindings : m_descriptorSet.getImageBindings() )
 		{
-			bindStorageTexture( m_device, write );
+			for ( auto i = 0u; i < bindings.names.size(); ++i )
+			{
+				m_device.bindImageTexture( bindings.first + i
+					, bindings.names[i]
+					, bindings.levels[i]
+					, bindings.layered[i]
+					, bindings.layers[i]
+					, GL_ACCESS_TYPE_READ_WRITE
+					, bindings.formats[i] );
+			}
 		}
 
-		for ( auto & write : m_descriptorSet.getUniformBuffers() )
+		for ( auto & bindings : m_descriptorSet.getUniformBufferBindings() )
 		{
-			bindUniformBuffer( write );
+			m_device.bindBuffersRange( GL_BUFFER_TARGET_UNIFORM
+				, bindings.first
+				, uint32_t( bindings.names.size() )
+				, bindings.names.data()
+				, bindings.offsets.data()
+				, bindings.ranges.data() );
 		}
 
-		for ( auto & write : m_descriptorSet.getStorageBuffers() )
+		for ( auto & bindings : m_descriptorSet.getStorageBufferBindings() )
 		{
-			bindStorageBuffer( write );
+			m_device.bindBuffersRange( GL_BUFFER_TARGET_SHADER_STORAGE
+				, bindings.first
+				, uint32_t( bindings.names.size() )
+				, bindings.names.data()
+				, bindings.offsets.data()
+				, bindings.ranges.data() );
 		}
 
-		for ( auto & write : m_descriptorSet.getTexelBuffers() )
+		for ( auto & binding : m_descriptorSet.getDynamicBufferBindings() )
 		{
-			bindTexelBuffer( write );
+			m_device.bindBufferRange( binding.target
+				, binding.unit
+				, binding.name
+				, binding.offset + GLintptr( m_dynamicOffsets[binding.dynamicIndex] )
+				, binding.range );
 		}
-
-		bindDynamicBuffers( m_descriptorSet.getDynamicBuffers(), m_dynamicOffsets );
-	}
-
-	CommandPtr BindDescriptorSetCommand::clone()const
-	{
-		return std::make_unique< BindDescriptorSetCommand >( *this );
 	}
 }
@@ -12,7 +12,7 @@ namespace gl_renderer
 	*\brief
 	*	Commande d'activation d'un set de descripteurs.
 	*/
-	class BindDescriptorSetCommand
+	class BindDescriptorSetCommand final
 		: public CommandBase
 	{
 	public:
@@ -33,7 +33,6 @@ namespace gl_renderer
 			, renderer::PipelineBindPoint bindingPoint );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		Device const & m_device;
@@ -42,4 +41,10 @@ namespace gl_renderer
 		renderer::PipelineBindPoint m_bindingPoint;
 		renderer::UInt32Array m_dynamicOffsets;
 	};
+
+	template<>
+	struct CommandTypeGetter< BindDescriptorSetCommand >
+	{
+		static CommandType constexpr value = CommandType::eBindDescriptorSet;
+	};
 }
@@ -18,9 +18,4 @@ namespace gl_renderer
 		glLogCommand( "BindGeometryBuffersCommand" );
 		glLogCall( gl::BindVertexArray, m_vao.getVao() );
 	}
-
-	CommandPtr BindGeometryBuffersCommand::clone()const
-	{
-		return std::make_unique< BindGeometryBuffersCommand >( *this );
-	}
 }
@@ -20,7 +20,6 @@ namespace gl_renderer
 			, renderer::ClearRectArray const & clearRects );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		Device const & m_device;
@@ -29,9 +29,4 @@ namespace gl_renderer
 			, m_type
 			, m_colour.float32.data() );
 	}
-
-	CommandPtr ClearColourCommand::clone()const
-	{
-		return std::make_unique< ClearColourCommand >( *this );
-	}
 }
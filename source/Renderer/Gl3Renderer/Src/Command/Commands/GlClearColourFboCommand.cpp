@@ -53,9 +53,4 @@ namespace gl_renderer
 			, GL_FRAMEBUFFER
 			, 0u );
 	}
-
-	CommandPtr ClearColourFboCommand::clone()const
-	{
-		return std::make_unique< ClearColourFboCommand >( *this );
-	}
 }
@@ -31,7 +31,6 @@ namespace gl_renderer
 			, renderer::ClearColorValue const & colour );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		Device const & m_device;
@@ -51,9 +51,4 @@ namespace gl_renderer
 				, &m_value.depth );
 		}
 	}
-
-	CommandPtr ClearDepthStencilCommand::clone()const
-	{
-		return std::make_unique< ClearDepthStencilCommand >( *this );
-	}
 }
@@ -30,7 +30,6 @@ namespace gl_renderer
 			, renderer::DepthStencilClearValue const & value );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		Texture const & m_image;
@@ -63,9 +63,4 @@ namespace gl_renderer
 			, GL_FRAMEBUFFER
 			, 0u );
 	}
-
-	CommandPtr ClearDepthStencilFboCommand::clone()const
-	{
-		return std::make_unique< ClearDepthStencilFboCommand >( *this );
-	}
 }
@@ -33,7 +33,6 @@ namespace gl_renderer
 			, renderer::BufferBase const & dst );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		Buffer const & m_src;
@@ -21,6 +21,8 @@ namespace gl_renderer
 		/**
 		*\brief
 		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
 		*\param[in] copyInfo
 		*	Les informations de copie.
 		*\param[in] src
@@ -28,14 +30,15 @@ namespace gl_renderer
 		*\param[in] dst
 		*	L'image destination.
 		*/
-		CopyImageCommand( renderer::ImageCopy const & copyInfo
+		CopyImageCommand( Device const & device
+			, renderer::ImageCopy const & copyInfo
 			, renderer::Texture const & src
 			, renderer::Texture const & dst );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
+		Device const & m_device;
 		Texture const & m_src;
 		Texture const & m_dst;
 		renderer::ImageCopy m_copyInfo;
@@ -53,9 +53,4 @@ namespace gl_renderer
 		glLogCall( gl::BindTexture, m_srcTarget, 0u );
 		static_cast< renderer::Texture const & >( m_dst ).generateMipmaps();
 	}
-
-	CommandPtr CopySubImageCommand::clone()const
-	{
-		return std::make_unique< CopySubImageCommand >( *this );
-	}
 }
@@ -33,7 +33,6 @@ namespace gl_renderer
 			, renderer::Texture const & dst );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		Texture const & m_src;
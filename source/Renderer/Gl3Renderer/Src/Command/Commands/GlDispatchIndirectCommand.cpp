@@ -19,12 +19,7 @@ namespace gl_renderer
 	{
 		glLogCommand( "DispatchIndirectCommand" );
 		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_DISPATCH_INDIRECT, m_buffer.getBuffer() );
-		glLogCall( gl::DispatchComputeIndirect_ARB, GLintptr( BufferOffset( m_offset ) ) );
+		glLogCall( gl::DispatchComputeIndirect_ARB, GLintptr( BufferOffset( m_buffer.getOffset() + m_offset ) ) );
 		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_DISPATCH_INDIRECT, 0 );
 	}
-
-	CommandPtr DispatchIndirectCommand::clone()const
-	{
-		return std::make_unique< DispatchIndirectCommand >( *this );
-	}
 }
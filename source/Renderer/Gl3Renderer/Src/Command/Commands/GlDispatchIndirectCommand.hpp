@@ -16,7 +16,6 @@ namespace gl_renderer
 			, uint32_t offset );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		Buffer const & m_buffer;
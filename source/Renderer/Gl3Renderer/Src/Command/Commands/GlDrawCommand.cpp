@@ -52,9 +52,4 @@ namespace gl_renderer
 				, m_instCount );
 		}
 	}
-
-	CommandPtr DrawCommand::clone()const
-	{
-		return std::make_unique< DrawCommand >( *this );
-	}
 }
@@ -77,9 +77,4 @@ namespace gl_renderer
 				, m_vertexOffset );
 		}
 	}
-
-	CommandPtr DrawIndexedCommand::clone()const
-	{
-		return std::make_unique< DrawIndexedCommand >( *this );
-	}
 }
@@ -37,14 +37,9 @@ namespace gl_renderer
 		glLogCall( gl::MultiDrawElementsIndirect_ARB
 			, m_mode
 			, m_type
-			, BufferOffset( m_offset )
+			, BufferOffset( m_buffer.getOffset() + m_offset )
 			, m_drawCount
 			, m_stride );
 		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_DRAW_INDIRECT, 0 );
 	}
-
-	CommandPtr DrawIndexedIndirectCommand::clone()const
-	{
-		return std::make_unique< DrawIndexedIndirectCommand >( *this );
-	}
 }
@@ -21,7 +21,6 @@ namespace gl_renderer
 			, renderer::IndexType type );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		Device const & m_device;
@@ -19,7 +19,6 @@ namespace gl_renderer
 			, renderer::PrimitiveTopology mode );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		Buffer const & m_buffer;
@@ -19,9 +19,4 @@ namespace gl_renderer
 		glLogCommand( "EndQueryCommand" );
 		glLogCall( gl::EndQuery, m_target );
 	}
-
-	CommandPtr EndQueryCommand::clone()const
-	{
-		return std::make_unique< EndQueryCommand >( *this );
-	}
 }
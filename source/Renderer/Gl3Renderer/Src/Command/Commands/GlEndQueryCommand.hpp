@@ -19,7 +19,6 @@ namespace gl_renderer
 		EndQueryCommand( renderer::QueryPool const & pool
 			, uint32_t query );
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		GlQueryType m_target;
@@ -17,9 +17,4 @@ namespace gl_renderer
 		glLogCommand( "EndRenderPassCommand" );
 		glLogCall( gl::BindFramebuffer, GL_FRAMEBUFFER, 0u );
 	}
-
-	CommandPtr EndRenderPassCommand::clone()const
-	{
-		return std::make_unique< EndRenderPassCommand >( *this );
-	}
 }
@@ -17,7 +17,6 @@ namespace gl_renderer
 			, renderer::SubpassDescription const & subpass );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		Device const & m_device;
@@ -0,0 +1,21 @@
+/*
+This file belongs to GlRenderer.
+See LICENSE file in root folder.
+*/
+#include "GlExecuteCommandsCommand.hpp"
+
+#include "Command/GlCommandBuffer.hpp"
+
+namespace gl_renderer
+{
+	ExecuteCommandsCommand::ExecuteCommandsCommand( CommandBuffer const & commandBuffer )
+		: m_commandBuffer{ commandBuffer }
+	{
+	}
+
+	void ExecuteCommandsCommand::apply()const
+	{
+		glLogCommand( "ExecuteCommandsCommand" );
+		m_commandBuffer.getCommands().replay();
+	}
+}
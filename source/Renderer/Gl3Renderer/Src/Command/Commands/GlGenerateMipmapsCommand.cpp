@@ -4,12 +4,15 @@ See LICENSE file in root folder.
 */
 #include "GlGenerateMipmapsCommand.hpp"
 
+#include "Core/GlDevice.hpp"
 #include "Image/GlTexture.hpp"
 
 namespace gl_renderer
 {
-	GenerateMipmapsCommand::GenerateMipmapsCommand( Texture const & texture )
-		: m_texture{ texture }
+	GenerateMipmapsCommand::GenerateMipmapsCommand( Device const & device
+		, Texture const & texture )
+		: m_device{ device }
+		, m_texture{ texture }
 	{
 	}
 
@@ -19,10 +22,6 @@ namespace gl_renderer
 		glLogCall( gl::BindTexture, m_texture.getTarget(), m_texture.getImage() );
 		glLogCall( gl::GenerateMipmap, m_texture.getTarget() );
 		glLogCall( gl::BindTexture, m_texture.getTarget(), 0 );
-	}
-
-	CommandPtr GenerateMipmapsCommand::clone()const
-	{
-		return std::make_unique< GenerateMipmapsCommand >( *this );
+		m_device.invalidateActiveTextureUnit();
 	}
 }
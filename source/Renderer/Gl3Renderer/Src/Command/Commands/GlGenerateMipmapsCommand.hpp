@@ -19,13 +19,18 @@ namespace gl_renderer
 		/**
 		*\brief
 		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] texture
+		*	La texture.
 		*/
-		GenerateMipmapsCommand( Texture const & texture );
+		GenerateMipmapsCommand( Device const & device
+			, Texture const & texture );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
+		Device const & m_device;
 		Texture const & m_texture;
 	};
 }
@@ -0,0 +1,34 @@
+/*
+This file belongs to GlRenderer.
+See LICENSE file in root folder.
+*/
+#include "GlMultiDrawCommand.hpp"
+
+namespace gl_renderer
+{
+	MultiDrawCommand::MultiDrawCommand( renderer::DrawIndirectCommand const & first
+		, renderer::DrawIndirectCommand const & second
+		, GlPrimitiveTopology mode )
+		: m_mode{ mode }
+	{
+		addDraw( first );
+		addDraw( second );
+	}
+
+	void MultiDrawCommand::addDraw( renderer::DrawIndirectCommand const & draw )
+	{
+		assert( isBatchable( draw ) );
+		m_firsts.push_back( GLint( draw.firstVertex ) );
+		m_counts.push_back( GLsizei( draw.vertexCount ) );
+	}
+
+	void MultiDrawCommand::apply()const
+	{
+		glLogCommand( "MultiDrawCommand" );
+		glLogCall( gl::MultiDrawArrays
+			, m_mode
+			, m_firsts.data()
+			, m_counts.data()
+			, GLsizei( m_counts.size() ) );
+	}
+}
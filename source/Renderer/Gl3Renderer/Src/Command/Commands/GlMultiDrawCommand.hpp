@@ -0,0 +1,71 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "GlCommandBase.hpp"
+
+#include <Miscellaneous/DrawIndirectCommand.hpp>
+
+namespace gl_renderer
+{
+	/**
+	*\brief
+	*	Commande de dessins non indexés consécutifs, regroupés en un seul glMultiDrawArrays.
+	*\remarks
+	*	Générée par CommandBuffer lorsque des appels à draw se suivent sans autre commande entre eux,
+	*	ils partagent alors le pipeline, les descriptor sets, le VAO et les push constants.
+	*	glMultiDrawArrays ne gère pas l'instanciation, seuls les dessins d'une instance sont regroupés.
+	*/
+	class MultiDrawCommand final
+		: public CommandBase
+	{
+	public:
+		/**
+		*\brief
+		*	Constructeur.
+		*\param[in] first, second
+		*	Les deux premiers dessins du groupe.
+		*\param[in] mode
+		*	Le type de primitives.
+		*/
+		MultiDrawCommand( renderer::DrawIndirectCommand const & first
+			, renderer::DrawIndirectCommand const & second
+			, GlPrimitiveTopology mode );
+		/**
+		*\brief
+		*	Ajoute un dessin au groupe.
+		*/
+		void addDraw( renderer::DrawIndirectCommand const & draw );
+		void apply()const override;
+		/**
+		*\return
+		*	Le type de primitives.
+		*/
+		inline GlPrimitiveTopology getMode()const
+		{
+			return m_mode;
+		}
+		/**
+		*\return
+		*	\p true si le dessin peut être regroupé.
+		*/
+		static inline bool isBatchable( renderer::DrawIndirectCommand const & draw )
+		{
+			return draw.instanceCount == 1u
+				&& draw.firstInstance == 0u;
+		}
+
+	private:
+		std::vector< GLint > m_firsts;
+		std::vector< GLsizei > m_counts;
+		GlPrimitiveTopology m_mode;
+	};
+
+	template<>
+	struct CommandTypeGetter< MultiDrawCommand >
+	{
+		static CommandType constexpr value = CommandType::eMultiDraw;
+	};
+}
@@ -0,0 +1,42 @@
+/*
+This file belongs to GlRenderer.
+See LICENSE file in root folder.
+*/
+#include "GlMultiDrawIndexedCommand.hpp"
+
+namespace gl_renderer
+{
+	MultiDrawIndexedCommand::MultiDrawIndexedCommand( renderer::DrawIndexedIndirectCommand const & first
+		, renderer::DrawIndexedIndirectCommand const & second
+		, GlPrimitiveTopology mode
+		, GlIndexType type )
+		: m_mode{ mode }
+		, m_type{ type }
+	{
+		addDraw( first );
+		addDraw( second );
+	}
+
+	void MultiDrawIndexedCommand::addDraw( renderer::DrawIndexedIndirectCommand const & draw )
+	{
+		assert( isBatchable( draw ) );
+		auto size = m_type == GL_INDEX_TYPE_UINT16
+			? 2u
+			: 4u;
+		m_counts.push_back( GLsizei( draw.indexCount ) );
+		m_indices.push_back( BufferOffset( draw.firstIndex * size ) );
+		m_baseVertices.push_back( GLint( draw.vertexOffset ) );
+	}
+
+	void MultiDrawIndexedCommand::apply()const
+	{
+		glLogCommand( "MultiDrawIndexedCommand" );
+		glLogCall( gl::MultiDrawElementsBaseVertex
+			, m_mode
+			, m_counts.data()
+			, m_type
+			, m_indices.data()
+			, GLsizei( m_counts.size() )
+			, m_baseVertices.data() );
+	}
+}
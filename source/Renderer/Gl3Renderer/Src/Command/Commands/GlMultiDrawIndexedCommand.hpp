@@ -0,0 +1,84 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "GlCommandBase.hpp"
+
+#include <Miscellaneous/DrawIndexedIndirectCommand.hpp>
+
+namespace gl_renderer
+{
+	/**
+	*\brief
+	*	Commande de dessins indexés consécutifs, regroupés en un seul glMultiDrawElementsBaseVertex.
+	*\remarks
+	*	Générée par CommandBuffer lorsque des appels à drawIndexed se suivent sans autre commande entre eux,
+	*	ils partagent alors le pipeline, les descriptor sets, le VAO et les push constants.
+	*	glMultiDrawElementsBaseVertex ne gère pas l'instanciation, seuls les dessins d'une instance sont regroupés.
+	*/
+	class MultiDrawIndexedCommand final
+		: public CommandBase
+	{
+	public:
+		/**
+		*\brief
+		*	Constructeur.
+		*\param[in] first, second
+		*	Les deux premiers dessins du groupe.
+		*\param[in] mode
+		*	Le type de primitives.
+		*\param[in] type
+		*	Le type des indices.
+		*/
+		MultiDrawIndexedCommand( renderer::DrawIndexedIndirectCommand const & first
+			, renderer::DrawIndexedIndirectCommand const & second
+			, GlPrimitiveTopology mode
+			, GlIndexType type );
+		/**
+		*\brief
+		*	Ajoute un dessin au groupe.
+		*/
+		void addDraw( renderer::DrawIndexedIndirectCommand const & draw );
+		void apply()const override;
+		/**
+		*\return
+		*	Le type de primitives.
+		*/
+		inline GlPrimitiveTopology getMode()const
+		{
+			return m_mode;
+		}
+		/**
+		*\return
+		*	Le type des indices.
+		*/
+		inline GlIndexType getType()const
+		{
+			return m_type;
+		}
+		/**
+		*\return
+		*	\p true si le dessin peut être regroupé.
+		*/
+		static inline bool isBatchable( renderer::DrawIndexedIndirectCommand const & draw )
+		{
+			return draw.instanceCount == 1u
+				&& draw.firstInstance == 0u;
+		}
+
+	private:
+		std::vector< GLsizei > m_counts;
+		std::vector< GLvoid const * > m_indices;
+		std::vector< GLint > m_baseVertices;
+		GlPrimitiveTopology m_mode;
+		GlIndexType m_type;
+	};
+
+	template<>
+	struct CommandTypeGetter< MultiDrawIndexedCommand >
+	{
+		static CommandType constexpr value = CommandType::eMultiDrawIndexed;
+	};
+}
@@ -0,0 +1,142 @@
+/*
+This file belongs to GlRenderer.
+See LICENSE file in root folder.
+*/
+#include "GlPushConstantsBufferCommand.hpp"
+
+#include "Core/GlDevice.hpp"
+
+#include <Buffer/PushConstantsBuffer.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace gl_renderer
+{
+	namespace
+	{
+		size_t doAlign( size_t value, size_t alignment )
+		{
+			return ( ( value + alignment - 1u ) / alignment ) * alignment;
+		}
+
+		uint32_t getColumnCount( renderer::ConstantFormat format )
+		{
+			switch ( format )
+			{
+			case renderer::ConstantFormat::eMat2f:
+				return 2u;
+
+			case renderer::ConstantFormat::eMat3f:
+				return 3u;
+
+			case renderer::ConstantFormat::eMat4f:
+				return 4u;
+
+			default:
+				return 1u;
+			}
+		}
+
+		uint32_t getStd140Alignment( renderer::ConstantFormat format )
+		{
+			switch ( format )
+			{
+			case renderer::ConstantFormat::eFloat:
+			case renderer::ConstantFormat::eInt:
+			case renderer::ConstantFormat::eUInt:
+				return 4u;
+
+			case renderer::ConstantFormat::eVec2f:
+			case renderer::ConstantFormat::eVec2i:
+			case renderer::ConstantFormat::eVec2ui:
+				return 8u;
+
+			default:
+				return 16u;
+			}
+		}
+
+		void doWriteColumn( renderer::ConstantFormat format
+			, uint8_t const * src
+			, uint32_t srcSize
+			, uint8_t * dst )
+		{
+			if ( format == renderer::ConstantFormat::eColour )
+			{
+				// RGBA8 colour, the shader sees a vec4.
+				auto floats = reinterpret_cast< float * >( dst );
+
+				for ( auto i = 0u; i < 4u; ++i )
+				{
+					floats[i] = float( src[i] ) / 255.0f;
+				}
+			}
+			else
+			{
+				std::memcpy( dst, src, srcSize );
+			}
+		}
+	}
+
+	PushConstantsBufferCommand::PushConstantsBufferCommand( Device const & device
+		, PushConstantsStorage & storage
+		, std::vector< renderer::PushConstantsBufferBase > const & ranges )
+		: m_device{ device }
+		, m_storage{ storage }
+		, m_offset{ GLintptr( doAlign( storage.data.size()
+			, std::max( size_t( device.getProperties().limits.minUniformBufferOffsetAlignment ), size_t( 16u ) ) ) ) }
+		, m_size{ 0 }
+	{
+		size_t offset = 0u;
+
+		for ( auto & pcb : ranges )
+		{
+			for ( auto & constant : pcb )
+			{
+				auto columns = getColumnCount( constant.format );
+				auto srcColumnSize = renderer::getSize( constant.format ) / columns;
+				auto dstColumnSize = constant.format == renderer::ConstantFormat::eColour
+					? uint32_t( 4u * sizeof( float ) )
+					: srcColumnSize;
+				// Matrix columns and array elements are aligned on vec4.
+				auto padded = columns > 1u || constant.arraySize > 1u;
+				auto dstColumnStride = padded
+					? uint32_t( doAlign( dstColumnSize, 16u ) )
+					: dstColumnSize;
+				offset = doAlign( offset
+					, padded
+						? 16u
+						: getStd140Alignment( constant.format ) );
+				auto src = pcb.getData() + ( constant.offset - pcb.getOffset() );
+				auto count = columns * std::max( constant.arraySize, 1u );
+				storage.data.resize( std::max( storage.data.size()
+					, size_t( m_offset + offset + count * dstColumnStride ) ) );
+
+				for ( auto i = 0u; i < count; ++i )
+				{
+					doWriteColumn( constant.format
+						, src
+						, srcColumnSize
+						, storage.data.data() + m_offset + offset );
+					src += srcColumnSize;
+					offset += dstColumnStride;
+				}
+			}
+		}
+
+		m_size = GLsizeiptr( doAlign( offset, 16u ) );
+		storage.data.resize( size_t( m_offset + m_size ) );
+		storage.dirty = true;
+	}
+
+	void PushConstantsBufferCommand::apply()const
+	{
+		glLogCommand( "PushConstantsBufferCommand" );
+		m_device.bindBufferRange( GL_BUFFER_TARGET_UNIFORM
+			, m_device.getPushConstantsBinding()
+			, m_storage.buffer
+			, m_offset
+			, m_size );
+	}
+}
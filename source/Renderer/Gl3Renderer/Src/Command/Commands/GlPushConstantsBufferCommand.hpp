@@ -0,0 +1,65 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "GlCommandBase.hpp"
+
+namespace gl_renderer
+{
+	/**
+	*\brief
+	*	Les push constants d'un tampon de commandes, stockées au format std140.
+	*/
+	struct PushConstantsStorage
+	{
+		//! Les blocs std140 de toutes les commandes, alignés sur GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT.
+		renderer::ByteArray data;
+		//! Le tampon uniforme contenant data, créé lors de la soumission.
+		GLuint buffer{ GL_INVALID_INDEX };
+		//! Dit si data a changé depuis la création de buffer.
+		bool dirty{ false };
+	};
+	/**
+	*\brief
+	*	Commande d'activation de push constants écrites dans un tampon uniforme.
+	*\remarks
+	*	Les intervalles de push constants sont écrits à la suite, en un seul bloc std140, dans le PushConstantsStorage
+	*	lors de l'enregistrement, et le bloc est attaché au point d'attache Device::getPushConstantsBinding
+	*	lors de l'exécution.
+	*	Le shader doit déclarer les constantes de tous les intervalles, dans l'ordre de leurs décalages, dans un bloc
+	*	"layout( std140 ) uniform PushConstants".
+	*/
+	class PushConstantsBufferCommand final
+		: public CommandBase
+	{
+	public:
+		/**
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in,out] storage
+		*	Le stockage des push constants du tampon de commandes.
+		*\param[in] ranges
+		*	Les intervalles de push constants, triés par décalage.
+		*/
+		PushConstantsBufferCommand( Device const & device
+			, PushConstantsStorage & storage
+			, std::vector< renderer::PushConstantsBufferBase > const & ranges );
+		void apply()const override;
+
+	private:
+		Device const & m_device;
+		PushConstantsStorage const & m_storage;
+		GLintptr m_offset;
+		GLsizeiptr m_size;
+	};
+
+	template<>
+	struct CommandTypeGetter< PushConstantsBufferCommand >
+	{
+		static CommandType constexpr value = CommandType::ePushConstantsBuffer;
+	};
+}
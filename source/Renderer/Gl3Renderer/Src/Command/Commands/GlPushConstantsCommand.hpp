@@ -12,17 +12,22 @@ namespace gl_renderer
 	*\brief
 	*	Commande de d�marrage d'une requ�te.
 	*/
-	class PushConstantsCommand
+	class PushConstantsCommand final
 		: public CommandBase
 	{
 	public:
 		PushConstantsCommand( renderer::PipelineLayout const & layout
 			, renderer::PushConstantsBufferBase const & pcb );
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		renderer::PushConstantsBufferBase const & m_pcb;
 		renderer::ByteArray m_data;
 	};
+
+	template<>
+	struct CommandTypeGetter< PushConstantsCommand >
+	{
+		static CommandType constexpr value = CommandType::ePushConstants;
+	};
 }
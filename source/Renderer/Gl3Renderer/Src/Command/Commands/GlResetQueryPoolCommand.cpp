@@ -16,9 +16,4 @@ namespace gl_renderer
 	{
 		glLogCommand( "ResetQueryPoolCommand" );
 	}
-
-	CommandPtr ResetQueryPoolCommand::clone()const
-	{
-		return std::make_unique< ResetQueryPoolCommand >( *this );
-	}
 }
@@ -14,7 +14,7 @@ namespace gl_renderer
 	*\brief
 	*	Commande d'application d'un scissor.
 	*/
-	class ScissorCommand
+	class ScissorCommand final
 		: public CommandBase
 	{
 	public:
@@ -28,10 +28,15 @@ namespace gl_renderer
 			, renderer::Scissor const & scissor );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		Device const & m_device;
 		renderer::Scissor m_scissor;
 	};
+
+	template<>
+	struct CommandTypeGetter< ScissorCommand >
+	{
+		static CommandType constexpr value = CommandType::eScissor;
+	};
 }
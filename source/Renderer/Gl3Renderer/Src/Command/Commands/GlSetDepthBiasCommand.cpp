@@ -20,9 +20,4 @@ namespace gl_renderer
 		glLogCommand( "SetDepthBiasCommand" );
 		glLogCall( gl::PolygonOffsetClampEXT, m_slopeFactor, m_constantFactor, m_clamp );
 	}
-
-	CommandPtr SetDepthBiasCommand::clone()const
-	{
-		return std::make_unique< SetDepthBiasCommand >( *this );
-	}
 }
@@ -19,9 +19,4 @@ namespace gl_renderer
 		glLogCommand( "SetEventCommand" );
 		m_event.reset();
 	}
-
-	CommandPtr SetEventCommand::clone()const
-	{
-		return std::make_unique< SetEventCommand >( *this );
-	}
 }
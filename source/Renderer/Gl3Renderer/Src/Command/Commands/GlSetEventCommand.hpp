@@ -15,7 +15,6 @@ namespace gl_renderer
 		SetEventCommand( renderer::Event const & event
 			, renderer::PipelineStageFlags stageFlags );
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		renderer::Event const & m_event;
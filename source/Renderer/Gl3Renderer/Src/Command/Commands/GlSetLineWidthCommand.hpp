@@ -27,7 +27,6 @@ namespace gl_renderer
 		SetLineWidthCommand( float width );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		float m_width;
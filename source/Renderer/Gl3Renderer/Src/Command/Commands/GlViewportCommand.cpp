@@ -33,9 +33,4 @@ namespace gl_renderer
 			save = m_viewport;
 		}
 	}
-
-	CommandPtr ViewportCommand::clone()const
-	{
-		return std::make_unique< ViewportCommand >( *this );
-	}
 }
@@ -14,7 +14,7 @@ namespace gl_renderer
 	*\brief
 	*	Commande d'application d'un viewport.
 	*/
-	class ViewportCommand
+	class ViewportCommand final
 		: public CommandBase
 	{
 	public:
@@ -28,10 +28,15 @@ namespace gl_renderer
 			, renderer::Viewport const & viewport );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		Device const & m_device;
 		renderer::Viewport m_viewport;
 	};
+
+	template<>
+	struct CommandTypeGetter< ViewportCommand >
+	{
+		static CommandType constexpr value = CommandType::eViewport;
+	};
 }
@@ -39,9 +39,4 @@ namespace gl_renderer
 		}
 		while ( count != m_events.size() );
 	}
-
-	CommandPtr WaitEventsCommand::clone()const
-	{
-		return std::make_unique< WaitEventsCommand >( *this );
-	}
 }
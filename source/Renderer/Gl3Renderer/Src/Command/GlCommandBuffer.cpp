@@ -8,6 +8,7 @@ See LICENSE file in root folder.
 #include "Buffer/GlGeometryBuffers.hpp"
 #include "Buffer/GlUniformBuffer.hpp"
 #include "Command/GlCommandPool.hpp"
+#include "Command/GlCommandStream.hpp"
 #include "Core/GlDevice.hpp"
 #include "Core/GlRenderer.hpp"
 #include "Descriptor/GlDescriptorSet.hpp"
@@ -47,8 +48,11 @@ See LICENSE file in root folder.
 #include "Commands/GlEndQueryCommand.hpp"
 #include "Commands/GlEndRenderPassCommand.hpp"
 #include "Commands/GlEndSubpassCommand.hpp"
+#include "Commands/GlExecuteCommandsCommand.hpp"
 #include "Commands/GlGenerateMipmapsCommand.hpp"
 #include "Commands/GlImageMemoryBarrierCommand.hpp"
+#include "Commands/GlMultiDrawCommand.hpp"
+#include "Commands/GlMultiDrawIndexedCommand.hpp"
 #include "Commands/GlNextSubpassCommand.hpp"
 #include "Commands/GlPushConstantsCommand.hpp"
 #include "Commands/GlResetEventCommand.hpp"
@@ -75,6 +79,19 @@ namespace gl_renderer
 			assert( index < write.imageInfo.size() );
 			return write.imageInfo[index].imageView.value().get();
 		}
+
+		uint32_t getFirstIndex( IboBinding const & ibo
+			, renderer::IndexType type
+			, uint32_t firstIndex )
+		{
+			// OpenGL takes no index buffer offset, it can only be given through the first index.
+			if ( !ibo )
+			{
+				return firstIndex;
+			}
+
+			return firstIndex + uint32_t( ibo.value().offset / ( type == renderer::IndexType::eUInt16 ? 2u : 4u ) );
+		}
 	}
 
 	CommandBuffer::CommandBuffer( Device const & device
@@ -85,23 +102,40 @@ namespace gl_renderer
 	{
 	}
 
+	CommandBuffer::~CommandBuffer()
+	{
+		if ( m_pushConstants.buffer != GL_INVALID_INDEX )
+		{
+			m_device.onBufferDeleted( m_pushConstants.buffer );
+			glLogCall( gl::DeleteBuffers, 1, &m_pushConstants.buffer );
+		}
+	}
+
 	void CommandBuffer::applyPostSubmitActions()const
 	{
 		for ( auto & action : m_afterSubmitActions )
 		{
 			action();
 		}
+
+		for ( auto & commandBuffer : m_secondaryCommandBuffers )
+		{
+			commandBuffer->applyPostSubmitActions();
+		}
 	}
 
 	void CommandBuffer::generateMipmaps( Texture const & texture )const
 	{
-		m_commands.emplace_back( std::make_unique< GenerateMipmapsCommand >( texture ) );
+		m_commands.emplace< GenerateMipmapsCommand >( m_device
+			, texture );
 	}
 
 	void CommandBuffer::begin( renderer::CommandBufferUsageFlags flags )const
 	{
 		m_afterSubmitActions.clear();
+		m_secondaryCommandBuffers.clear();
 		m_commands.clear();
+		m_pushConstants.data.clear();
 		m_state = State{};
 		m_state.m_beginFlags = flags;
 	}
@@ -110,7 +144,9 @@ namespace gl_renderer
 		, renderer::CommandBufferInheritanceInfo const & inheritanceInfo )const
 	{
 		m_afterSubmitActions.clear();
+		m_secondaryCommandBuffers.clear();
 		m_commands.clear();
+		m_pushConstants.data.clear();
 		m_state = State{};
 		m_state.m_beginFlags = flags;
 	}
@@ -123,7 +159,19 @@ namespace gl_renderer
 	void CommandBuffer::reset( renderer::CommandBufferResetFlags flags )const
 	{
 		m_afterSubmitActions.clear();
-		m_commands.clear();
+		m_secondaryCommandBuffers.clear();
+
+		m_pushConstants.data.clear();
+
+		if ( checkFlag( flags, renderer::CommandBufferResetFlag::eReleaseResources ) )
+		{
+			m_commands.release();
+			m_pushConstants.data.shrink_to_fit();
+		}
+		else
+		{
+			m_commands.clear();
+		}
 	}
 
 	void CommandBuffer::beginRenderPass( renderer::RenderPass const & renderPass
@@ -135,32 +183,32 @@ namespace gl_renderer
 		m_state.m_currentFrameBuffer = &frameBuffer;
 		m_state.m_currentSubpassIndex = 0u;
 		m_state.m_currentSubpass = &m_state.m_currentRenderPass->getSubpasses()[m_state.m_currentSubpassIndex++];
-		m_commands.emplace_back( std::make_unique< BeginRenderPassCommand >( m_device
+		m_commands.emplace< BeginRenderPassCommand >( m_device
 			, renderPass
 			, frameBuffer
 			, clearValues
 			, contents
-			, *m_state.m_currentSubpass ) );
+			, *m_state.m_currentSubpass );
 	}
 
 	void CommandBuffer::nextSubpass( renderer::SubpassContents contents )const
 	{
-		m_commands.emplace_back( std::make_unique< EndSubpassCommand >( m_device
+		m_commands.emplace< EndSubpassCommand >( m_device
 			, *m_state.m_currentFrameBuffer
-			, *m_state.m_currentSubpass ) );
+			, *m_state.m_currentSubpass );
 		m_state.m_currentSubpass = &m_state.m_currentRenderPass->getSubpasses()[m_state.m_currentSubpassIndex++];
-		m_commands.emplace_back( std::make_unique< NextSubpassCommand >( *m_state.m_currentRenderPass
+		m_commands.emplace< NextSubpassCommand >( *m_state.m_currentRenderPass
 			, *m_state.m_currentFrameBuffer
-			, *m_state.m_currentSubpass ) );
+			, *m_state.m_currentSubpass );
 		m_state.m_boundVbos.clear();
 	}
 
 	void CommandBuffer::endRenderPass()const
 	{
-		m_commands.emplace_back( std::make_unique< EndSubpassCommand >( m_device
+		m_commands.emplace< EndSubpassCommand >( m_device
 			, *m_state.m_currentFrameBuffer
-			, *m_state.m_currentSubpass ) );
-		m_commands.emplace_back( std::make_unique< EndRenderPassCommand >() );
+			, *m_state.m_currentSubpass );
+		m_commands.emplace< EndRenderPassCommand >();
 		m_state.m_boundVbos.clear();
 	}
 
@@ -169,16 +217,14 @@ namespace gl_renderer
 		for ( auto & commandBuffer : commands )
 		{
 			auto & glCommandBuffer = static_cast< CommandBuffer const & >( commandBuffer.get() );
-			glCommandBuffer.initialiseGeometryBuffers();
+			m_commands.emplace< ExecuteCommandsCommand >( glCommandBuffer );
 
-			for ( auto & command : glCommandBuffer.getCommands() )
+			if ( m_secondaryCommandBuffers.end() == std::find( m_secondaryCommandBuffers.begin()
+				, m_secondaryCommandBuffers.end()
+				, &glCommandBuffer ) )
 			{
-				m_commands.emplace_back( command->clone() );
+				m_secondaryCommandBuffers.push_back( &glCommandBuffer );
 			}
-
-			m_afterSubmitActions.insert( m_afterSubmitActions.end()
-				, glCommandBuffer.m_afterSubmitActions.begin()
-				, glCommandBuffer.m_afterSubmitActions.end() );
 		}
 	}
 
@@ -187,11 +233,11 @@ namespace gl_renderer
 	{
 		if ( !m_device.getRenderer().getFeatures().hasClearTexImage )
 		{
-			m_commands.emplace_back( std::make_unique< ClearColourFboCommand >( m_device, image, colour ) );
+			m_commands.emplace< ClearColourFboCommand >( m_device, image, colour );
 		}
 		else
 		{
-			m_commands.emplace_back( std::make_unique< ClearColourCommand >( image, colour ) );
+			m_commands.emplace< ClearColourCommand >( image, colour );
 		}
 	}
 
@@ -200,18 +246,18 @@ namespace gl_renderer
 	{
 		if ( !m_device.getRenderer().getFeatures().hasClearTexImage )
 		{
-			m_commands.emplace_back( std::make_unique< ClearDepthStencilFboCommand >( m_device, image, value ) );
+			m_commands.emplace< ClearDepthStencilFboCommand >( m_device, image, value );
 		}
 		else
 		{
-			m_commands.emplace_back( std::make_unique< ClearDepthStencilCommand >( image, value ) );
+			m_commands.emplace< ClearDepthStencilCommand >( image, value );
 		}
 	}
 
 	void CommandBuffer::clearAttachments( renderer::ClearAttachmentArray const & clearAttachments
 		, renderer::ClearRectArray const & clearRects )
 	{
-		m_commands.emplace_back( std::make_unique< ClearAttachmentsCommand >( m_device, clearAttachments, clearRects ) );
+		m_commands.emplace< ClearAttachmentsCommand >( m_device, clearAttachments, clearRects );
 	}
 
 	void CommandBuffer::bindPipeline( renderer::Pipeline const & pipeline
@@ -231,18 +277,44 @@ namespace gl_renderer
 		}
 
 		m_state.m_currentPipeline = &static_cast< Pipeline const & >( pipeline );
-		m_commands.emplace_back( std::make_unique< BindPipelineCommand >( m_device, pipeline, bindingPoint ) );
+
+		if ( doCheckTrackedState()
+			&& m_state.m_trackedPipeline == m_state.m_currentPipeline
+			&& m_state.m_pushConstantBuffers.empty() )
+		{
+			++m_state.m_removed.pipelines;
+			return;
+		}
+
+		m_commands.emplace< BindPipelineCommand >( m_device, pipeline, bindingPoint );
+
+		if ( doCheckTrackedState() )
+		{
+			m_state.m_trackedPipeline = m_state.m_currentPipeline;
+
+			if ( !m_state.m_currentPipeline->hasDynamicState( renderer::DynamicState::eViewport ) )
+			{
+				m_state.m_trackedViewport.reset();
+			}
+
+			if ( !m_state.m_currentPipeline->hasDynamicState( renderer::DynamicState::eScissor ) )
+			{
+				m_state.m_trackedScissor.reset();
+			}
+		}
 
 		for ( auto & pcb : m_state.m_pushConstantBuffers )
 		{
-			m_commands.emplace_back( std::make_unique< PushConstantsCommand >( *pcb.first
-				, *pcb.second ) );
+			doPushConstants( *pcb.first
+				, *pcb.second
+				, false );
 		}
 
 		for ( auto & pcb : m_state.m_currentPipeline->getConstantsPcbs() )
 		{
-			m_commands.emplace_back( std::make_unique< PushConstantsCommand >( m_state.m_currentPipeline->getLayout()
-				, pcb ) );
+			doPushConstants( m_state.m_currentPipeline->getLayout()
+				, pcb
+				, true );
 		}
 
 		m_state.m_pushConstantBuffers.clear();
@@ -260,18 +332,20 @@ namespace gl_renderer
 		if ( m_device.getRenderer().getFeatures().hasComputeShaders )
 		{
 			m_state.m_currentComputePipeline = &static_cast< ComputePipeline const & >( pipeline );
-			m_commands.emplace_back( std::make_unique< BindComputePipelineCommand >( m_device, pipeline, bindingPoint ) );
+			m_commands.emplace< BindComputePipelineCommand >( m_device, pipeline, bindingPoint );
 
 			for ( auto & pcb : m_state.m_pushConstantBuffers )
 			{
-				m_commands.emplace_back( std::make_unique< PushConstantsCommand >( *pcb.first
-					, *pcb.second ) );
+				doEmplacePushConstants( *pcb.first
+					, *pcb.second
+					, false );
 			}
 
 			for ( auto & pcb : m_state.m_currentComputePipeline->getConstantsPcbs() )
 			{
-				m_commands.emplace_back( std::make_unique< PushConstantsCommand >( m_state.m_currentComputePipeline->getLayout()
-					, pcb ) );
+				doEmplacePushConstants( m_state.m_currentComputePipeline->getLayout()
+					, pcb
+					, true );
 			}
 
 			m_state.m_pushConstantBuffers.clear();
@@ -298,7 +372,7 @@ namespace gl_renderer
 		for ( auto i = 0u; i < buffers.size(); ++i )
 		{
 			auto & glBuffer = static_cast< Buffer const & >( buffers[i].get() );
-			m_state.m_boundVbos[binding] = { glBuffer.getBuffer(), offsets[i], &glBuffer };
+			m_state.m_boundVbos[binding] = { glBuffer.getBuffer(), offsets[i] + glBuffer.getOffset(), &glBuffer };
 			++binding;
 		}
 
@@ -310,7 +384,7 @@ namespace gl_renderer
 		, renderer::IndexType indexType )const
 	{
 		auto & glBuffer = static_cast< Buffer const & >( buffer );
-		m_state.m_boundIbo = BufferObjectBinding{ glBuffer.getBuffer(), offset, &glBuffer };
+		m_state.m_boundIbo = BufferObjectBinding{ glBuffer.getBuffer(), offset + glBuffer.getOffset(), &glBuffer };
 		m_state.m_indexType = indexType;
 		m_state.m_boundVao = nullptr;
 	}
@@ -322,11 +396,34 @@ namespace gl_renderer
 	{
 		for ( auto & descriptorSet : descriptorSets )
 		{
-			m_commands.emplace_back( std::make_unique< BindDescriptorSetCommand >( m_device
+			if ( doCheckTrackedState() )
+			{
+				auto & glDescriptorSet = static_cast< DescriptorSet const & >( descriptorSet.get() );
+				auto index = glDescriptorSet.getBindingPoint();
+
+				if ( index >= m_state.m_trackedDescriptorSets.size() )
+				{
+					m_state.m_trackedDescriptorSets.resize( index + 1u );
+				}
+
+				auto & bound = m_state.m_trackedDescriptorSets[index];
+
+				if ( bound.descriptorSet == &glDescriptorSet
+					&& bound.layout == &layout
+					&& bound.dynamicOffsets == dynamicOffsets )
+				{
+					++m_state.m_removed.descriptorSets;
+					continue;
+				}
+
+				bound = { &glDescriptorSet, &layout, dynamicOffsets };
+			}
+
+			m_commands.emplace< BindDescriptorSetCommand >( m_device
 				, descriptorSet.get()
 				, layout
 				, dynamicOffsets
-				, bindingPoint ) );
+				, bindingPoint );
 
 			auto & glDescriptorSet = static_cast< DescriptorSet const & >( descriptorSet.get() );
 
@@ -338,15 +435,12 @@ namespace gl_renderer
 					auto & view = getView( write, i );
 					auto type = convert( view.getType() );
 					m_afterSubmitActions.insert( m_afterSubmitActions.begin()
-						, [type, i, bindingIndex]()
+						, [this, type, bindingIndex]()
 						{
-							glLogCall( gl::ActiveTexture
-								, GlTextureUnit( GL_TEXTURE0 + bindingIndex ) );
-							glLogCall( gl::BindTexture
+							m_device.bindTexture( bindingIndex
 								, type
 								, 0u );
-							glLogCall( gl::BindSampler
-								, bindingIndex
+							m_device.bindSampler( bindingIndex
 								, 0u );
 						} );
 				}
@@ -360,11 +454,9 @@ namespace gl_renderer
 					auto & view = getView( write, i );
 					auto type = convert( view.getType() );
 					m_afterSubmitActions.insert( m_afterSubmitActions.begin()
-						, [type, i, bindingIndex]()
+						, [this, type, bindingIndex]()
 						{
-							glLogCall( gl::ActiveTexture
-								, GlTextureUnit( GL_TEXTURE0 + bindingIndex ) );
-							glLogCall( gl::BindTexture
+							m_device.bindTexture( bindingIndex
 								, type
 								, 0u );
 						} );
@@ -375,12 +467,34 @@ namespace gl_renderer
 
 	void CommandBuffer::setViewport( renderer::Viewport const & viewport )const
 	{
-		m_commands.emplace_back( std::make_unique< ViewportCommand >( m_device, viewport ) );
+		if ( doCheckTrackedState() )
+		{
+			if ( m_state.m_trackedViewport == viewport )
+			{
+				++m_state.m_removed.viewports;
+				return;
+			}
+
+			m_state.m_trackedViewport = viewport;
+		}
+
+		m_commands.emplace< ViewportCommand >( m_device, viewport );
 	}
 
 	void CommandBuffer::setScissor( renderer::Scissor const & scissor )const
 	{
-		m_commands.emplace_back( std::make_unique< ScissorCommand >( m_device, scissor ) );
+		if ( doCheckTrackedState() )
+		{
+			if ( m_state.m_trackedScissor == scissor )
+			{
+				++m_state.m_removed.scissors;
+				return;
+			}
+
+			m_state.m_trackedScissor = scissor;
+		}
+
+		m_commands.emplace< ScissorCommand >( m_device, scissor );
 	}
 
 	void CommandBuffer::draw( uint32_t vtxCount
@@ -392,15 +506,22 @@ namespace gl_renderer
 		{
 			bindIndexBuffer( m_device.getEmptyIndexedVaoIdx(), 0u, renderer::IndexType::eUInt32 );
 			m_state.m_boundVao = &m_device.getEmptyIndexedVao();
-			m_commands.emplace_back( std::make_unique< BindGeometryBuffersCommand >( *m_state.m_boundVao ) );
-			m_commands.emplace_back( std::make_unique< DrawIndexedCommand >( m_device
+			doBindGeometryBuffers( *m_state.m_boundVao );
+			auto firstIndex = getFirstIndex( m_state.m_boundIbo, m_state.m_indexType, 0u );
+
+			if ( doBatchDraw( renderer::DrawIndexedIndirectCommand{ vtxCount, instCount, firstIndex, int32_t( firstVertex ), firstInstance } ) )
+			{
+				return;
+			}
+
+			m_commands.emplace< DrawIndexedCommand >( m_device
 				, vtxCount
 				, instCount
-				, 0u
+				, firstIndex
 				, firstVertex
 				, firstInstance
 				, m_state.m_currentPipeline->getInputAssemblyState().topology
-				, m_state.m_indexType ) );
+				, m_state.m_indexType );
 		}
 		else
 		{
@@ -409,12 +530,17 @@ namespace gl_renderer
 				doBindVao();
 			}
 
-			m_commands.emplace_back( std::make_unique< DrawCommand >( m_device
+			if ( doBatchDraw( renderer::DrawIndirectCommand{ vtxCount, instCount, firstVertex, firstInstance } ) )
+			{
+				return;
+			}
+
+			m_commands.emplace< DrawCommand >( m_device
 				, vtxCount
 				, instCount
 				, firstVertex
 				, firstInstance
-				, m_state.m_currentPipeline->getInputAssemblyState().topology ) );
+				, m_state.m_currentPipeline->getInputAssemblyState().topology );
 		}
 
 		m_afterSubmitActions.insert( m_afterSubmitActions.begin()
@@ -434,21 +560,28 @@ namespace gl_renderer
 		{
 			bindIndexBuffer( m_device.getEmptyIndexedVaoIdx(), 0u, renderer::IndexType::eUInt32 );
 			m_state.m_boundVao = &m_device.getEmptyIndexedVao();
-			m_commands.emplace_back( std::make_unique< BindGeometryBuffersCommand >( *m_state.m_boundVao ) );
+			doBindGeometryBuffers( *m_state.m_boundVao );
 		}
 		else if ( !m_state.m_boundVao )
 		{
 			doBindVao();
 		}
 
-		m_commands.emplace_back( std::make_unique< DrawIndexedCommand >( m_device
+		firstIndex = getFirstIndex( m_state.m_boundIbo, m_state.m_indexType, firstIndex );
+
+		if ( doBatchDraw( renderer::DrawIndexedIndirectCommand{ indexCount, instCount, firstIndex, int32_t( vertexOffset ), firstInstance } ) )
+		{
+			return;
+		}
+
+		m_commands.emplace< DrawIndexedCommand >( m_device
 			, indexCount
 			, instCount
 			, firstIndex
 			, vertexOffset
 			, firstInstance
 			, m_state.m_currentPipeline->getInputAssemblyState().topology
-			, m_state.m_indexType ) );
+			, m_state.m_indexType );
 
 		m_afterSubmitActions.insert( m_afterSubmitActions.begin()
 			, []()
@@ -472,11 +605,11 @@ namespace gl_renderer
 			doBindVao();
 		}
 
-		m_commands.emplace_back( std::make_unique< DrawIndirectCommand >( buffer
+		m_commands.emplace< DrawIndirectCommand >( buffer
 			, offset
 			, drawCount
 			, stride
-			, m_state.m_currentPipeline->getInputAssemblyState().topology ) );
+			, m_state.m_currentPipeline->getInputAssemblyState().topology );
 
 		m_afterSubmitActions.insert( m_afterSubmitActions.begin()
 			, []()
@@ -499,20 +632,20 @@ namespace gl_renderer
 		{
 			bindIndexBuffer( m_device.getEmptyIndexedVaoIdx(), 0u, renderer::IndexType::eUInt32 );
 			m_state.m_boundVao = &m_device.getEmptyIndexedVao();
-			m_commands.emplace_back( std::make_unique< BindGeometryBuffersCommand >( *m_state.m_boundVao ) );
+			doBindGeometryBuffers( *m_state.m_boundVao );
 		}
 		else if ( !m_state.m_boundVao )
 		{
 			doBindVao();
 		}
 
-		m_commands.emplace_back( std::make_unique< DrawIndexedIndirectCommand >( m_device
+		m_commands.emplace< DrawIndexedIndirectCommand >( m_device
 			, buffer
 			, offset
 			, drawCount
 			, stride
 			, m_state.m_currentPipeline->getInputAssemblyState().topology
-			, m_state.m_indexType ) );
+			, m_state.m_indexType );
 
 		m_afterSubmitActions.insert( m_afterSubmitActions.begin()
 			, []()
@@ -525,28 +658,29 @@ namespace gl_renderer
 		, renderer::BufferBase const & src
 		, renderer::Texture const & dst )const
 	{
-		m_commands.emplace_back( std::make_unique< CopyBufferToImageCommand >( copyInfo
+		m_commands.emplace< CopyBufferToImageCommand >( m_device
+			, copyInfo
 			, src
-			, dst ) );
+			, dst );
 	}
 
 	void CommandBuffer::copyToBuffer( renderer::BufferImageCopyArray const & copyInfo
 		, renderer::Texture const & src
 		, renderer::BufferBase const & dst )const
 	{
-		m_commands.emplace_back( std::make_unique< CopyImageToBufferCommand >( m_device
+		m_commands.emplace< CopyImageToBufferCommand >( m_device
 			, copyInfo
 			, src
-			, dst ) );
+			, dst );
 	}
 
 	void CommandBuffer::copyBuffer( renderer::BufferCopy const & copyInfo
 		, renderer::BufferBase const & src
 		, renderer::BufferBase const & dst )const
 	{
-		m_commands.emplace_back( std::make_unique< CopyBufferCommand >( copyInfo
+		m_commands.emplace< CopyBufferCommand >( copyInfo
 			, src
-			, dst ) );
+			, dst );
 	}
 
 	void CommandBuffer::copyImage( renderer::ImageCopy const & copyInfo
@@ -555,9 +689,10 @@ namespace gl_renderer
 		, renderer::Texture const & dst
 		, renderer::ImageLayout dstLayout )const
 	{
-		m_commands.emplace_back( std::make_unique< CopyImageCommand >( copyInfo
+		m_commands.emplace< CopyImageCommand >( m_device
+			, copyInfo
 			, src
-			, dst ) );
+			, dst );
 	}
 
 	void CommandBuffer::blitImage( renderer::Texture const & srcImage
@@ -567,45 +702,45 @@ namespace gl_renderer
 		, std::vector< renderer::ImageBlit > const & regions
 		, renderer::Filter filter )const
 	{
-		m_commands.emplace_back( std::make_unique< BlitImageCommand >( m_device
+		m_commands.emplace< BlitImageCommand >( m_device
 			, srcImage
 			, dstImage
 			, regions
-			, filter ) );
+			, filter );
 	}
 
 	void CommandBuffer::resetQueryPool( renderer::QueryPool const & pool
 		, uint32_t firstQuery
 		, uint32_t queryCount )const
 	{
-		m_commands.emplace_back( std::make_unique< ResetQueryPoolCommand >( pool
+		m_commands.emplace< ResetQueryPoolCommand >( pool
 			, firstQuery
-			, queryCount ) );
+			, queryCount );
 	}
 
 	void CommandBuffer::beginQuery( renderer::QueryPool const & pool
 		, uint32_t query
 		, renderer::QueryControlFlags flags )const
 	{
-		m_commands.emplace_back( std::make_unique< BeginQueryCommand >( pool
+		m_commands.emplace< BeginQueryCommand >( pool
 			, query
-			, flags ) );
+			, flags );
 	}
 
 	void CommandBuffer::endQuery( renderer::QueryPool const & pool
 		, uint32_t query )const
 	{
-		m_commands.emplace_back( std::make_unique< EndQueryCommand >( pool
-			, query ) );
+		m_commands.emplace< EndQueryCommand >( pool
+			, query );
 	}
 
 	void CommandBuffer::writeTimestamp( renderer::PipelineStageFlag pipelineStage
 		, renderer::QueryPool const & pool
 		, uint32_t query )const
 	{
-		m_commands.emplace_back( std::make_unique< WriteTimestampCommand >( pipelineStage
+		m_commands.emplace< WriteTimestampCommand >( pipelineStage
 			, pool
-			, query ) );
+			, query );
 	}
 
 	void CommandBuffer::pushConstants( renderer::PipelineLayout const & layout
@@ -613,8 +748,9 @@ namespace gl_renderer
 	{
 		if ( m_state.m_currentPipeline || m_state.m_currentComputePipeline )
 		{
-			m_commands.emplace_back( std::make_unique< PushConstantsCommand >( layout
-				, pcb ) );
+			doPushConstants( layout
+				, pcb
+				, false );
 		}
 		else
 		{
@@ -628,9 +764,9 @@ namespace gl_renderer
 	{
 		if ( m_device.getRenderer().getFeatures().hasComputeShaders )
 		{
-			m_commands.emplace_back( std::make_unique< DispatchCommand >( groupCountX
+			m_commands.emplace< DispatchCommand >( groupCountX
 				, groupCountY
-				, groupCountZ ) );
+				, groupCountZ );
 		}
 		else
 		{
@@ -643,8 +779,8 @@ namespace gl_renderer
 	{
 		if ( m_device.getRenderer().getFeatures().hasComputeShaders )
 		{
-			m_commands.emplace_back( std::make_unique< DispatchIndirectCommand >( buffer
-				, offset ) );
+			m_commands.emplace< DispatchIndirectCommand >( buffer
+				, offset );
 		}
 		else
 		{
@@ -654,30 +790,30 @@ namespace gl_renderer
 
 	void CommandBuffer::setLineWidth( float width )const
 	{
-		m_commands.emplace_back( std::make_unique< SetLineWidthCommand >( width ) );
+		m_commands.emplace< SetLineWidthCommand >( width );
 	}
 
 	void CommandBuffer::setDepthBias( float constantFactor
 		, float clamp
 		, float slopeFactor )const
 	{
-		m_commands.emplace_back( std::make_unique< SetDepthBiasCommand >( constantFactor
+		m_commands.emplace< SetDepthBiasCommand >( constantFactor
 			, clamp
-			, slopeFactor ) );
+			, slopeFactor );
 	}
 
 	void CommandBuffer::setEvent( renderer::Event const & event
 		, renderer::PipelineStageFlags stageMask )const
 	{
-		m_commands.emplace_back( std::make_unique< SetEventCommand >( event
-			, stageMask ) );
+		m_commands.emplace< SetEventCommand >( event
+			, stageMask );
 	}
 
 	void CommandBuffer::resetEvent( renderer::Event const & event
 		, renderer::PipelineStageFlags stageMask )const
 	{
-		m_commands.emplace_back( std::make_unique< ResetEventCommand >( event
-			, stageMask ) );
+		m_commands.emplace< ResetEventCommand >( event
+			, stageMask );
 	}
 
 	void CommandBuffer::waitEvents( renderer::EventCRefArray const & events
@@ -686,11 +822,11 @@ namespace gl_renderer
 		, renderer::BufferMemoryBarrierArray const & bufferMemoryBarriers
 		, renderer::ImageMemoryBarrierArray const & imageMemoryBarriers )const
 	{
-		m_commands.emplace_back( std::make_unique< WaitEventsCommand >( events
+		m_commands.emplace< WaitEventsCommand >( events
 			, srcStageMask
 			, dstStageMask
 			, bufferMemoryBarriers
-			, imageMemoryBarriers ) );
+			, imageMemoryBarriers );
 	}
 
 	void CommandBuffer::initialiseGeometryBuffers()const
@@ -701,6 +837,38 @@ namespace gl_renderer
 		}
 
 		m_state.m_vaos.clear();
+
+		for ( auto & commandBuffer : m_secondaryCommandBuffers )
+		{
+			commandBuffer->initialiseGeometryBuffers();
+		}
+	}
+
+	void CommandBuffer::uploadPushConstants()const
+	{
+		if ( m_pushConstants.dirty
+			&& !m_pushConstants.data.empty() )
+		{
+			if ( m_pushConstants.buffer == GL_INVALID_INDEX )
+			{
+				glLogCall( gl::GenBuffers, 1, &m_pushConstants.buffer );
+			}
+
+			glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_COPY_WRITE, m_pushConstants.buffer );
+			glLogCall( gl::BufferData
+				, GL_BUFFER_TARGET_COPY_WRITE
+				, GLsizeiptr( m_pushConstants.data.size() )
+				, m_pushConstants.data.data()
+				, GL_STATIC_DRAW );
+			glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_COPY_WRITE, 0u );
+		}
+
+		m_pushConstants.dirty = false;
+
+		for ( auto & commandBuffer : m_secondaryCommandBuffers )
+		{
+			commandBuffer->uploadPushConstants();
+		}
 	}
 
 	void CommandBuffer::doMemoryBarrier( renderer::PipelineStageFlags after
@@ -709,9 +877,9 @@ namespace gl_renderer
 	{
 		if ( m_device.getRenderer().getFeatures().hasImageTexture )
 		{
-			m_commands.emplace_back( std::make_unique< BufferMemoryBarrierCommand >( after
+			m_commands.emplace< BufferMemoryBarrierCommand >( after
 				, before
-				, transitionBarrier ) );
+				, transitionBarrier );
 		}
 	}
 
@@ -721,9 +889,9 @@ namespace gl_renderer
 	{
 		if ( m_device.getRenderer().getFeatures().hasImageTexture )
 		{
-			m_commands.emplace_back( std::make_unique< ImageMemoryBarrierCommand >( after
+			m_commands.emplace< ImageMemoryBarrierCommand >( after
 				, before
-				, transitionBarrier ) );
+				, transitionBarrier );
 		}
 	}
 
@@ -734,23 +902,257 @@ namespace gl_renderer
 		if ( !m_state.m_boundVao )
 		{
 			m_state.m_boundVao = &m_state.m_currentPipeline->createGeometryBuffers( m_state.m_boundVbos, m_state.m_boundIbo, m_state.m_indexType ).get();
+		}
+
+		// The VAO name is written on the context thread at submit, so it isn't read here:
+		// the geometry buffers are always queued, their initialisation being idempotent.
+		auto it = std::find_if( m_state.m_vaos.begin()
+			, m_state.m_vaos.end()
+			, [this]( GeometryBuffersRef const & lookup )
+			{
+				return &lookup.get() == m_state.m_boundVao;
+			} );
+
+		if ( it == m_state.m_vaos.end() )
+		{
 			m_state.m_vaos.emplace_back( *m_state.m_boundVao );
 		}
-		else if ( m_state.m_boundVao->getVao() == GL_INVALID_INDEX )
+
+		doBindGeometryBuffers( *m_state.m_boundVao );
+	}
+
+	void CommandBuffer::doBindGeometryBuffers( GeometryBuffers const & vao )const
+	{
+		if ( doCheckTrackedState() )
+		{
+			if ( m_state.m_trackedVao == &vao )
+			{
+				++m_state.m_removed.geometryBuffers;
+				return;
+			}
+
+			m_state.m_trackedVao = &vao;
+		}
+
+		m_commands.emplace< BindGeometryBuffersCommand >( vao );
+	}
+
+	void CommandBuffer::doPushConstants( renderer::PipelineLayout const & layout
+		, renderer::PushConstantsBufferBase const & pcb
+		, bool specialisation )const
+	{
+		if ( m_uniformBufferPushConstants && !specialisation )
+		{
+			doPushConstantsBlock( layout, pcb );
+			return;
+		}
+
+		if ( doCheckTrackedState()
+			&& m_state.m_trackedPipeline
+			&& pcb.begin() != pcb.end() )
 		{
-			auto it = std::find_if( m_state.m_vaos.begin()
-				, m_state.m_vaos.end()
-				, [this]( GeometryBuffersRef const & lookup )
+			// The uniforms belong to the program, so they are tracked per pipeline.
+			auto location = pcb.begin()->location;
+			auto it = std::find_if( m_state.m_trackedPushConstants.begin()
+				, m_state.m_trackedPushConstants.end()
+				, [this, location]( State::PushedConstants const & lookup )
 				{
-					return &lookup.get() == m_state.m_boundVao;
+					return lookup.pipeline == m_state.m_trackedPipeline
+						&& lookup.location == location;
 				} );
 
-			if ( it == m_state.m_vaos.end() )
+			if ( it != m_state.m_trackedPushConstants.end()
+				&& it->data.size() == pcb.getSize()
+				&& std::equal( it->data.begin(), it->data.end(), pcb.getData() ) )
+			{
+				++m_state.m_removed.pushConstants;
+				return;
+			}
+
+			if ( it == m_state.m_trackedPushConstants.end() )
 			{
-				m_state.m_vaos.emplace_back( *m_state.m_boundVao );
+				it = m_state.m_trackedPushConstants.insert( it
+					, { m_state.m_trackedPipeline, location, {} } );
 			}
+
+			it->data.assign( pcb.getData(), pcb.getData() + pcb.getSize() );
+		}
+
+		doEmplacePushConstants( layout
+			, pcb
+			, specialisation );
+	}
+
+	void CommandBuffer::doPushConstantsBlock( renderer::PipelineLayout const & layout
+		, renderer::PushConstantsBufferBase const & pcb )const
+	{
+		// All the pipelines share the binding point, so its block holds every range pushed for the current layout.
+		if ( m_state.m_pushConstantsLayout != &layout )
+		{
+			m_state.m_pushConstantsLayout = &layout;
+			m_state.m_pushConstantsRanges.clear();
+		}
+
+		auto & ranges = m_state.m_pushConstantsRanges;
+		auto it = std::lower_bound( ranges.begin()
+			, ranges.end()
+			, pcb.getOffset()
+			, []( renderer::PushConstantsBufferBase const & lookup, uint32_t offset )
+			{
+				return lookup.getOffset() < offset;
+			} );
+
+		if ( it != ranges.end()
+			&& it->getOffset() == pcb.getOffset() )
+		{
+			*it = pcb;
+		}
+		else
+		{
+			ranges.insert( it, pcb );
+		}
+
+		// The binding point is tracked, not the pipeline: the same block is skipped whatever the pipeline.
+		if ( doCheckTrackedState() )
+		{
+			if ( m_state.m_trackedPushConstantsLayout == &layout
+				&& std::equal( ranges.begin()
+					, ranges.end()
+					, m_state.m_trackedPushConstantsRanges.begin()
+					, m_state.m_trackedPushConstantsRanges.end()
+					, []( renderer::PushConstantsBufferBase const & lhs
+						, renderer::PushConstantsBufferBase const & rhs )
+					{
+						return lhs.getOffset() == rhs.getOffset()
+							&& lhs.getSize() == rhs.getSize()
+							&& std::equal( lhs.getData(), lhs.getData() + lhs.getSize(), rhs.getData() );
+					} ) )
+			{
+				++m_state.m_removed.pushConstants;
+				return;
+			}
+
+			m_state.m_trackedPushConstantsLayout = &layout;
+			m_state.m_trackedPushConstantsRanges = ranges;
+		}
+
+		m_commands.emplace< PushConstantsBufferCommand >( m_device
+			, m_pushConstants
+			, ranges );
+	}
+
+	void CommandBuffer::doEmplacePushConstants( renderer::PipelineLayout const & layout
+		, renderer::PushConstantsBufferBase const & pcb
+		, bool specialisation )const
+	{
+		if ( m_uniformBufferPushConstants && !specialisation )
+		{
+			doPushConstantsBlock( layout, pcb );
+		}
+		else
+		{
+			m_commands.emplace< PushConstantsCommand >( layout
+				, pcb );
+		}
+	}
+
+	bool CommandBuffer::doBatchDraw( renderer::DrawIndirectCommand const & draw )const
+	{
+		if ( !m_batchDraws
+			|| !MultiDrawCommand::isBatchable( draw ) )
+		{
+			return false;
+		}
+
+		auto mode = convert( m_state.m_currentPipeline->getInputAssemblyState().topology );
+
+		if ( auto * batch = m_commands.getLast< MultiDrawCommand >() )
+		{
+			if ( batch->getMode() == mode )
+			{
+				batch->addDraw( draw );
+				return true;
+			}
+		}
+		else if ( auto * previous = m_commands.getLast< DrawCommand >() )
+		{
+			auto first = previous->getIndirectCommand();
+
+			if ( previous->getMode() == mode
+				&& MultiDrawCommand::isBatchable( first ) )
+			{
+				m_commands.removeLast();
+				m_commands.emplace< MultiDrawCommand >( first
+					, draw
+					, mode );
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool CommandBuffer::doBatchDraw( renderer::DrawIndexedIndirectCommand const & draw )const
+	{
+		if ( !m_batchDraws
+			|| !MultiDrawIndexedCommand::isBatchable( draw ) )
+		{
+			return false;
+		}
+
+		auto mode = convert( m_state.m_currentPipeline->getInputAssemblyState().topology );
+		auto type = convert( m_state.m_indexType );
+
+		if ( auto * batch = m_commands.getLast< MultiDrawIndexedCommand >() )
+		{
+			if ( batch->getMode() == mode
+				&& batch->getType() == type )
+			{
+				batch->addDraw( draw );
+				return true;
+			}
+		}
+		else if ( auto * previous = m_commands.getLast< DrawIndexedCommand >() )
+		{
+			auto first = previous->getIndirectCommand();
+
+			if ( previous->getMode() == mode
+				&& previous->getType() == type
+				&& MultiDrawIndexedCommand::isBatchable( first ) )
+			{
+				m_commands.removeLast();
+				m_commands.emplace< MultiDrawIndexedCommand >( first
+					, draw
+					, mode
+					, type );
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool CommandBuffer::doCheckTrackedState()const
+	{
+		if ( !m_removeRedundant )
+		{
+			return false;
+		}
+
+		if ( m_state.m_trackedGenericCount != m_commands.getGenericCount() )
+		{
+			// Generic commands may have changed the tracked states, so everything is recorded again.
+			m_state.m_trackedGenericCount = m_commands.getGenericCount();
+			m_state.m_trackedViewport.reset();
+			m_state.m_trackedScissor.reset();
+			m_state.m_trackedPipeline = nullptr;
+			m_state.m_trackedVao = nullptr;
+			m_state.m_trackedDescriptorSets.clear();
+			m_state.m_trackedPushConstants.clear();
+			m_state.m_trackedPushConstantsLayout = nullptr;
+			m_state.m_trackedPushConstantsRanges.clear();
 		}
 
-		m_commands.emplace_back( std::make_unique< BindGeometryBuffersCommand >( *m_state.m_boundVao ) );
+		return true;
 	}
 }
@@ -4,9 +4,16 @@ See LICENSE file in root folder
 */
 #pragma once
 
-#include "Commands/GlCommandBase.hpp"
+#include "Command/GlCommandStream.hpp"
+#include "Command/Commands/GlPushConstantsBufferCommand.hpp"
 
+#include <Miscellaneous/DrawIndexedIndirectCommand.hpp>
+#include <Miscellaneous/DrawIndirectCommand.hpp>
+
+#include <Buffer/PushConstantsBuffer.hpp>
 #include <Command/CommandBuffer.hpp>
+#include <Pipeline/Scissor.hpp>
+#include <Pipeline/Viewport.hpp>
 
 namespace gl_renderer
 {
@@ -17,6 +24,21 @@ namespace gl_renderer
 	class CommandBuffer
 		: public renderer::CommandBuffer
 	{
+	public:
+		/**
+		*\brief
+		*	Compteurs des commandes redondantes qui n'ont pas été enregistrées.
+		*/
+		struct RemovedCommands
+		{
+			uint32_t viewports{ 0u };
+			uint32_t scissors{ 0u };
+			uint32_t pipelines{ 0u };
+			uint32_t descriptorSets{ 0u };
+			uint32_t geometryBuffers{ 0u };
+			uint32_t pushConstants{ 0u };
+		};
+
 	public:
 		/**
 		*\brief
@@ -31,6 +53,11 @@ namespace gl_renderer
 		CommandBuffer( Device const & device
 			, renderer::CommandPool const & pool
 			, bool primary );
+		/**
+		*\brief
+		*	Destructeur.
+		*/
+		~CommandBuffer();
 		void applyPostSubmitActions()const;
 		void generateMipmaps( Texture const & texture )const;
 		/**
@@ -254,14 +281,100 @@ namespace gl_renderer
 			, renderer::ImageMemoryBarrierArray const & imageMemoryBarriers )const override;
 		/**
 		*\return
-		*	Le tableau de commandes.
+		*	Le flux de commandes.
 		*/
-		inline CommandArray const & getCommands()const
+		inline CommandStream const & getCommands()const
 		{
 			return m_commands;
 		}
 
+		/**
+		*\brief
+		*	Active ou désactive l'élimination des commandes redondantes.
+		*\remarks
+		*	Désactivée par défaut.
+		*	Les viewports, scissors, pipelines, descriptor sets, VAO et push constants identiques
+		*	à ceux déjà enregistrés ne sont pas ajoutés au flux.
+		*	Le suivi est réinitialisé par chaque commande qui peut modifier d'autres états (CommandType::eGeneric).
+		*	Les descriptor sets sont suivis par point d'attache : comme pour le reste du backend,
+		*	les bindings de descriptor sets différents ne doivent pas se recouvrir.
+		*/
+		inline void setRedundancyElimination( bool value )const
+		{
+			m_removeRedundant = value;
+		}
+		/**
+		*\return
+		*	\p true si l'élimination des commandes redondantes est activée.
+		*/
+		inline bool hasRedundancyElimination()const
+		{
+			return m_removeRedundant;
+		}
+		/**
+		*\return
+		*	Le nombre de commandes redondantes supprimées depuis le dernier begin().
+		*/
+		inline RemovedCommands const & getRemovedCommands()const
+		{
+			return m_state.m_removed;
+		}
+
+		/**
+		*\brief
+		*	Active ou désactive l'écriture des push constants dans un tampon uniforme.
+		*\remarks
+		*	Désactivée par défaut, chaque push constant est alors une variable uniforme, mise à jour par un appel à glUniform*.
+		*	Lorsqu'elle est activée, les push constants enregistrées ensuite sont écrites au format std140
+		*	dans un tampon uniforme propre au tampon de commandes, et l'exécution se limite à un glBindBufferRange
+		*	sur le point d'attache Device::getPushConstantsBinding.
+		*	Tous les intervalles poussés pour un même pipeline layout sont regroupés dans un seul bloc, réécrit à chaque push.
+		*	Les shaders doivent alors déclarer un bloc "layout( std140 ) uniform PushConstants",
+		*	contenant les constantes de tous les intervalles du layout, dans l'ordre de leurs décalages,
+		*	et tous ces intervalles doivent être poussés avant le premier dessin.
+		*	Les constantes de spécialisation restent des variables uniformes.
+		*/
+		inline void setUniformBufferPushConstants( bool value )const
+		{
+			m_uniformBufferPushConstants = value;
+		}
+		/**
+		*\return
+		*	\p true si les push constants sont écrites dans un tampon uniforme.
+		*/
+		inline bool hasUniformBufferPushConstants()const
+		{
+			return m_uniformBufferPushConstants;
+		}
+
+		/**
+		*\brief
+		*	Active ou désactive le regroupement des dessins consécutifs.
+		*\remarks
+		*	Désactivé par défaut.
+		*	Les appels à draw, ou à drawIndexed, d'une seule instance, qui se suivent sans autre commande
+		*	entre eux partagent le pipeline, les descriptor sets, le VAO et les push constants ;
+		*	ils sont alors enregistrés en un seul glMultiDrawArrays, ou glMultiDrawElementsBaseVertex.
+		*/
+		inline void setDrawBatching( bool value )const
+		{
+			m_batchDraws = value;
+		}
+		/**
+		*\return
+		*	\p true si les dessins consécutifs sont regroupés.
+		*/
+		inline bool hasDrawBatching()const
+		{
+			return m_batchDraws;
+		}
+
 		void initialiseGeometryBuffers()const;
+		/**
+		*\brief
+		*	Crée le tampon uniforme des push constants, si elles ont été réenregistrées depuis la dernière soumission.
+		*/
+		void uploadPushConstants()const;
 
 	private:
 		/**
@@ -277,11 +390,23 @@ namespace gl_renderer
 			, renderer::PipelineStageFlags before
 			, renderer::ImageMemoryBarrier const & transitionBarrier )const override;
 		void doBindVao()const;
+		void doBindGeometryBuffers( GeometryBuffers const & vao )const;
+		void doPushConstants( renderer::PipelineLayout const & layout
+			, renderer::PushConstantsBufferBase const & pcb
+			, bool specialisation )const;
+		void doPushConstantsBlock( renderer::PipelineLayout const & layout
+			, renderer::PushConstantsBufferBase const & pcb )const;
+		void doEmplacePushConstants( renderer::PipelineLayout const & layout
+			, renderer::PushConstantsBufferBase const & pcb
+			, bool specialisation )const;
+		bool doBatchDraw( renderer::DrawIndirectCommand const & draw )const;
+		bool doBatchDraw( renderer::DrawIndexedIndirectCommand const & draw )const;
+		bool doCheckTrackedState()const;
 
 	private:
 	private:
 		Device const & m_device;
-		mutable CommandArray m_commands;
+		mutable CommandStream m_commands;
 		struct State
 		{
 			renderer::CommandBufferUsageFlags m_beginFlags{ 0u };
@@ -297,8 +422,40 @@ namespace gl_renderer
 			renderer::IndexType m_indexType;
 			GeometryBuffers * m_boundVao{ nullptr };
 			GeometryBuffersRefArray m_vaos;
+			// The push constants ranges of the uniform buffer mode, packed in one block, sorted by offset.
+			renderer::PipelineLayout const * m_pushConstantsLayout{ nullptr };
+			std::vector< renderer::PushConstantsBufferBase > m_pushConstantsRanges;
+			// Redundant commands tracking.
+			struct BoundDescriptorSet
+			{
+				DescriptorSet const * descriptorSet;
+				renderer::PipelineLayout const * layout;
+				renderer::UInt32Array dynamicOffsets;
+			};
+			struct PushedConstants
+			{
+				Pipeline const * pipeline;
+				uint32_t location;
+				renderer::ByteArray data;
+			};
+			RemovedCommands m_removed;
+			size_t m_trackedGenericCount{ 0u };
+			std::optional< renderer::Viewport > m_trackedViewport;
+			std::optional< renderer::Scissor > m_trackedScissor;
+			Pipeline const * m_trackedPipeline{ nullptr };
+			GeometryBuffers const * m_trackedVao{ nullptr };
+			std::vector< BoundDescriptorSet > m_trackedDescriptorSets;
+			std::vector< PushedConstants > m_trackedPushConstants;
+			// The block attached to the push constants binding, in uniform buffer mode.
+			renderer::PipelineLayout const * m_trackedPushConstantsLayout{ nullptr };
+			std::vector< renderer::PushConstantsBufferBase > m_trackedPushConstantsRanges;
 		};
 		mutable std::vector< std::function< void() > > m_afterSubmitActions;
+		mutable std::vector< CommandBuffer const * > m_secondaryCommandBuffers;
 		mutable State m_state;
+		mutable PushConstantsStorage m_pushConstants;
+		mutable bool m_removeRedundant{ false };
+		mutable bool m_uniformBufferPushConstants{ false };
+		mutable bool m_batchDraws{ false };
 	};
 }
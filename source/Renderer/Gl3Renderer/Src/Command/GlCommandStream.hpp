@@ -0,0 +1,173 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Commands/GlCommandBase.hpp"
+
+#include <cstddef>
+#include <new>
+
+namespace gl_renderer
+{
+	/**
+	*\brief
+	*	Flux linéaire de commandes, stockées par blocs mémoire réutilisables.
+	*\remarks
+	*	Chaque commande est construite en place dans le bloc courant, précédée d'un en-tête
+	*	donnant son type et la taille de l'enregistrement.
+	*	clear() détruit les commandes mais garde les blocs, qui sont réutilisés à l'enregistrement suivant.
+	*/
+	class CommandStream
+	{
+	private:
+		struct Header
+		{
+			CommandBase * command;
+			uint32_t size;
+			CommandType type;
+			bool destroy;
+		};
+
+		struct Chunk
+		{
+			std::unique_ptr< uint8_t[] > data;
+			size_t capacity;
+			size_t used;
+		};
+
+		static size_t constexpr Alignment = alignof( std::max_align_t );
+		static size_t constexpr HeaderSize = ( sizeof( Header ) + Alignment - 1u ) & ~( Alignment - 1u );
+		static size_t constexpr ChunkSize = 64u * 1024u;
+
+	public:
+		CommandStream( CommandStream const & ) = delete;
+		CommandStream & operator=( CommandStream const & ) = delete;
+		CommandStream() = default;
+		~CommandStream();
+		/**
+		*\brief
+		*	Construit une commande à la fin du flux.
+		*\param[in] params
+		*	Les paramètres du constructeur de la commande.
+		*\return
+		*	La commande créée.
+		*/
+		template< typename CommandT, typename ... Params >
+		CommandT & emplace( Params && ... params )
+		{
+			static_assert( std::is_base_of< CommandBase, CommandT >::value
+				, "CommandT must derive from CommandBase" );
+			static_assert( alignof( CommandT ) <= Alignment
+				, "CommandT is over-aligned" );
+			auto size = HeaderSize + ( ( sizeof( CommandT ) + Alignment - 1u ) & ~( Alignment - 1u ) );
+			auto buffer = doReserve( size );
+			auto result = new( buffer + HeaderSize )CommandT( std::forward< Params >( params )... );
+			m_last = new( buffer )Header
+			{
+				result,
+				uint32_t( size ),
+				CommandTypeGetter< CommandT >::value,
+				!std::is_trivially_destructible< CommandT >::value,
+			};
+			doCommit( size, CommandTypeGetter< CommandT >::value );
+			return *result;
+		}
+		/**
+		*\return
+		*	La dernière commande enregistrée, si elle est de type CommandT, \p nullptr sinon.
+		*/
+		template< typename CommandT >
+		CommandT * getLast()const
+		{
+			static_assert( CommandTypeGetter< CommandT >::value != CommandType::eGeneric
+				, "Only commands with a specific CommandType can be retrieved" );
+			return ( m_last && m_last->type == CommandTypeGetter< CommandT >::value )
+				? static_cast< CommandT * >( m_last->command )
+				: nullptr;
+		}
+		/**
+		*\brief
+		*	Détruit la dernière commande enregistrée, pour la remplacer.
+		*\remarks
+		*	Une seule commande peut être retirée après chaque emplace().
+		*/
+		void removeLast();
+		/**
+		*\brief
+		*	Exécute les commandes, dans l'ordre d'enregistrement.
+		*/
+		void replay()const;
+		/**
+		*\brief
+		*	Détruit les commandes, en gardant la mémoire pour un prochain enregistrement.
+		*/
+		void clear();
+		/**
+		*\brief
+		*	Détruit les commandes et libère la mémoire.
+		*/
+		void release();
+		/**
+		*\return
+		*	Le nombre de commandes enregistrées.
+		*/
+		inline size_t size()const
+		{
+			return m_count;
+		}
+		/**
+		*\return
+		*	\p true si aucune commande n'est enregistrée.
+		*/
+		inline bool empty()const
+		{
+			return m_count == 0u;
+		}
+		/**
+		*\return
+		*	Le nombre de commandes de type CommandType::eGeneric enregistrées.
+		*\remarks
+		*	Ces commandes peuvent modifier des états qui ne sont pas suivis par le tampon de commandes.
+		*/
+		inline size_t getGenericCount()const
+		{
+			return m_genericCount;
+		}
+
+	private:
+		uint8_t * doReserve( size_t size );
+		void doCommit( size_t size
+			, CommandType type );
+
+		template< typename FuncT >
+		void doForEach( FuncT function )const
+		{
+			for ( auto & chunk : m_chunks )
+			{
+				auto it = chunk.data.get();
+				auto end = it + chunk.used;
+
+				while ( it != end )
+				{
+					auto & header = *reinterpret_cast< Header const * >( it );
+					function( header );
+					it += header.size;
+				}
+
+				if ( &chunk == &m_chunks[m_current] )
+				{
+					break;
+				}
+			}
+		}
+
+	private:
+		std::vector< Chunk > m_chunks;
+		Header * m_last{ nullptr };
+		size_t m_current{ 0u };
+		size_t m_count{ 0u };
+		size_t m_genericCount{ 0u };
+	};
+}
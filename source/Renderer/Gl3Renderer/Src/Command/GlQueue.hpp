@@ -10,6 +10,14 @@ See LICENSE file in root folder.
 
 namespace gl_renderer
 {
+	/**
+	*\brief
+	*	File de soumission.
+	*\remarks
+	*	En mode de soumission asynchrone, submit ne fait qu'envoyer les tampons de commandes au thread de soumission,
+	*	qui les exécute puis signale la barrière.
+	*	Les tampons de commandes et les ressources qu'ils utilisent ne doivent pas être modifiés avant que la barrière soit signalée.
+	*/
 	class Queue
 		: public renderer::Queue
 	{
@@ -40,5 +48,12 @@ namespace gl_renderer
 		{
 			return 0u;
 		}
+
+	private:
+		static void doSubmit( renderer::CommandBufferCRefArray const & commandBuffers
+			, renderer::Fence const * fence );
+
+	private:
+		Device const & m_device;
 	};
 }
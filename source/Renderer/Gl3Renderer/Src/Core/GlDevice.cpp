@@ -14,12 +14,14 @@ See LICENSE file in root folder.
 #include "Core/GlContext.hpp"
 #include "Core/GlDummyIndexBuffer.hpp"
 #include "Core/GlRenderer.hpp"
+#include "Core/GlSubmissionThread.hpp"
 #include "Core/GlSwapChain.hpp"
 #include "Descriptor/GlDescriptorPool.hpp"
 #include "Descriptor/GlDescriptorSetLayout.hpp"
 #include "Image/GlSampler.hpp"
 #include "Image/GlTexture.hpp"
 #include "Image/GlTextureView.hpp"
+#include "Miscellaneous/GlBufferAllocator.hpp"
 #include "Miscellaneous/GlDeviceMemory.hpp"
 #include "Miscellaneous/GlQueryPool.hpp"
 #include "Pipeline/GlPipelineLayout.hpp"
@@ -327,6 +329,18 @@ namespace gl_renderer
 				glLogCall( gl::Disable, GL_PRIMITIVE_RESTART );
 			}
 		}
+
+		template< typename BindingT >
+		BindingT & getBinding( std::vector< BindingT > & bindings
+			, uint32_t index )
+		{
+			if ( index >= bindings.size() )
+			{
+				bindings.resize( index + 1u );
+			}
+
+			return bindings[index];
+		}
 	}
 
 	Device::Device( renderer::Renderer const & renderer
@@ -340,15 +354,27 @@ namespace gl_renderer
 		//glLogCall( gl::ClipControl, GL_UPPER_LEFT, GL_ZERO_TO_ONE );
 		glLogCall( gl::Enable, GL_TEXTURE_CUBE_MAP_SEAMLESS );
 		initialiseDebugFunctions();
+		GLint maxUniformBufferBindings = 0;
+		glLogCall( gl::GetIntegerv, GL_MAX_UNIFORM_BUFFER_BINDINGS, &maxUniformBufferBindings );
+		m_pushConstantsBinding = GLuint( maxUniformBufferBindings - 1 );
 		disable();
 
 		m_timestampPeriod = 1;
 		m_presentQueue = std::make_unique< Queue >( *this );
 		m_computeQueue = std::make_unique< Queue >( *this );
 		m_graphicsQueue = std::make_unique< Queue >( *this );
+		m_transferQueue = std::make_unique< Queue >( *this );
 		m_presentCommandPool = std::make_unique< CommandPool >( *this, 0u );
 		m_computeCommandPool = std::make_unique< CommandPool >( *this, 0u );
 		m_graphicsCommandPool = std::make_unique< CommandPool >( *this, 0u );
+		m_transferCommandPool = std::make_unique< CommandPool >( *this, 0u );
+
+		// Without TexBufferRange, a texel buffer would see its whole shared buffer.
+		if ( renderer.isBufferSuballocationEnabled()
+			&& renderer.getFeatures().hasTexBufferRange )
+		{
+			m_bufferAllocator = std::make_unique< BufferAllocator >( *this );
+		}
 
 		enable();
 		doApply( m_cbState );
@@ -376,23 +402,43 @@ namespace gl_renderer
 		auto & indexBuffer = static_cast< Buffer const & >( m_dummyIndexed.indexBuffer->getBuffer() );
 
 		m_dummyIndexed.geometryBuffers = std::make_unique< GeometryBuffers >( VboBindings{}
-			, BufferObjectBinding{ indexBuffer.getBuffer(), 0u, &indexBuffer }
+			, BufferObjectBinding{ indexBuffer.getBuffer(), uint64_t( indexBuffer.getOffset() ), &indexBuffer }
 			, renderer::VertexInputState{}
 			, renderer::IndexType::eUInt32 );
 		m_dummyIndexed.geometryBuffers->initialise();
 
-		gl::GenFramebuffers( 2, m_blitFbos );
+		glLogCall( gl::GenFramebuffers, 2, m_blitFbos );
 		disable();
+
+		if ( renderer.isAsynchronousSubmissionEnabled() )
+		{
+			// From now on, the context is only current on the submission thread.
+			m_submissionThread = std::make_unique< SubmissionThread >( *m_context );
+		}
 	}
 
 	Device::~Device()
 	{
+		if ( m_submissionThread )
+		{
+			if ( callerSubmissionThread == m_submissionThread.get() )
+			{
+				callerSubmissionThread = nullptr;
+			}
+
+			// Runs the pending jobs and releases the context.
+			m_submissionThread.reset();
+		}
+
 		enable();
-		gl::DeleteFramebuffers( 2, m_blitFbos );
+		glLogCall( gl::DeleteFramebuffers, 2, m_blitFbos );
 		m_dummyIndexed.geometryBuffers.reset();
 		m_dummyIndexed.indexBuffer.reset();
+		m_bufferAllocator.reset();
 		disable();
 
+		m_transferCommandPool.reset();
+		m_transferQueue.reset();
 		m_graphicsCommandPool.reset();
 		m_graphicsQueue.reset();
 		m_presentCommandPool.reset();
@@ -457,15 +503,15 @@ namespace gl_renderer
 		int alpha = 0;
 		int depth = 0;
 		int stencil = 0;
-		gl::GetTexLevelParameteriv( target, subresource.mipLevel, GL_TEXTURE_WIDTH, &w );
-		gl::GetTexLevelParameteriv( target, subresource.mipLevel, GL_TEXTURE_HEIGHT, &h );
-		gl::GetTexLevelParameteriv( target, subresource.mipLevel, GL_TEXTURE_DEPTH, &d );
-		gl::GetTexLevelParameteriv( target, subresource.mipLevel, GL_TEXTURE_RED_SIZE, &red );
-		gl::GetTexLevelParameteriv( target, subresource.mipLevel, GL_TEXTURE_GREEN_SIZE, &green );
-		gl::GetTexLevelParameteriv( target, subresource.mipLevel, GL_TEXTURE_BLUE_SIZE, &blue );
-		gl::GetTexLevelParameteriv( target, subresource.mipLevel, GL_TEXTURE_ALPHA_SIZE, &alpha );
-		gl::GetTexLevelParameteriv( target, subresource.mipLevel, GL_TEXTURE_DEPTH_SIZE, &depth );
-		gl::GetTexLevelParameteriv( target, subresource.mipLevel, GL_TEXTURE_STENCIL_SIZE, &stencil );
+		glLogCall( gl::GetTexLevelParameteriv, target, subresource.mipLevel, GL_TEXTURE_WIDTH, &w );
+		glLogCall( gl::GetTexLevelParameteriv, target, subresource.mipLevel, GL_TEXTURE_HEIGHT, &h );
+		glLogCall( gl::GetTexLevelParameteriv, target, subresource.mipLevel, GL_TEXTURE_DEPTH, &d );
+		glLogCall( gl::GetTexLevelParameteriv, target, subresource.mipLevel, GL_TEXTURE_RED_SIZE, &red );
+		glLogCall( gl::GetTexLevelParameteriv, target, subresource.mipLevel, GL_TEXTURE_GREEN_SIZE, &green );
+		glLogCall( gl::GetTexLevelParameteriv, target, subresource.mipLevel, GL_TEXTURE_BLUE_SIZE, &blue );
+		glLogCall( gl::GetTexLevelParameteriv, target, subresource.mipLevel, GL_TEXTURE_ALPHA_SIZE, &alpha );
+		glLogCall( gl::GetTexLevelParameteriv, target, subresource.mipLevel, GL_TEXTURE_DEPTH_SIZE, &depth );
+		glLogCall( gl::GetTexLevelParameteriv, target, subresource.mipLevel, GL_TEXTURE_STENCIL_SIZE, &stencil );
 		layout.rowPitch = 0u;
 		layout.arrayPitch = 0u;
 		layout.depthPitch = 0u;
@@ -474,6 +520,7 @@ namespace gl_renderer
 		glLogCall( gl::BindTexture
 			, target
 			, 0 );
+		invalidateActiveTextureUnit();
 	}
 
 	renderer::SamplerPtr Device::createSampler( renderer::SamplerCreateInfo const & createInfo )const
@@ -571,23 +618,331 @@ namespace gl_renderer
 			, pipelineStatistics );
 	}
 
+	void Device::bindTexture( uint32_t unit
+		, GLenum target
+		, GLuint name )const
+	{
+		// The binding cache is owned by the submission thread.
+		if ( callerSubmissionThread )
+		{
+			executeOnSubmissionThread( *callerSubmissionThread
+				, [&]()
+				{
+					bindTexture( unit, target, name );
+				} );
+			return;
+		}
+
+		auto & binding = getBinding( m_textureUnits, unit );
+
+		if ( binding.target != target
+			|| binding.texture != name )
+		{
+			if ( m_activeTextureUnit != unit )
+			{
+				glLogCall( gl::ActiveTexture
+					, GlTextureUnit( GL_TEXTURE0 + unit ) );
+				m_activeTextureUnit = unit;
+			}
+
+			glLogCall( gl::BindTexture
+				, target
+				, name );
+			binding.target = target;
+			binding.texture = name;
+		}
+	}
+
+	void Device::bindSampler( uint32_t unit
+		, GLuint name )const
+	{
+		// The binding cache is owned by the submission thread.
+		if ( callerSubmissionThread )
+		{
+			executeOnSubmissionThread( *callerSubmissionThread
+				, [&]()
+				{
+					bindSampler( unit, name );
+				} );
+			return;
+		}
+
+		auto & binding = getBinding( m_textureUnits, unit );
+
+		if ( binding.sampler != name )
+		{
+			glLogCall( gl::BindSampler
+				, unit
+				, name );
+			binding.sampler = name;
+		}
+	}
+
+	void Device::bindBufferRange( GlBufferTarget target
+		, uint32_t index
+		, GLuint name
+		, GLintptr offset
+		, GLsizeiptr range )const
+	{
+		assert( target == GL_BUFFER_TARGET_UNIFORM
+			|| target == GL_BUFFER_TARGET_SHADER_STORAGE );
+		auto & binding = getBinding( target == GL_BUFFER_TARGET_UNIFORM
+				? m_uniformBuffers
+				: m_storageBuffers
+			, index );
+
+		if ( binding.buffer != name
+			|| binding.offset != offset
+			|| binding.range != range )
+		{
+			glLogCall( gl::BindBufferRange
+				, target
+				, index
+				, name
+				, offset
+				, range );
+			binding.buffer = name;
+			binding.offset = offset;
+			binding.range = range;
+		}
+	}
+
+	void Device::bindImageTexture( uint32_t unit
+		, GLuint name
+		, GLint level
+		, GLboolean layered
+		, GLint layer
+		, GLenum access
+		, GLenum format )const
+	{
+		auto & binding = getBinding( m_imageUnits, unit );
+
+		if ( binding.texture != name
+			|| binding.level != level
+			|| binding.layered != layered
+			|| binding.layer != layer
+			|| binding.access != access
+			|| binding.format != format )
+		{
+			glLogCall( gl::BindImageTexture_ARB
+				, unit
+				, name
+				, level
+				, layered
+				, layer
+				, access
+				, format );
+			binding = { name, level, layered, layer, access, format };
+		}
+	}
+
+	void Device::bindTextures( uint32_t first
+		, uint32_t count
+		, GLenum const * targets
+		, GLuint const * names )const
+	{
+		for ( auto i = 0u; i < count; ++i )
+		{
+			bindTexture( first + i, targets[i], names[i] );
+		}
+	}
+
+	void Device::bindSamplers( uint32_t first
+		, uint32_t count
+		, GLuint const * names )const
+	{
+		for ( auto i = 0u; i < count; ++i )
+		{
+			bindSampler( first + i, names[i] );
+		}
+	}
+
+	void Device::bindBuffersRange( GlBufferTarget target
+		, uint32_t first
+		, uint32_t count
+		, GLuint const * names
+		, GLintptr const * offsets
+		, GLsizeiptr const * ranges )const
+	{
+		for ( auto i = 0u; i < count; ++i )
+		{
+			bindBufferRange( target, first + i, names[i], offsets[i], ranges[i] );
+		}
+	}
+
+	void Device::invalidateActiveTextureUnit()const
+	{
+		// The binding cache is owned by the submission thread.
+		if ( callerSubmissionThread )
+		{
+			executeOnSubmissionThread( *callerSubmissionThread
+				, [&]()
+				{
+					invalidateActiveTextureUnit();
+				} );
+			return;
+		}
+
+		if ( m_activeTextureUnit < m_textureUnits.size() )
+		{
+			auto & binding = m_textureUnits[m_activeTextureUnit];
+			binding.target = 0u;
+			binding.texture = GL_INVALID_INDEX;
+		}
+	}
+
+	void Device::onTextureDeleted( GLuint name )const
+	{
+		// The binding cache is owned by the submission thread.
+		if ( callerSubmissionThread )
+		{
+			executeOnSubmissionThread( *callerSubmissionThread
+				, [&]()
+				{
+					onTextureDeleted( name );
+				} );
+			return;
+		}
+
+		for ( auto & binding : m_textureUnits )
+		{
+			if ( binding.texture == name )
+			{
+				binding.target = 0u;
+				binding.texture = GL_INVALID_INDEX;
+			}
+		}
+
+		for ( auto & binding : m_imageUnits )
+		{
+			if ( binding.texture == name )
+			{
+				binding.texture = GL_INVALID_INDEX;
+			}
+		}
+	}
+
+	void Device::onSamplerDeleted( GLuint name )const
+	{
+		// The binding cache is owned by the submission thread.
+		if ( callerSubmissionThread )
+		{
+			executeOnSubmissionThread( *callerSubmissionThread
+				, [&]()
+				{
+					onSamplerDeleted( name );
+				} );
+			return;
+		}
+
+		for ( auto & binding : m_textureUnits )
+		{
+			if ( binding.sampler == name )
+			{
+				binding.sampler = GL_INVALID_INDEX;
+			}
+		}
+	}
+
+	void Device::onBufferDeleted( GLuint name )const
+	{
+		// The binding cache is owned by the submission thread.
+		if ( callerSubmissionThread )
+		{
+			executeOnSubmissionThread( *callerSubmissionThread
+				, [&]()
+				{
+					onBufferDeleted( name );
+				} );
+			return;
+		}
+
+		for ( auto & binding : m_uniformBuffers )
+		{
+			if ( binding.buffer == name )
+			{
+				binding.buffer = GL_INVALID_INDEX;
+			}
+		}
+
+		for ( auto & binding : m_storageBuffers )
+		{
+			if ( binding.buffer == name )
+			{
+				binding.buffer = GL_INVALID_INDEX;
+			}
+		}
+	}
+
 	void Device::waitIdle()const
 	{
 		glLogCall( gl::Finish );
 	}
 
+	void Device::doFillMemoryStatistics( renderer::MemoryStatistics & statistics )const
+	{
+		renderer::Device::doFillMemoryStatistics( statistics );
+
+		// Les tampons sous-alloués sont tous dans le seul type de mémoire.
+		if ( m_bufferAllocator
+			&& !statistics.types.empty() )
+		{
+			m_bufferAllocator->fillStatistics( statistics.types[0] );
+		}
+	}
+
+	void Device::setCallTracing( bool enable )const
+	{
+		CallTracer::setEnabled( enable );
+	}
+
+	void Device::flushCallTrace( std::string const & fileName )const
+	{
+		// Waits for the submission thread, so that its calls are part of the trace.
+		if ( m_submissionThread )
+		{
+			m_submissionThread->waitIdle();
+		}
+
+		CallTracer::flush( fileName );
+	}
+
 	void Device::swapBuffers()const
 	{
-		m_context->swapBuffers();
+		if ( m_submissionThread )
+		{
+			m_submissionThread->post( [this]()
+				{
+					m_context->swapBuffers();
+				} );
+		}
+		else
+		{
+			m_context->swapBuffers();
+		}
 	}
 
 	void Device::doEnable()const
 	{
-		m_context->setCurrent();
+		if ( m_submissionThread )
+		{
+			callerSubmissionThread = m_submissionThread.get();
+		}
+		else
+		{
+			m_context->setCurrent();
+		}
 	}
 
 	void Device::doDisable()const
 	{
-		m_context->endCurrent();
+		if ( m_submissionThread )
+		{
+			callerSubmissionThread = nullptr;
+		}
+		else
+		{
+			m_context->endCurrent();
+		}
 	}
 }
@@ -326,6 +326,8 @@ namespace gl_renderer
 		m_features.hasClearTexImage = false;
 		m_features.hasComputeShaders = false;
 		m_features.hasStorageBuffers = false;
+		m_features.hasPersistentMapping = false;
+		m_features.hasMemoryAliasing = false;
 	}
 
 	renderer::DevicePtr Renderer::createDevice( renderer::ConnectionPtr && connection )const
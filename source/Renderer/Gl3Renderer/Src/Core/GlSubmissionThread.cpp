@@ -0,0 +1,124 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Core/GlSubmissionThread.hpp"
+
+#include "Core/GlContext.hpp"
+
+#include <future>
+
+namespace gl_renderer
+{
+	thread_local SubmissionThread * callerSubmissionThread = nullptr;
+
+	void executeOnSubmissionThread( SubmissionThread & thread
+		, std::function< void() > const & job )
+	{
+		thread.execute( job );
+	}
+
+	SubmissionThread::SubmissionThread( Context const & context )
+		: m_context{ context }
+		, m_thread{ [this]()
+			{
+				doRun();
+			} }
+	{
+	}
+
+	SubmissionThread::~SubmissionThread()
+	{
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			m_stopped = true;
+		}
+
+		m_jobAvailable.notify_one();
+		m_thread.join();
+	}
+
+	void SubmissionThread::post( Job job )
+	{
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			m_jobs.emplace_back( std::move( job ) );
+		}
+
+		m_jobAvailable.notify_one();
+	}
+
+	void SubmissionThread::execute( Job const & job )
+	{
+		if ( isCurrentThread() )
+		{
+			job();
+			return;
+		}
+
+		std::promise< void > promise;
+		auto future = promise.get_future();
+		post( [&job, &promise]()
+			{
+				try
+				{
+					job();
+					promise.set_value();
+				}
+				catch ( ... )
+				{
+					promise.set_exception( std::current_exception() );
+				}
+			} );
+		future.get();
+	}
+
+	void SubmissionThread::waitIdle()
+	{
+		execute( []()
+			{
+			} );
+	}
+
+	void SubmissionThread::doRun()
+	{
+		m_context.setCurrent();
+
+		while ( true )
+		{
+			Job job;
+
+			{
+				std::unique_lock< std::mutex > lock{ m_mutex };
+				m_jobAvailable.wait( lock, [this]()
+					{
+						return m_stopped || !m_jobs.empty();
+					} );
+
+				// Remaining jobs are run before stopping.
+				if ( m_jobs.empty() )
+				{
+					break;
+				}
+
+				job = std::move( m_jobs.front() );
+				m_jobs.pop_front();
+			}
+
+			try
+			{
+				job();
+			}
+			catch ( std::exception & exc )
+			{
+				renderer::Logger::logError( std::string{ "Submission thread: " } + exc.what() );
+			}
+			catch ( ... )
+			{
+				renderer::Logger::logError( "Submission thread: Unknown error" );
+			}
+		}
+
+		m_context.endCurrent();
+	}
+}
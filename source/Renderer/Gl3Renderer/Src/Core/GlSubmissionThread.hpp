@@ -0,0 +1,82 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "GlRendererPrerequisites.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace gl_renderer
+{
+	/**
+	*\brief
+	*	Thread possédant le contexte OpenGL, en mode de soumission asynchrone.
+	*\remarks
+	*	Les tâches sont exécutées dans l'ordre de leur envoi.
+	*	Queue::submit y envoie les tampons de commandes sans attendre leur exécution,
+	*	les autres appels OpenGL des threads où le Device est activé y sont exécutés de manière synchrone.
+	*/
+	class SubmissionThread
+	{
+	public:
+		using Job = std::function< void() >;
+
+	public:
+		/**
+		*\brief
+		*	Constructeur, démarre le thread et y active le contexte.
+		*\param[in] context
+		*	Le contexte, qui ne doit être actif sur aucun autre thread.
+		*/
+		explicit SubmissionThread( Context const & context );
+		/**
+		*\brief
+		*	Destructeur, exécute les tâches restantes, puis désactive le contexte et arrête le thread.
+		*/
+		~SubmissionThread();
+		/**
+		*\brief
+		*	Envoie une tâche au thread, sans attendre son exécution.
+		*\remarks
+		*	Les exceptions levées par la tâche sont journalisées.
+		*/
+		void post( Job job );
+		/**
+		*\brief
+		*	Exécute une tâche sur le thread, et attend la fin de son exécution.
+		*\remarks
+		*	Les exceptions levées par la tâche sont relancées sur le thread appelant.
+		*	Appelée depuis le thread de soumission, la tâche est exécutée directement.
+		*/
+		void execute( Job const & job );
+		/**
+		*\brief
+		*	Attend que toutes les tâches envoyées aient été exécutées.
+		*/
+		void waitIdle();
+		/**
+		*\return
+		*	\p true si le thread appelant est le thread de soumission.
+		*/
+		inline bool isCurrentThread()const
+		{
+			return std::this_thread::get_id() == m_thread.get_id();
+		}
+
+	private:
+		void doRun();
+
+	private:
+		Context const & m_context;
+		std::mutex m_mutex;
+		std::condition_variable m_jobAvailable;
+		std::deque< Job > m_jobs;
+		bool m_stopped{ false };
+		std::thread m_thread;
+	};
+}
@@ -7,9 +7,10 @@ namespace gl_renderer
 	Sampler::Sampler( renderer::Device const & device
 		, renderer::SamplerCreateInfo const & createInfo )
 		: renderer::Sampler{ device, createInfo }
+		, m_device{ static_cast< Device const & >( device ) }
 	{
 		glLogCall( gl::GenSamplers, 1, &m_sampler );
-		glLogCall( gl::BindSampler, 0u, m_sampler );
+		m_device.bindSampler( 0u, m_sampler );
 		glLogCall( gl::SamplerParameteri, m_sampler, GL_SAMPLER_PARAMETER_MIN_FILTER, convert( createInfo.minFilter, createInfo.mipmapMode, createInfo.minLod, createInfo.maxLod ) );
 		glLogCall( gl::SamplerParameteri, m_sampler, GL_SAMPLER_PARAMETER_MAG_FILTER, convert( createInfo.magFilter ) );
 		glLogCall( gl::SamplerParameteri, m_sampler, GL_SAMPLER_PARAMETER_WRAP_S, convert( createInfo.addressModeU ) );
@@ -72,6 +73,7 @@ namespace gl_renderer
 
 	Sampler::~Sampler()
 	{
+		m_device.onSamplerDeleted( m_sampler );
 		glLogCall( gl::DeleteSamplers, 1, &m_sampler );
 	}
 }
@@ -35,6 +35,7 @@ namespace gl_renderer
 		}
 
 	private:
+		Device const & m_device;
 		//! L'échantillonneur.
 		GLuint m_sampler;
 	};
@@ -93,7 +93,8 @@ namespace gl_renderer
 			, format
 			, { dimensions.width, dimensions.height, 1u }
 			, 1u
-			, 1u }
+			, 1u
+			, renderer::ImageUsageFlag::eColourAttachment }
 		, m_device{ device }
 		, m_createInfo{ 
 			0u,
@@ -117,7 +118,8 @@ namespace gl_renderer
 			, createInfo.format
 			, createInfo.extent
 			, createInfo.mipLevels
-			, createInfo.arrayLayers }
+			, createInfo.arrayLayers
+			, createInfo.usage }
 		, m_device{ device }
 		, m_target{ convert( createInfo.imageType, createInfo.arrayLayers, createInfo.flags, createInfo.samples ) }
 		, m_createInfo{ createInfo }
@@ -128,6 +130,7 @@ namespace gl_renderer
 	Texture::~Texture()
 	{
 		m_storage.reset();
+		m_device.onTextureDeleted( m_texture );
 		glLogCall( gl::DeleteTextures, 1, &m_texture );
 	}
 
@@ -164,6 +167,7 @@ namespace gl_renderer
 
 	void Texture::doBindMemory()
 	{
+		assert( m_storageOffset == 0u && "OpenGL textures can't share their memory" );
 		static_cast< DeviceMemory & >( *m_storage ).bindToImage( *this, m_target, m_createInfo );
 	}
 }
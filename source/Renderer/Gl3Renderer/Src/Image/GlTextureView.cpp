@@ -93,6 +93,7 @@ namespace gl_renderer
 		}
 
 		glLogCall( gl::BindTexture, target, 0u );
+		m_device.invalidateActiveTextureUnit();
 	}
 
 	TextureView::~TextureView()
@@ -0,0 +1,122 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "GlRendererPrerequisites.hpp"
+
+#include <Miscellaneous/MemoryStatistics.hpp>
+
+#include <mutex>
+
+namespace gl_renderer
+{
+	struct BufferPage;
+	/**
+	*\brief
+	*	Un intervalle d'un tampon partagé.
+	*/
+	struct BufferAllocation
+	{
+		//! La page contenant l'intervalle.
+		BufferPage * page{ nullptr };
+		//! Le nom du tampon OpenGL de la page.
+		GLuint name{ GL_INVALID_INDEX };
+		//! Le décalage de l'intervalle dans le tampon.
+		GLintptr offset{ 0 };
+		//! La taille de l'intervalle.
+		GLsizeiptr size{ 0 };
+	};
+	/**
+	*\brief
+	*	Allocateur découpant les petits tampons dans quelques grands tampons OpenGL (les pages).
+	*\remarks
+	*	Une page ne contient que des tampons ayant les mêmes propriétés mémoire.
+	*	Les intervalles libres d'une page sont fusionnés avec leurs voisins lors de leur libération.
+	*	Une page est mappée en entier, une seule fois pour tous ses tampons verrouillés.
+	*/
+	class BufferAllocator
+	{
+	public:
+		//! La taille d'une page.
+		static GLsizeiptr constexpr PageSize = 4 * 1024 * 1024;
+		//! La taille maximale d'un tampon sous-alloué.
+		static GLsizeiptr constexpr MaxAllocationSize = 256 * 1024;
+		//! L'alignement des intervalles : la valeur maximale permise pour GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT,
+		//! GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT et GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT.
+		static GLsizeiptr constexpr Alignment = 256;
+
+	public:
+		/**
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*/
+		explicit BufferAllocator( Device const & device );
+		/**
+		*\brief
+		*	Destructeur, détruit toutes les pages.
+		*\remarks
+		*	Le contexte doit être actif.
+		*/
+		~BufferAllocator();
+		/**
+		*\return
+		*	\p true si un tampon de cette taille peut être sous-alloué.
+		*/
+		static inline bool isSuballocable( uint64_t size )
+		{
+			return size <= uint64_t( MaxAllocationSize );
+		}
+		/**
+		*\brief
+		*	Alloue un intervalle dans une page ayant les propriétés mémoire données.
+		*/
+		BufferAllocation allocate( GLsizeiptr size
+			, renderer::MemoryPropertyFlags flags );
+		/**
+		*\brief
+		*	Libère un intervalle.
+		*/
+		void deallocate( BufferAllocation const & allocation );
+		/**
+		*\brief
+		*	Mappe la page d'un intervalle, si elle ne l'est pas encore.
+		*\return
+		*	Le pointeur sur le début de l'intervalle.
+		*/
+		uint8_t * map( BufferAllocation const & allocation );
+		/**
+		*\brief
+		*	Met à jour une partie d'un intervalle mappé.
+		*/
+		void flush( BufferAllocation const & allocation
+			, GLintptr offset
+			, GLsizeiptr size );
+		/**
+		*\brief
+		*	Unmappe la page d'un intervalle, lorsque plus aucun de ses intervalles n'est mappé.
+		*/
+		void unmap( BufferAllocation const & allocation );
+		/**
+		*\brief
+		*	Remplace, dans les statistiques d'un type de mémoire, les tampons sous-alloués par les pages.
+		*\param[in,out] usage
+		*	Les statistiques, où chaque objet DeviceMemory compte pour une allocation.
+		*/
+		void fillStatistics( renderer::MemoryUsageStatistics & usage )const;
+
+	private:
+		BufferPage * doCreatePage( renderer::MemoryPropertyFlags flags );
+		void doDestroyPage( BufferPage const & page );
+
+	private:
+		Device const & m_device;
+		std::vector< std::unique_ptr< BufferPage > > m_pages;
+		uint32_t m_allocationCount{ 0u };
+		uint64_t m_allocatedSize{ 0u };
+		mutable std::mutex m_mutex;
+	};
+}
@@ -0,0 +1,163 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace gl_renderer
+{
+	/**
+	*\brief
+	*	Enregistrement binaire d'un appel OpenGL.
+	*/
+	struct CallRecord
+	{
+		static uint32_t constexpr MaxArgs = 12u;
+
+		enum class ArgType
+			: uint8_t
+		{
+			eInteger,
+			eFloat,
+			ePointer,
+		};
+
+		//! Le nom de la fonction, littéral dont l'adresse sert d'identifiant.
+		char const * name;
+		//! Le début de l'appel, en nanosecondes depuis le début de la trace.
+		int64_t begin;
+		//! La durée de l'appel, en nanosecondes.
+		int64_t duration;
+		uint64_t args[MaxArgs];
+		ArgType types[MaxArgs];
+		uint8_t argCount;
+	};
+	/**
+	*\brief
+	*	Traceur des appels OpenGL, activable à l'exécution.
+	*\remarks
+	*	Chaque thread écrit ses appels dans son propre tampon circulaire, sans formatage.
+	*	Le vidage écrit un fichier JSON au format Chrome trace (lisible par chrome://tracing et Perfetto),
+	*	et journalise le nombre d'appels et le temps total de chaque fonction.
+	*	Désactivé, le coût par appel se limite à la lecture d'un booléen atomique.
+	*/
+	class CallTracer
+	{
+	public:
+		using Clock = std::chrono::high_resolution_clock;
+		//! Le nombre d'appels conservés par thread.
+		static size_t constexpr RingSize = 16384u;
+
+	public:
+		/**
+		*\brief
+		*	Active ou désactive la trace.
+		*\remarks
+		*	L'activation vide les enregistrements précédents.
+		*/
+		static void setEnabled( bool enable );
+		/**
+		*\brief
+		*	Ecrit les appels enregistrés dans le fichier donné, au format Chrome trace, puis les vide.
+		*/
+		static void flush( std::string const & fileName );
+		/**
+		*\brief
+		*	Ajoute un enregistrement au tampon du thread appelant.
+		*/
+		static void record( CallRecord const & record );
+
+		static inline bool isEnabled()
+		{
+			return stEnabled.load( std::memory_order_relaxed );
+		}
+
+		static inline int64_t getTime( Clock::time_point time )
+		{
+			return std::chrono::duration_cast< std::chrono::nanoseconds >( time - stStart ).count();
+		}
+
+	private:
+		static std::atomic< bool > stEnabled;
+		static Clock::time_point stStart;
+	};
+
+	template< typename T, typename Enable = void >
+	struct TraceArgPacker
+	{
+		static inline void pack( T const & value
+			, uint64_t & arg
+			, CallRecord::ArgType & type )
+		{
+			arg = 0u;
+			type = CallRecord::ArgType::eInteger;
+		}
+	};
+
+	template< typename T >
+	struct TraceArgPacker< T, std::enable_if_t< std::is_integral< T >::value || std::is_enum< T >::value > >
+	{
+		static inline void pack( T const & value
+			, uint64_t & arg
+			, CallRecord::ArgType & type )
+		{
+			arg = uint64_t( value );
+			type = CallRecord::ArgType::eInteger;
+		}
+	};
+
+	template< typename T >
+	struct TraceArgPacker< T, std::enable_if_t< std::is_floating_point< T >::value > >
+	{
+		static inline void pack( T const & value
+			, uint64_t & arg
+			, CallRecord::ArgType & type )
+		{
+			double converted = double( value );
+			std::memcpy( &arg, &converted, sizeof( arg ) );
+			type = CallRecord::ArgType::eFloat;
+		}
+	};
+
+	template< typename T >
+	struct TraceArgPacker< T, std::enable_if_t< std::is_pointer< T >::value > >
+	{
+		static inline void pack( T const & value
+			, uint64_t & arg
+			, CallRecord::ArgType & type )
+		{
+			arg = uint64_t( reinterpret_cast< uintptr_t >( value ) );
+			type = CallRecord::ArgType::ePointer;
+		}
+	};
+
+	template<>
+	struct TraceArgPacker< std::nullptr_t >
+	{
+		static inline void pack( std::nullptr_t
+			, uint64_t & arg
+			, CallRecord::ArgType & type )
+		{
+			arg = 0u;
+			type = CallRecord::ArgType::ePointer;
+		}
+	};
+
+	template< typename ... ParamsT >
+	inline void packTraceArgs( CallRecord & record
+		, ParamsT const & ... params )
+	{
+		uint8_t index = 0u;
+		( ( index < CallRecord::MaxArgs
+			? ( TraceArgPacker< ParamsT >::pack( params, record.args[index], record.types[index] ), ++index )
+			: index ), ... );
+		record.argCount = index;
+	}
+}
@@ -144,7 +144,7 @@ namespace gl_renderer
 			{
 				if ( m_pbo != GL_INVALID_INDEX )
 				{
-					gl::DeleteBuffers( 1u, &m_pbo );
+					glLogCall( gl::DeleteBuffers, 1u, &m_pbo );
 				}
 			}
 
@@ -509,8 +509,16 @@ namespace gl_renderer
 			{
 				assert( checkFlag( m_flags, renderer::MemoryPropertyFlag::eHostVisible ) && "Unsupported action on a device local buffer" );
 				assertDebugValue( m_isLocked, false );
+				auto mapFlags = m_mapFlags;
+
+				if ( checkFlag( flags, renderer::MemoryMapFlag::eUnsynchronised ) )
+				{
+					mapFlags |= GL_MEMORY_MAP_UNSYNCHRONIZED_BIT;
+				}
+
 				glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_COPY_WRITE, m_boundResource );
-				auto result = glLogCall( gl::MapBufferRange, GL_BUFFER_TARGET_COPY_WRITE, offset, size, m_mapFlags );
+				auto result = glLogCall( gl::MapBufferRange, GL_BUFFER_TARGET_COPY_WRITE, offset, size, mapFlags );
+				m_lockOffset = offset;
 				setDebugValue( m_isLocked, result != nullptr );
 				return reinterpret_cast< uint8_t * >( result );
 			}
@@ -520,7 +528,9 @@ namespace gl_renderer
 			{
 				assert( checkFlag( m_flags, renderer::MemoryPropertyFlag::eHostVisible ) && "Unsupported action on a device local buffer" );
 				assertDebugValue( m_isLocked, true );
-				glLogCall( gl::FlushMappedBufferRange, GL_BUFFER_TARGET_COPY_WRITE, offset, size );
+				// The flushed range is relative to the mapped range.
+				assert( offset >= m_lockOffset );
+				glLogCall( gl::FlushMappedBufferRange, GL_BUFFER_TARGET_COPY_WRITE, offset - m_lockOffset, size );
 			}
 
 			void invalidate( uint32_t offset
@@ -541,6 +551,71 @@ namespace gl_renderer
 
 		private:
 			mutable GLenum m_copyTarget;
+			mutable uint32_t m_lockOffset{ 0u };
+		};
+
+		//************************************************************************************************
+
+		class SubBufferMemory
+			: public DeviceMemory::DeviceMemoryImpl
+		{
+		public:
+			SubBufferMemory( renderer::MemoryRequirements const & requirements
+				, renderer::MemoryPropertyFlags flags
+				, BufferAllocator & allocator
+				, BufferAllocation const & allocation
+				, GLuint boundTarget )
+				: DeviceMemory::DeviceMemoryImpl{ requirements, flags, allocation.name, boundTarget }
+				, m_allocator{ allocator }
+				, m_allocation{ allocation }
+			{
+			}
+
+			~SubBufferMemory()
+			{
+				m_allocator.deallocate( m_allocation );
+			}
+
+			uint8_t * lock( uint32_t offset
+				, uint32_t size
+				, renderer::MemoryMapFlags flags )const override
+			{
+				assert( checkFlag( m_flags, renderer::MemoryPropertyFlag::eHostVisible ) && "Unsupported action on a device local buffer" );
+				assertDebugValue( m_isLocked, false );
+				auto result = m_allocator.map( m_allocation );
+				setDebugValue( m_isLocked, result != nullptr );
+				return result
+					? result + offset
+					: nullptr;
+			}
+
+			void flush( uint32_t offset
+				, uint32_t size )const override
+			{
+				assert( checkFlag( m_flags, renderer::MemoryPropertyFlag::eHostVisible ) && "Unsupported action on a device local buffer" );
+				assertDebugValue( m_isLocked, true );
+				m_allocator.flush( m_allocation, offset, size );
+			}
+
+			void invalidate( uint32_t offset
+				, uint32_t size )const override
+			{
+				assert( checkFlag( m_flags, renderer::MemoryPropertyFlag::eHostVisible ) && "Unsupported action on a device local buffer" );
+				assertDebugValue( m_isLocked, true );
+				// The page is shared, its content must not be discarded; the mapping itself is synchronised.
+			}
+
+			void unlock()const override
+			{
+				assert( checkFlag( m_flags, renderer::MemoryPropertyFlag::eHostVisible ) && "Unsupported action on a device local buffer" );
+				assertDebugValue( m_isLocked, true );
+				m_allocator.unmap( m_allocation );
+				setDebugValue( m_isLocked, false );
+			}
+
+		private:
+			BufferAllocator & m_allocator;
+			BufferAllocation m_allocation;
 		};
 	}
 
@@ -567,7 +642,7 @@ namespace gl_renderer
 	DeviceMemory::DeviceMemory( Device const & device
 		, renderer::MemoryRequirements const & requirements
 		, renderer::MemoryPropertyFlags flags )
-		: renderer::DeviceMemory{ device, flags }
+		: renderer::DeviceMemory{ device, requirements, flags }
 		, m_device{ device }
 		, m_requirements{ requirements }
 	{
@@ -580,7 +655,18 @@ namespace gl_renderer
 	void DeviceMemory::bindToBuffer( GLuint resource, GLenum target )
 	{
 		assert( !m_impl && "Memory object was already bound to a resource object" );
-		m_impl = std::make_unique< BufferMemory >( m_requirements, m_flags, resource, target );
+		auto allocator = m_device.getBufferAllocator();
+
+		if ( allocator
+			&& BufferAllocator::isSuballocable( m_requirements.size ) )
+		{
+			m_allocation = allocator->allocate( GLsizeiptr( m_requirements.size ), m_flags );
+			m_impl = std::make_unique< SubBufferMemory >( m_requirements, m_flags, *allocator, m_allocation, target );
+		}
+		else
+		{
+			m_impl = std::make_unique< BufferMemory >( m_requirements, m_flags, resource, target );
+		}
 	}
 
 	void DeviceMemory::bindToImage( Texture const & texture
@@ -589,6 +675,7 @@ namespace gl_renderer
 	{
 		assert( !m_impl && "Memory object was already bound to a resource object" );
 		m_impl = std::make_unique< ImageMemory >( m_requirements, m_flags, texture, target, createInfo );
+		m_device.invalidateActiveTextureUnit();
 	}
 
 	uint8_t * DeviceMemory::lock( uint32_t offset
@@ -617,6 +704,7 @@ namespace gl_renderer
 	{
 		assert( m_impl && "Memory object was not bound to a resource object" );
 		m_impl->unlock();
+		m_device.invalidateActiveTextureUnit();
 	}
 
 	//************************************************************************************************
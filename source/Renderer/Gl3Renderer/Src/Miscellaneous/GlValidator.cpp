@@ -466,9 +466,9 @@ namespace gl_renderer
 			, FuncType function )
 		{
 			int count = 0;
-			gl::GetProgramInterfaceiv( program, interface, GLSL_DATANAME_MAX_NAME_LENGTH, &count );
+			glLogCall( gl::GetProgramInterfaceiv, program, interface, GLSL_DATANAME_MAX_NAME_LENGTH, &count );
 			std::vector< char > buffer( count );
-			gl::GetProgramInterfaceiv( program, interface, GLSL_DATANAME_ACTIVE_RESOURCES, &count );
+			glLogCall( gl::GetProgramInterfaceiv, program, interface, GLSL_DATANAME_ACTIVE_RESOURCES, &count );
 			std::vector< GLint > values;
 			values.resize( properties.size() );
 			std::vector< GLenum > props;
@@ -481,9 +481,9 @@ namespace gl_renderer
 			for ( int i = 0; i < count; ++i )
 			{
 				GLsizei length;
-				gl::GetProgramResourceName( program, interface, i, uint32_t( buffer.size() ), &length, buffer.data() );
+				glLogCall( gl::GetProgramResourceName, program, interface, i, uint32_t( buffer.size() ), &length, buffer.data() );
 				std::string name( buffer.data(), length );
-				gl::GetProgramResourceiv( program
+				glLogCall( gl::GetProgramResourceiv, program
 					, interface
 					, i
 					, GLsizei( props.size() )
@@ -503,10 +503,10 @@ namespace gl_renderer
 			, VarFuncType variableFunction )
 		{
 			GLint maxNameLength = 0;
-			gl::GetProgramInterfaceiv( program, bufferInterface, GLSL_DATANAME_MAX_NAME_LENGTH, &maxNameLength );
+			glLogCall( gl::GetProgramInterfaceiv, program, bufferInterface, GLSL_DATANAME_MAX_NAME_LENGTH, &maxNameLength );
 			std::vector< char > buffer( maxNameLength );
 			GLint numBlocks;
-			gl::GetProgramInterfaceiv( program, bufferInterface, GLSL_DATANAME_ACTIVE_RESOURCES, &numBlocks );
+			glLogCall( gl::GetProgramInterfaceiv, program, bufferInterface, GLSL_DATANAME_ACTIVE_RESOURCES, &numBlocks );
 			GLenum const blockBinding[1] = { GLSL_PROPERTY_BUFFER_BINDING };
 			GLenum const activeUniformsCount[1] = { GLSL_PROPERTY_NUM_ACTIVE_VARIABLES };
 			GLenum const activeUniforms[1] = { GLSL_PROPERTY_ACTIVE_VARIABLES };
@@ -515,26 +515,26 @@ namespace gl_renderer
 			for ( int blockIx = 0; blockIx < numBlocks; ++blockIx )
 			{
 				GLsizei nameLength = 0;
-				gl::GetProgramResourceName( program, bufferInterface, blockIx, uint32_t( buffer.size() ), &nameLength, buffer.data() );
+				glLogCall( gl::GetProgramResourceName, program, bufferInterface, blockIx, uint32_t( buffer.size() ), &nameLength, buffer.data() );
 				std::string bufferName( buffer.data(), nameLength );
 				GLint binding = 0;
-				gl::GetProgramResourceiv( program, bufferInterface, blockIx, 1, blockBinding, 1, nullptr, &binding );
-				GLuint index = gl::GetProgramResourceIndex( program, bufferInterface, bufferName.c_str() );
+				glLogCall( gl::GetProgramResourceiv, program, bufferInterface, blockIx, 1, blockBinding, 1, nullptr, &binding );
+				GLuint index = glLogCall( gl::GetProgramResourceIndex, program, bufferInterface, bufferName.c_str() );
 				GLint numActiveUnifs = 0;
-				gl::GetProgramResourceiv( program, bufferInterface, blockIx, 1, activeUniformsCount, 1, nullptr, &numActiveUnifs );
+				glLogCall( gl::GetProgramResourceiv, program, bufferInterface, blockIx, 1, activeUniformsCount, 1, nullptr, &numActiveUnifs );
 				bufferFunction( bufferName, binding, index, numActiveUnifs );
 
 				if ( numActiveUnifs )
 				{
 					std::vector< GLint > blockUnifs( numActiveUnifs );
-					gl::GetProgramResourceiv( program, bufferInterface, blockIx, 1, activeUniforms, numActiveUnifs, nullptr, blockUnifs.data() );
+					glLogCall( gl::GetProgramResourceiv, program, bufferInterface, blockIx, 1, activeUniforms, numActiveUnifs, nullptr, blockUnifs.data() );
 
 					for ( GLint unifIx = 0; unifIx < numActiveUnifs; ++unifIx )
 					{
 						GLint values[3];
-						gl::GetProgramResourceiv( program, variableInterface, blockUnifs[unifIx], 3, uniformProperties, 3, nullptr, values );
+						glLogCall( gl::GetProgramResourceiv, program, variableInterface, blockUnifs[unifIx], 3, uniformProperties, 3, nullptr, values );
 						std::vector< char > nameData( values[0] );
-						gl::GetProgramResourceName( program, variableInterface, blockUnifs[unifIx], GLsizei( nameData.size() ), nullptr, &nameData[0] );
+						glLogCall( gl::GetProgramResourceName, program, variableInterface, blockUnifs[unifIx], GLsizei( nameData.size() ), nullptr, &nameData[0] );
 						std::string variableName( nameData.begin(), nameData.end() - 1 );
 						variableFunction( variableName, GlslAttributeType( values[1] ), values[2] );
 					}
@@ -549,14 +549,14 @@ namespace gl_renderer
 			, FuncType function )
 		{
 			int count = 0;
-			gl::GetProgramInterfaceiv( program, interface, GLSL_DATANAME_ACTIVE_RESOURCES, &count );
+			glLogCall( gl::GetProgramInterfaceiv, program, interface, GLSL_DATANAME_ACTIVE_RESOURCES, &count );
 			std::vector< int > values( count );
 			std::vector< int > lengths( count );
 
 			for ( int i = 0; i < count; ++i )
 			{
 				GLenum prop = property;
-				gl::GetProgramResourceiv( program, interface, i, 1, &prop, 1, &lengths[i], &values[i] );
+				glLogCall( gl::GetProgramResourceiv, program, interface, i, 1, &prop, 1, &lengths[i], &values[i] );
 			}
 
 			if ( count )
@@ -770,19 +770,19 @@ namespace gl_renderer
 		void doValidateUniforms( GLuint program )
 		{
 			GLint numUniforms = 0;
-			gl::GetProgramInterfaceiv( program, GLSL_INTERFACE_UNIFORM, GLSL_DATANAME_ACTIVE_RESOURCES, &numUniforms );
+			glLogCall( gl::GetProgramInterfaceiv, program, GLSL_INTERFACE_UNIFORM, GLSL_DATANAME_ACTIVE_RESOURCES, &numUniforms );
 			const GLenum properties[4] = { GLSL_PROPERTY_BLOCK_INDEX, GLSL_PROPERTY_TYPE, GLSL_PROPERTY_NAME_LENGTH, GLSL_PROPERTY_LOCATION };
 
 			for ( int unif = 0; unif < numUniforms; ++unif )
 			{
 				GLint values[4];
-				gl::GetProgramResourceiv( program, GLSL_INTERFACE_UNIFORM, unif, 4, properties, 4, nullptr, values );
+				glLogCall( gl::GetProgramResourceiv, program, GLSL_INTERFACE_UNIFORM, unif, 4, properties, 4, nullptr, values );
 
 				// Skip any uniforms that are in a block.
 				if ( values[0] == -1 )
 				{
 					std::vector< char > nameData( values[2] );
-					gl::GetProgramResourceName( program, GLSL_INTERFACE_UNIFORM, unif, GLsizei( nameData.size() ), nullptr, &nameData[0] );
+					glLogCall( gl::GetProgramResourceName, program, GLSL_INTERFACE_UNIFORM, unif, GLsizei( nameData.size() ), nullptr, &nameData[0] );
 					std::string name( nameData.begin(), nameData.end() - 1 );
 					renderer::Logger::logDebug( std::stringstream{} << "   Uniform variable: " << name
 						<< ", type: " << getName( GlslAttributeType( values[1] ) )
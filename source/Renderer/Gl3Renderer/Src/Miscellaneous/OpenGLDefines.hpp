@@ -236,6 +236,7 @@ namespace gl_renderer
 	using PFN_glGetQueryObjectuiv = void ( GLAPIENTRY * )( GLuint id, GLenum pname, GLuint * params );
 	using PFN_glGetShaderInfoLog = void ( GLAPIENTRY * )( GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog );
 	using PFN_glGetShaderiv = void ( GLAPIENTRY * )( GLuint shader, GLenum pname, GLint* param );
+	using PFN_glGetUniformBlockIndex = GLuint ( GLAPIENTRY * )( GLuint program, const GLchar * uniformBlockName );
 	using PFN_glGetString = GLubyte *( GLAPIENTRY * )( GLenum name ); 
 	using PFN_glGetTexImage = void ( GLAPIENTRY * )( GLenum target, GLint level, GLenum format, GLenum type, void *pixels );
 	using PFN_glGetTexLevelParameterfv = void ( GLAPIENTRY * )( GLenum target, GLint level, GLenum pname, GLfloat * params );
@@ -249,7 +250,9 @@ namespace gl_renderer
 	using PFN_glMapBufferRange = void * ( GLAPIENTRY * )( GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access );
 	using PFN_glMemoryBarrier = void ( GLAPIENTRY * )( GLbitfield barriers );
 	using PFN_glMinSampleShading = void ( GLAPIENTRY * )( GLfloat value );
+	using PFN_glMultiDrawArrays = void ( GLAPIENTRY * )( GLenum mode, const GLint * first, const GLsizei * count, GLsizei drawcount );
 	using PFN_glMultiDrawArraysIndirect = void ( GLAPIENTRY * )( GLenum mode, const void * indirect, GLsizei drawcount, GLsizei stride );
+	using PFN_glMultiDrawElementsBaseVertex = void ( GLAPIENTRY * )( GLenum mode, const GLsizei * count, GLenum type, const void * const * indices, GLsizei drawcount, const GLint * basevertex );
 	using PFN_glMultiDrawElementsIndirect = void ( GLAPIENTRY * )( GLenum mode, GLenum type, const void * indirect, GLsizei drawcount, GLsizei stride );
 	using PFN_glPatchParameteri = void ( GLAPIENTRY * )( GLenum pname, GLint value );
 	using PFN_glPixelStorei = void ( GLAPIENTRY * )( GLenum pname, GLint param );
@@ -299,6 +302,7 @@ namespace gl_renderer
 	using PFN_glUniform4fv = void ( GLAPIENTRY * )( GLint location, GLsizei count, const GLfloat* value );
 	using PFN_glUniform4iv = void ( GLAPIENTRY * )( GLint location, GLsizei count, const GLint* value );
 	using PFN_glUniform4uiv = void ( GLAPIENTRY * )( GLint location, GLsizei count, const GLuint *value );
+	using PFN_glUniformBlockBinding = void ( GLAPIENTRY * )( GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding );
 	using PFN_glUniformMatrix2fv = void ( GLAPIENTRY * )( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value );
 	using PFN_glUniformMatrix3fv = void ( GLAPIENTRY * )( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value );
 	using PFN_glUniformMatrix4fv = void ( GLAPIENTRY * )( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value );
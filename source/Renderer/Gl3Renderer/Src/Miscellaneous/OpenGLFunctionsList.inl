@@ -118,8 +118,11 @@ GL_LIB_FUNCTION( GetQueryObjectui64v )
 GL_LIB_FUNCTION( GetQueryObjectuiv )
 GL_LIB_FUNCTION( GetShaderInfoLog )
 GL_LIB_FUNCTION( GetShaderiv )
+GL_LIB_FUNCTION( GetUniformBlockIndex )
 GL_LIB_FUNCTION( LinkProgram )
 GL_LIB_FUNCTION( MapBufferRange )
+GL_LIB_FUNCTION( MultiDrawArrays )
+GL_LIB_FUNCTION( MultiDrawElementsBaseVertex )
 GL_LIB_FUNCTION( PolygonOffsetClampEXT )
 GL_LIB_FUNCTION( QueryCounter )
 GL_LIB_FUNCTION( SamplerParameterf )
@@ -147,6 +150,7 @@ GL_LIB_FUNCTION( Uniform3uiv )
 GL_LIB_FUNCTION( Uniform4fv )
 GL_LIB_FUNCTION( Uniform4iv )
 GL_LIB_FUNCTION( Uniform4uiv )
+GL_LIB_FUNCTION( UniformBlockBinding )
 GL_LIB_FUNCTION( UniformMatrix2fv )
 GL_LIB_FUNCTION( UniformMatrix3fv )
 GL_LIB_FUNCTION( UniformMatrix4fv )
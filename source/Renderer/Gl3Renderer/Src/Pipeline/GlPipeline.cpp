@@ -140,6 +140,7 @@ namespace gl_renderer
 		apply( m_device, m_msState );
 		apply( m_device, m_tsState );
 		m_program.link();
+		m_program.bindPushConstantsBlock( m_device.getPushConstantsBinding() );
 
 		if ( m_device.getRenderer().isValidationEnabled() )
 		{
@@ -158,15 +159,8 @@ namespace gl_renderer
 		, IboBinding const & ibo )const
 	{
 		size_t hash = doHash( vbos, ibo );
-		auto it = std::find_if( m_geometryBuffers.begin()
-			, m_geometryBuffers.end()
-			, [&hash]( std::pair< size_t, GeometryBuffersPtr > const & pair )
-		{
-			return pair.first == hash;
-		} );
-		return it == m_geometryBuffers.end()
-			? nullptr
-			: it->second.get();
+		std::lock_guard< std::mutex > lock{ m_geometryBuffersMutex };
+		return doFindGeometryBuffers( hash );
 	}
 
 	GeometryBuffersRef Pipeline::createGeometryBuffers( VboBindings vbos
@@ -174,16 +168,34 @@ namespace gl_renderer
 		, renderer::IndexType type )const
 	{
 		size_t hash = doHash( vbos, ibo );
+		std::lock_guard< std::mutex > lock{ m_geometryBuffersMutex };
+
+		// Another command buffer may have created them since our lookup.
+		if ( auto result = doFindGeometryBuffers( hash ) )
+		{
+			return *result;
+		}
+
 		m_geometryBuffers.emplace_back( hash, std::make_unique< GeometryBuffers >( vbos, ibo, m_vertexInputState, type ) );
 
 		for ( auto & binding : vbos )
 		{
 			auto & vbo = binding.second;
-			m_connections.emplace( vbo.bo, vbo.buffer->onDestroy.connect( [this]( GLuint name )
+			auto buffer = vbo.buffer;
+			m_connections.emplace( buffer, buffer->onDestroy.connect( [this, buffer]( GLuint name )
 			{
+				// A suballocated buffer shares its name with other buffers, only its range is checked.
+				auto uses = [buffer, &name]( GLuint bo, uint64_t offset )
+				{
+					return bo == name
+						&& ( !buffer->isSuballocated()
+							|| ( offset >= uint64_t( buffer->getOffset() )
+								&& offset < uint64_t( buffer->getOffset() ) + buffer->getSize() ) );
+				};
+				std::lock_guard< std::mutex > lock{ m_geometryBuffersMutex };
 				auto it = std::remove_if( m_geometryBuffers.begin()
 					, m_geometryBuffers.end()
-					, [&name]( std::pair< size_t, GeometryBuffersPtr > const & pair )
+					, [&uses]( std::pair< size_t, GeometryBuffersPtr > const & pair )
 				{
 					bool result = false;
 
@@ -191,13 +203,13 @@ namespace gl_renderer
 					{
 						if ( !result )
 						{
-							result = vbo.vbo == name;
+							result = uses( vbo.vbo, vbo.offset );
 						}
 					}
 
 					if ( !result && bool( pair.second->hasIbo() ) )
 					{
-						result = pair.second->getIbo().ibo == name;
+						result = uses( pair.second->getIbo().ibo, pair.second->getIbo().offset );
 					}
 
 					return result;
@@ -212,4 +224,17 @@ namespace gl_renderer
 
 		return *m_geometryBuffers.back().second;
 	}
+
+	GeometryBuffers * Pipeline::doFindGeometryBuffers( size_t hash )const
+	{
+		auto it = std::find_if( m_geometryBuffers.begin()
+			, m_geometryBuffers.end()
+			, [&hash]( std::pair< size_t, GeometryBuffersPtr > const & pair )
+		{
+			return pair.first == hash;
+		} );
+		return it == m_geometryBuffers.end()
+			? nullptr
+			: it->second.get();
+	}
 }
@@ -243,7 +243,7 @@ namespace gl_renderer
 						, attachment.object
 						, mipLevel );
 				}
-				checkCompleteness( gl::CheckFramebufferStatus( GL_FRAMEBUFFER ) );
+				checkCompleteness( glContextCall( gl::CheckFramebufferStatus )( GL_FRAMEBUFFER ) );
 			}
 			else
 			{
@@ -267,7 +267,7 @@ namespace gl_renderer
 			}
 		}
 
-		checkCompleteness( gl::CheckFramebufferStatus( GL_FRAMEBUFFER ) );
+		checkCompleteness( glContextCall( gl::CheckFramebufferStatus )( GL_FRAMEBUFFER ) );
 		glLogCall( gl::BindFramebuffer, GL_FRAMEBUFFER, 0 );
 	}
 
@@ -65,7 +65,7 @@ namespace gl_renderer
 		, renderer::ShaderStageFlag stage )
 		: renderer::ShaderModule{ device, stage }
 		, m_device{ device }
-		, m_shader{ gl::CreateShader( convert( stage ) ) }
+		, m_shader{ glContextCall( gl::CreateShader )( convert( stage ) ) }
 		, m_isSpirV{ false }
 	{
 	}
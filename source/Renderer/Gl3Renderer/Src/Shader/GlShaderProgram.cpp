@@ -137,7 +137,7 @@ namespace gl_renderer
 	}
 
 	ShaderProgram::ShaderProgram( std::vector< renderer::ShaderStageState > const & stages )
-		: m_program{ gl::CreateProgram() }
+		: m_program{ glContextCall( gl::CreateProgram )() }
 	{
 		for ( auto & stage : stages )
 		{
@@ -149,7 +149,7 @@ namespace gl_renderer
 	}
 
 	ShaderProgram::ShaderProgram( renderer::ShaderStageState const & stage )
-		: m_program{ gl::CreateProgram() }
+		: m_program{ glContextCall( gl::CreateProgram )() }
 	{
 		auto & module = static_cast< ShaderModule const & >( *stage.module );
 		m_shaders.push_back( module.getShader() );
@@ -206,4 +206,14 @@ namespace gl_renderer
 			}
 		}
 	}
+
+	void ShaderProgram::bindPushConstantsBlock( GLuint binding )const
+	{
+		auto index = glLogCall( gl::GetUniformBlockIndex, m_program, "PushConstants" );
+
+		if ( index != GL_INVALID_INDEX )
+		{
+			glLogCall( gl::UniformBlockBinding, m_program, index, binding );
+		}
+	}
 }
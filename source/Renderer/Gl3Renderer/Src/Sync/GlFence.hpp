@@ -13,6 +13,8 @@ namespace gl_renderer
 	/**
 	*\brief
 	*	Classe permettant la synchronisation des opérations sur une file.
+	*\remarks
+	*	En mode de soumission asynchrone, l'objet de synchronisation OpenGL n'est manipulé que sur le thread de soumission.
 	*/
 	class Fence
 		: public renderer::Fence
@@ -47,6 +49,13 @@ namespace gl_renderer
 		*	Remet la barrière en non signalée.
 		*/ 
 		void reset()const override;
+		/**
+		*\brief
+		*	Insère la barrière dans le flux de commandes OpenGL.
+		*\remarks
+		*	Appelée par la file, sur le thread du contexte, après l'exécution des tampons de commandes soumis.
+		*/ 
+		void insert()const;
 
 	private:
 		mutable GLsync m_fence{ nullptr };
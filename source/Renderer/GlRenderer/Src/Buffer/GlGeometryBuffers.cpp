@@ -69,6 +69,11 @@ namespace gl_renderer
 
 	void GeometryBuffers::initialise()
 	{
+		if ( m_vao != GL_INVALID_INDEX )
+		{
+			return;
+		}
+
 		glLogCall( gl::GenVertexArrays, 1, &m_vao );
 
 		if ( m_vao == GL_INVALID_INDEX )
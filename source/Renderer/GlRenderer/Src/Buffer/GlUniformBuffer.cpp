@@ -11,7 +11,7 @@ namespace gl_renderer
 			static uint32_t const result = []()
 			{
 				GLint value;
-				gl::GetIntegerv( GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &value );
+				glLogCall( gl::GetIntegerv, GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &value );
 				return uint32_t( value );
 			}();
 			return result;
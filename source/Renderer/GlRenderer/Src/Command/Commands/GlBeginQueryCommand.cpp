@@ -21,9 +21,4 @@ namespace gl_renderer
 		glLogCommand( "BeginQueryCommand" );
 		glLogCall( gl::BeginQuery, m_target, m_query );
 	}
-
-	CommandPtr BeginQueryCommand::clone()const
-	{
-		return std::make_unique< BeginQueryCommand >( *this );
-	}
 }
@@ -20,7 +20,6 @@ namespace gl_renderer
 			, uint32_t query
 			, renderer::QueryControlFlags flags );
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		GlQueryType m_target;
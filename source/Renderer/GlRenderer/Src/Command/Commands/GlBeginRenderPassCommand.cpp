@@ -219,9 +219,4 @@ namespace gl_renderer
 				, save.size.height );
 		}
 	}
-
-	CommandPtr BeginRenderPassCommand::clone()const
-	{
-		return std::make_unique< BeginRenderPassCommand >( *this );
-	}
 }
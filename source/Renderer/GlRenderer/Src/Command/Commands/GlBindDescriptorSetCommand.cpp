@@ -4,208 +4,19 @@ See LICENSE file in root folder.
 */
 #include "GlBindDescriptorSetCommand.hpp"
 
-#include "Buffer/GlBuffer.hpp"
-#include "Buffer/GlBufferView.hpp"
+#include "Core/GlDevice.hpp"
 #include "Descriptor/GlDescriptorSet.hpp"
 #include "Pipeline/GlPipelineLayout.hpp"
-#include "Image/GlSampler.hpp"
-#include "Image/GlTexture.hpp"
-#include "Image/GlTextureView.hpp"
-#include "Buffer/GlUniformBuffer.hpp"
-
-#include <Descriptor/DescriptorSetLayoutBinding.hpp>
 
 namespace gl_renderer
 {
-	namespace
-	{
-		renderer::TextureView const & getView( renderer::WriteDescriptorSet const & write, uint32_t index )
-		{
-			assert( index < write.imageInfo.size() );
-			return write.imageInfo[index].imageView.value().get();
-		}
-
-		renderer::Sampler const & getSampler( renderer::WriteDescriptorSet const & write, uint32_t index )
-		{
-			assert( index < write.imageInfo.size() );
-			return write.imageInfo[index].sampler.value().get();
-		}
-
-		renderer::BufferBase const & getBuffer( renderer::WriteDescriptorSet const & write, uint32_t index )
-		{
-			assert( index < write.bufferInfo.size() );
-			return write.bufferInfo[index].buffer.get();
-		}
-
-		void bindCombinedSampler( renderer::WriteDescriptorSet const & write )
-		{
-			for ( auto i = 0u; i < write.imageInfo.size(); ++i )
-			{
-				uint32_t bindingIndex = write.dstBinding + write.dstArrayElement + i;
-				auto & view = getView( write, i );
-				auto & sampler = getSampler( write, i );
-				glLogCall( gl::ActiveTexture
-					, GlTextureUnit( GL_TEXTURE0 + bindingIndex ) );
-				glLogCall( gl::BindTexture
-					, convert( view.getType() )
-					, static_cast< TextureView const & >( view ).getImage() );
-				glLogCall( gl::BindSampler
-					, bindingIndex
-					, static_cast< Sampler const & >( sampler ).getSampler() );
-			}
-		}
-
-		void bindSampler( renderer::WriteDescriptorSet const & write )
-		{
-			for ( auto i = 0u; i < write.imageInfo.size(); ++i )
-			{
-				uint32_t bindingIndex = write.dstBinding + write.dstArrayElement + i;
-				auto & sampler = getSampler( write, i );
-				glLogCall( gl::BindSampler
-					, bindingIndex
-					, static_cast< Sampler const & >( sampler ).getSampler() );
-			}
-		}
-
-		void bindSampledTexture( renderer::WriteDescriptorSet const & write )
-		{
-			for ( auto i = 0u; i < write.imageInfo.size(); ++i )
-			{
-				uint32_t bindingIndex = write.dstBinding + write.dstArrayElement + i;
-				auto & view = getView( write, i );
-				glLogCall( gl::ActiveTexture
-					, GlTextureUnit( GL_TEXTURE0 + bindingIndex ) );
-				glLogCall( gl::BindTexture
-					, convert( view.getType() )
-					, static_cast< TextureView const & >( view ).getImage() );
-			}
-		}
-
-		void bindStorageTexture( renderer::WriteDescriptorSet const & write )
-		{
-			for ( auto i = 0u; i < write.imageInfo.size(); ++i )
-			{
-				uint32_t bindingIndex = write.dstBinding + write.dstArrayElement + i;
-				auto & view = getView( write, i );
-				auto & range = view.getSubResourceRange();
-				glLogCall( gl::ActiveTexture
-					, GlTextureUnit( GL_TEXTURE0 + bindingIndex ) );
-				glLogCall( gl::BindImageTexture
-					, bindingIndex
-					, static_cast< TextureView const & >( view ).getImage()
-					, range.baseMipLevel
-					, range.layerCount
-					, range.baseArrayLayer
-					, GL_ACCESS_TYPE_READ_WRITE
-					, getInternal( view.getFormat() ) );
-			}
-		}
-
-		void bindUniformBuffer( renderer::WriteDescriptorSet const & write )
-		{
-			for ( auto i = 0u; i < write.bufferInfo.size(); ++i )
-			{
-				uint32_t bindingIndex = write.dstBinding + write.dstArrayElement + i;
-				auto & buffer = getBuffer( write, i );
-				glLogCall( gl::BindBufferRange
-					, GL_BUFFER_TARGET_UNIFORM
-					, bindingIndex
-					, static_cast< Buffer const & >( buffer ).getBuffer()
-					, GLintptr( write.bufferInfo[i].offset )
-					, GLsizeiptr( write.bufferInfo[i].range ) );
-			}
-		}
-
-		void bindStorageBuffer( renderer::WriteDescriptorSet const & write )
-		{
-			for ( auto i = 0u; i < write.bufferInfo.size(); ++i )
-			{
-				uint32_t bindingIndex = write.dstBinding + write.dstArrayElement + i;
-				auto & buffer = getBuffer( write, i );
-				glLogCall( gl::BindBufferRange
-					, GL_BUFFER_TARGET_SHADER_STORAGE
-					, bindingIndex
-					, static_cast< Buffer const & >( buffer ).getBuffer()
-					, GLintptr( write.bufferInfo[i].offset )
-					, GLsizeiptr( write.bufferInfo[i].range ) );
-			}
-		}
-
-		void bindTexelBuffer( renderer::WriteDescriptorSet const & write )
-		{
-			for ( auto i = 0u; i < write.bufferInfo.size(); ++i )
-			{
-				uint32_t bindingIndex = write.dstBinding + write.dstArrayElement + i;
-				auto & buffer = getBuffer( write, i );
-				glLogCall( gl::ActiveTexture
-					, GlTextureUnit( GL_TEXTURE0 + bindingIndex ) );
-				glLogCall( gl::BindTexture
-					, GL_BUFFER_TARGET_TEXTURE
-					, static_cast< BufferView const & >( write.texelBufferView[i].get() ).getImage() );
-			}
-		}
-
-		void bindDynamicUniformBuffer( renderer::WriteDescriptorSet const & write, uint32_t offset )
-		{
-			for ( auto i = 0u; i < write.bufferInfo.size(); ++i )
-			{
-				uint32_t bindingIndex = write.dstBinding + write.dstArrayElement + i;
-				auto & buffer = getBuffer( write, i );
-				glLogCall( gl::BindBufferRange
-					, GL_BUFFER_TARGET_UNIFORM
-					, bindingIndex
-					, static_cast< Buffer const & >( buffer ).getBuffer()
-					, GLintptr( write.bufferInfo[i].offset + offset )
-					, GLsizeiptr( write.bufferInfo[i].range ) );
-			}
-		}
-
-		void bindDynamicStorageBuffer( renderer::WriteDescriptorSet const & write, uint32_t offset )
-		{
-			for ( auto i = 0u; i < write.bufferInfo.size(); ++i )
-			{
-				uint32_t bindingIndex = write.dstBinding + write.dstArrayElement + i;
-				auto & buffer = getBuffer( write, i );
-				glLogCall( gl::BindBufferRange
-					, GL_BUFFER_TARGET_SHADER_STORAGE
-					, bindingIndex
-					, static_cast< Buffer const & >( buffer ).getBuffer()
-					, GLintptr( write.bufferInfo[i].offset + offset )
-					, GLsizeiptr( write.bufferInfo[i].range ) );
-			}
-		}
-
-		void bindDynamicBuffers( renderer::WriteDescriptorSetArray const & writes
-			, renderer::UInt32Array const & offsets )
-		{
-			for ( auto i = 0u; i < offsets.size(); ++i )
-			{
-				auto & write = writes[i];
-
-				switch ( write.descriptorType )
-				{
-				case renderer::DescriptorType::eUniformBufferDynamic:
-					bindDynamicUniformBuffer( write, offsets[i] );
-					break;
-
-				case renderer::DescriptorType::eStorageBufferDynamic:
-					bindDynamicStorageBuffer( write, offsets[i] );
-					break;
-
-				default:
-					assert( false && "Unsupported dynamic descriptor type" );
-					throw std::runtime_error{ "Unsupported dynamic descriptor type" };
-					break;
-				}
-			}
-		}
-	}
-
-	BindDescriptorSetCommand::BindDescriptorSetCommand( renderer::DescriptorSet const & descriptorSet
+	BindDescriptorSetCommand::BindDescriptorSetCommand( Device const & device
+		, renderer::DescriptorSet const & descriptorSet
 		, renderer::PipelineLayout const & layout
 		, renderer::UInt32Array const & dynamicOffsets
 		, renderer::PipelineBindPoint bindingPoint )
-		: m_descriptorSet{ static_cast< DescriptorSet const & >( descriptorSet ) }
+		: m_device{ device }
+		, m_descriptorSet{ static_cast< DescriptorSet const & >( descriptorSet ) }
 		, m_layout{ static_cast< PipelineLayout const & >( layout ) }
 		, m_bindingPoint{ bindingPoint }
 		, m_dynamicOffsets{ dynamicOffsets }
@@ -217,46 +28,56 @@ namespace gl_renderer
 	void BindDescriptorSetCommand::apply()const
 	{
 		glLogCommand( "BindDescriptorSetCommand" );
-		for ( auto & write : m_descriptorSet.getCombinedTextureSamplers() )
+		for ( auto & bindings : m_descriptorSet.getTextureBindings() )
 		{
-			bindCombinedSampler( write );
+			m_device.bindTextures( bindings.first
+				, uint32_t( bindings.names.size() )
+				, bindings.targets.data()
+				, bindings.names.data() );
 		}
 
-		for ( auto & write : m_descriptorSet.getSamplers() )
+		for ( auto & bindings : m_descriptorSet.getSamplerBindings() )
 		{
-			bindSampler( write );
+			m_device.bindSamplers( bindings.first
+				, uint32_t( bindings.names.size() )
+				, bindings.names.data() );
 		}
 
-		for ( auto & write : m_descriptorSet.getSampledTextures() )
+		for ( auto & bindings : m_descriptorSet.getImageBindings() )
 		{
-			bindSampledTexture( write );
+			m_device.bindImageTextures( bindings.first
+				, uint32_t( bindings.names.size() )
+				, bindings.names.data()
+				, bindings.formats.data() );
 		}
 
-		for ( auto & write : m_descriptorSet.getStorageTextures() )
+		for ( auto & bindings : m_descriptorSet.getUniformBufferBindings() )
 		{
-			bindStorageTexture( write );
+			m_device.bindBuffersRange( GL_BUFFER_TARGET_UNIFORM
+				, bindings.first
+				, uint32_t( bindings.names.size() )
+				, bindings.names.data()
+				, bindings.offsets.data()
+				, bindings.ranges.data() );
 		}
 
-		for ( auto & write : m_descriptorSet.getUniformBuffers() )
+		for ( auto & bindings : m_descriptorSet.getStorageBufferBindings() )
 		{
-			bindUniformBuffer( write );
+			m_device.bindBuffersRange( GL_BUFFER_TARGET_SHADER_STORAGE
+				, bindings.first
+				, uint32_t( bindings.names.size() )
+				, bindings.names.data()
+				, bindings.offsets.data()
+				, bindings.ranges.data() );
 		}
 
-		for ( auto & write : m_descriptorSet.getStorageBuffers() )
+		for ( auto & binding : m_descriptorSet.getDynamicBufferBindings() )
 		{
-			bindStorageBuffer( write );
+			m_device.bindBufferRange( binding.target
+				, binding.unit
+				, binding.name
+				, binding.offset + GLintptr( m_dynamicOffsets[binding.dynamicIndex] )
+				, binding.range );
 		}
-
-		for ( auto & write : m_descriptorSet.getTexelBuffers() )
-		{
-			bindTexelBuffer( write );
-		}
-
-		bindDynamicBuffers( m_descriptorSet.getDynamicBuffers(), m_dynamicOffsets );
-	}
-
-	CommandPtr BindDescriptorSetCommand::clone()const
-	{
-		return std::make_unique< BindDescriptorSetCommand >( *this );
 	}
 }
@@ -12,13 +12,15 @@ namespace gl_renderer
 	*\brief
 	*	Commande d'activation d'un set de descripteurs.
 	*/
-	class BindDescriptorSetCommand
+	class BindDescriptorSetCommand final
 		: public CommandBase
 	{
 	public:
 		/**
 		*\brief
 		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
 		*\param[in] descriptorSet
 		*	Le descriptor set.
 		*\param[in] layout
@@ -26,18 +28,25 @@ namespace gl_renderer
 		*\param[in] bindingPoint
 		*	Le point d'attache du set.
 		*/
-		BindDescriptorSetCommand( renderer::DescriptorSet const & descriptorSet
+		BindDescriptorSetCommand( Device const & device
+			, renderer::DescriptorSet const & descriptorSet
 			, renderer::PipelineLayout const & layout
 			, renderer::UInt32Array const & dynamicOffsets
 			, renderer::PipelineBindPoint bindingPoint );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
+		Device const & m_device;
 		DescriptorSet const & m_descriptorSet;
 		PipelineLayout const & m_layout;
 		renderer::PipelineBindPoint m_bindingPoint;
 		renderer::UInt32Array m_dynamicOffsets;
 	};
+
+	template<>
+	struct CommandTypeGetter< BindDescriptorSetCommand >
+	{
+		static CommandType constexpr value = CommandType::eBindDescriptorSet;
+	};
 }
@@ -12,7 +12,7 @@ namespace gl_renderer
 	*\brief
 	*	Classe de base d'une commande.
 	*/
-	class BindGeometryBuffersCommand
+	class BindGeometryBuffersCommand final
 		: public CommandBase
 	{
 	public:
@@ -23,9 +23,14 @@ namespace gl_renderer
 		BindGeometryBuffersCommand( GeometryBuffers const & vao );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		GeometryBuffers const & m_vao;
 	};
+
+	template<>
+	struct CommandTypeGetter< BindGeometryBuffersCommand >
+	{
+		static CommandType constexpr value = CommandType::eBindGeometryBuffers;
+	};
 }
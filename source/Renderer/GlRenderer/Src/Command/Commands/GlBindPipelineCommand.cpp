@@ -478,9 +478,4 @@ namespace gl_renderer
 			save = m_program;
 		}
 	}
-
-	CommandPtr BindPipelineCommand::clone()const
-	{
-		return std::make_unique< BindPipelineCommand >( *this );
-	}
 }
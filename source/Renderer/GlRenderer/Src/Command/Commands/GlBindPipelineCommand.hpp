@@ -24,7 +24,7 @@ namespace gl_renderer
 	*\brief
 	*	Commande d'activation d'un pipeline: shaders, tests, �tats, ...
 	*/
-	class BindPipelineCommand
+	class BindPipelineCommand final
 		: public CommandBase
 	{
 	public:
@@ -41,7 +41,6 @@ namespace gl_renderer
 			, renderer::PipelineBindPoint bindingPoint );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		Device const & m_device;
@@ -54,4 +53,10 @@ namespace gl_renderer
 		bool m_dynamicScissor;
 		bool m_dynamicViewport;
 	};
+
+	template<>
+	struct CommandTypeGetter< BindPipelineCommand >
+	{
+		static CommandType constexpr value = CommandType::eBindPipeline;
+	};
 }
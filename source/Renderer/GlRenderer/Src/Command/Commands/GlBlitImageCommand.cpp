@@ -188,9 +188,4 @@ namespace gl_renderer
 			glLogCall( gl::BindFramebuffer, GL_READ_FRAMEBUFFER, 0u );
 		}
 	}
-
-	CommandPtr BlitImageCommand::clone()const
-	{
-		return std::make_unique< BlitImageCommand >( *this );
-	}
 }
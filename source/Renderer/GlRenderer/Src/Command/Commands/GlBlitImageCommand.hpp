@@ -46,7 +46,6 @@ namespace gl_renderer
 		~BlitImageCommand();
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		Texture const & m_srcTexture;
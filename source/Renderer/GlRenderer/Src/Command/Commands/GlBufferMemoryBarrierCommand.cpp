@@ -18,9 +18,4 @@ namespace gl_renderer
 		glLogCommand( "BufferMemoryBarrierCommand" );
 		glLogCall( gl::MemoryBarrier, m_flags );
 	}
-
-	CommandPtr BufferMemoryBarrierCommand::clone()const
-	{
-		return std::make_unique< BufferMemoryBarrierCommand >( *this );
-	}
 }
@@ -88,9 +88,4 @@ namespace gl_renderer
 			, scissor.size.width
 			, scissor.size.height );
 	}
-
-	CommandPtr ClearAttachmentsCommand::clone()const
-	{
-		return std::make_unique< ClearAttachmentsCommand >( *this );
-	}
 }
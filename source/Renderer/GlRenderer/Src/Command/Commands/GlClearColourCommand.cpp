@@ -36,9 +36,4 @@ namespace gl_renderer
 			renderer::Logger::logError( "Unsupported command : ClearColourCommand" );
 		}
 	}
-
-	CommandPtr ClearColourCommand::clone()const
-	{
-		return std::make_unique< ClearColourCommand >( *this );
-	}
 }
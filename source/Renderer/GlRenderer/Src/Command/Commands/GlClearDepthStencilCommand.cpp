@@ -57,9 +57,4 @@ namespace gl_renderer
 			renderer::Logger::logError( "Unsupported command : ClearDepthStencilCommand" );
 		}
 	}
-
-	CommandPtr ClearDepthStencilCommand::clone()const
-	{
-		return std::make_unique< ClearDepthStencilCommand >( *this );
-	}
 }
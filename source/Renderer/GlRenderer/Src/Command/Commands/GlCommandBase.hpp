@@ -8,12 +8,41 @@ See LICENSE file in root folder
 
 namespace gl_renderer
 {
+	/**
+	*\brief
+	*	Les types de commandes que le CommandStream rejoue sans passer par l'appel virtuel.
+	*/
+	enum class CommandType
+		: uint16_t
+	{
+		eGeneric,
+		eBindDescriptorSet,
+		eBindGeometryBuffers,
+		eBindPipeline,
+		eDraw,
+		eDrawIndexed,
+		eMultiDraw,
+		eMultiDrawIndexed,
+		ePushConstants,
+		ePushConstantsBuffer,
+		eScissor,
+		eViewport,
+	};
+	/**
+	*\brief
+	*	Donne le CommandType d'une classe de commande (CommandType::eGeneric par défaut).
+	*/
+	template< typename CommandT >
+	struct CommandTypeGetter
+	{
+		static CommandType constexpr value = CommandType::eGeneric;
+	};
+
 	class CommandBase
 	{
 	public:
 		virtual ~CommandBase()noexcept;
 
 		virtual void apply()const = 0;
-		virtual CommandPtr clone()const = 0;
 	};
 }
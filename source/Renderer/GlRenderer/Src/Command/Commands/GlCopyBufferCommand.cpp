@@ -29,8 +29,8 @@ namespace gl_renderer
 			glLogCall( gl::CopyBufferSubData
 				, GL_BUFFER_TARGET_COPY_READ
 				, GL_BUFFER_TARGET_COPY_WRITE
-				, m_copyInfo.srcOffset
-				, m_copyInfo.dstOffset
+				, GLintptr( m_copyInfo.srcOffset ) + m_src.getOffset()
+				, GLintptr( m_copyInfo.dstOffset ) + m_dst.getOffset()
 				, m_copyInfo.size );
 			glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_COPY_WRITE, 0u );
 			glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_COPY_READ, 0u );
@@ -42,16 +42,11 @@ namespace gl_renderer
 			glLogCall( gl::CopyBufferSubData
 				, m_src.getTarget()
 				, m_dst.getTarget()
-				, m_copyInfo.srcOffset
-				, m_copyInfo.dstOffset
+				, GLintptr( m_copyInfo.srcOffset ) + m_src.getOffset()
+				, GLintptr( m_copyInfo.dstOffset ) + m_dst.getOffset()
 				, m_copyInfo.size );
 			glLogCall( gl::BindBuffer, m_dst.getTarget(), 0u );
 			glLogCall( gl::BindBuffer, m_src.getTarget(), 0u );
 		}
 	}
-
-	CommandPtr CopyBufferCommand::clone()const
-	{
-		return std::make_unique< CopyBufferCommand >( *this );
-	}
 }
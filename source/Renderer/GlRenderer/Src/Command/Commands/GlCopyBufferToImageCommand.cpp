@@ -5,6 +5,7 @@ See LICENSE file in root folder.
 #include "GlCopyBufferToImageCommand.hpp"
 
 #include "Buffer/GlBuffer.hpp"
+#include "Core/GlDevice.hpp"
 #include "Image/GlTexture.hpp"
 #include "Image/GlTextureView.hpp"
 
@@ -20,10 +21,12 @@ namespace gl_renderer
 		GL_PACK_ALIGNMENT = 0x0D05,
 	};
 
-	CopyBufferToImageCommand::CopyBufferToImageCommand( renderer::BufferImageCopyArray const & copyInfo
+	CopyBufferToImageCommand::CopyBufferToImageCommand( Device const & device
+		, renderer::BufferImageCopyArray const & copyInfo
 		, renderer::BufferBase const & src
 		, renderer::Texture const & dst )
-		: m_copyInfo{ copyInfo }
+		: m_device{ device }
+		, m_copyInfo{ copyInfo }
 		, m_src{ static_cast< Buffer const & >( src ) }
 		, m_dst{ static_cast< Texture const & >( dst ) }
 		, m_internal{ getInternal( m_dst.getFormat() ) }
@@ -43,11 +46,6 @@ namespace gl_renderer
 		}
 	}
 
-	CommandPtr CopyBufferToImageCommand::clone()const
-	{
-		return std::make_unique< CopyBufferToImageCommand >( *this );
-	}
-
 	void CopyBufferToImageCommand::applyOne( renderer::BufferImageCopy const & copyInfo )const
 	{
 		glLogCall( gl::BindTexture, m_copyTarget, m_dst.getImage() );
@@ -66,7 +64,7 @@ namespace gl_renderer
 					, copyInfo.imageExtent.width
 					, m_internal
 					, copyInfo.levelSize
-					, BufferOffset( copyInfo.bufferOffset ) );
+					, BufferOffset( m_src.getOffset() + copyInfo.bufferOffset ) );
 				break;
 
 			case GL_TEXTURE_2D:
@@ -79,7 +77,7 @@ namespace gl_renderer
 					, copyInfo.imageExtent.height
 					, m_internal
 					, copyInfo.levelSize
-					, BufferOffset( copyInfo.bufferOffset ) );
+					, BufferOffset( m_src.getOffset() + copyInfo.bufferOffset ) );
 				break;
 
 			case GL_TEXTURE_3D:
@@ -94,7 +92,7 @@ namespace gl_renderer
 					, copyInfo.imageExtent.depth
 					, m_internal
 					, copyInfo.levelSize
-					, BufferOffset( copyInfo.bufferOffset ) );
+					, BufferOffset( m_src.getOffset() + copyInfo.bufferOffset ) );
 
 			case GL_TEXTURE_1D_ARRAY:
 				glLogCall( gl::CompressedTexSubImage2D
@@ -106,7 +104,7 @@ namespace gl_renderer
 					, copyInfo.imageSubresource.layerCount
 					, m_internal
 					, copyInfo.levelSize
-					, BufferOffset( copyInfo.bufferOffset ) );
+					, BufferOffset( m_src.getOffset() + copyInfo.bufferOffset ) );
 				break;
 
 			case GL_TEXTURE_2D_ARRAY:
@@ -121,7 +119,7 @@ namespace gl_renderer
 					, copyInfo.imageSubresource.layerCount
 					, m_internal
 					, copyInfo.levelSize
-					, BufferOffset( copyInfo.bufferOffset ) );
+					, BufferOffset( m_src.getOffset() + copyInfo.bufferOffset ) );
 				break;
 			}
 		}
@@ -137,7 +135,7 @@ namespace gl_renderer
 					, copyInfo.imageExtent.width
 					, m_format
 					, m_type
-					, BufferOffset( copyInfo.bufferOffset ) );
+					, BufferOffset( m_src.getOffset() + copyInfo.bufferOffset ) );
 				break;
 
 			case GL_TEXTURE_2D:
@@ -150,7 +148,7 @@ namespace gl_renderer
 					, copyInfo.imageExtent.height
 					, m_format
 					, m_type
-					, BufferOffset( copyInfo.bufferOffset ) );
+					, BufferOffset( m_src.getOffset() + copyInfo.bufferOffset ) );
 				break;
 
 			case GL_TEXTURE_3D:
@@ -165,7 +163,7 @@ namespace gl_renderer
 					, copyInfo.imageExtent.depth
 					, m_format
 					, m_type
-					, BufferOffset( copyInfo.bufferOffset ) );
+					, BufferOffset( m_src.getOffset() + copyInfo.bufferOffset ) );
 				break;
 
 			case GL_TEXTURE_1D_ARRAY:
@@ -178,7 +176,7 @@ namespace gl_renderer
 					, copyInfo.imageSubresource.layerCount
 					, m_format
 					, m_type
-					, BufferOffset( copyInfo.bufferOffset ) );
+					, BufferOffset( m_src.getOffset() + copyInfo.bufferOffset ) );
 				break;
 
 			case GL_TEXTURE_2D_ARRAY:
@@ -193,12 +191,13 @@ namespace gl_renderer
 					, copyInfo.imageSubresource.layerCount
 					, m_format
 					, m_type
-					, BufferOffset( copyInfo.bufferOffset ) );
+					, BufferOffset( m_src.getOffset() + copyInfo.bufferOffset ) );
 				break;
 			}
 		}
 
 		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_PIXEL_UNPACK, 0u );
 		glLogCall( gl::BindTexture, m_copyTarget, 0u );
+		m_device.invalidateActiveTextureUnit();
 	}
 }
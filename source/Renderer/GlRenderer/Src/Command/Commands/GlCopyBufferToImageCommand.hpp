@@ -21,6 +21,8 @@ namespace gl_renderer
 		/**
 		*\brief
 		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
 		*\param[in] copyInfo
 		*	Les informations de copie.
 		*\param[in] src
@@ -28,17 +30,18 @@ namespace gl_renderer
 		*\param[in] dst
 		*	L'image destination.
 		*/
-		CopyBufferToImageCommand( renderer::BufferImageCopyArray const & copyInfo
+		CopyBufferToImageCommand( Device const & device
+			, renderer::BufferImageCopyArray const & copyInfo
 			, renderer::BufferBase const & src
 			, renderer::Texture const & dst );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		void applyOne( renderer::BufferImageCopy const & copyInfo )const;
 
 	private:
+		Device const & m_device;
 		Buffer const & m_src;
 		Texture const & m_dst;
 		renderer::BufferImageCopyArray m_copyInfo;
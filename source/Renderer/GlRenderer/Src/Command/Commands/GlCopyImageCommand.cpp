@@ -4,6 +4,7 @@ See LICENSE file in root folder.
 */
 #include "GlCopyImageCommand.hpp"
 
+#include "Core/GlDevice.hpp"
 #include "Image/GlTexture.hpp"
 #include "Image/GlTextureView.hpp"
 
@@ -11,10 +12,12 @@ See LICENSE file in root folder.
 
 namespace gl_renderer
 {
-	CopyImageCommand::CopyImageCommand( renderer::ImageCopy const & copyInfo
+	CopyImageCommand::CopyImageCommand( Device const & device
+		, renderer::ImageCopy const & copyInfo
 		, renderer::Texture const & src
 		, renderer::Texture const & dst )
-		: m_copyInfo{ copyInfo }
+		: m_device{ device }
+		, m_copyInfo{ copyInfo }
 		, m_src{ static_cast< Texture const & >( src ) }
 		, m_dst{ static_cast< Texture const & >( dst ) }
 		, m_srcInternal{ getInternal( m_src.getFormat() ) }
@@ -51,11 +54,7 @@ namespace gl_renderer
 			, m_copyInfo.extent.depth );
 		glLogCall( gl::BindTexture, m_dstTarget, 0u );
 		glLogCall( gl::BindTexture, m_srcTarget, 0u );
+		m_device.invalidateActiveTextureUnit();
 		m_dst.generateMipmaps();
 	}
-
-	CommandPtr CopyImageCommand::clone()const
-	{
-		return std::make_unique< CopyImageCommand >( *this );
-	}
 }
@@ -124,12 +124,7 @@ namespace gl_renderer
 			, copyInfo.imageExtent.height
 			, m_format
 			, m_type
-			, nullptr );
+			, BufferOffset( m_dst.getOffset() + copyInfo.bufferOffset ) );
 		glLogCall( gl::BindFramebuffer, GL_READ_FRAMEBUFFER, 0u );
 	}
-
-	CommandPtr CopyImageToBufferCommand::clone()const
-	{
-		return std::make_unique< CopyImageToBufferCommand >( *this );
-	}
 }
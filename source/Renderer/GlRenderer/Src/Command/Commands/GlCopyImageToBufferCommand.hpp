@@ -36,7 +36,6 @@ namespace gl_renderer
 		CopyImageToBufferCommand( CopyImageToBufferCommand const & rhs );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		void applyOne( renderer::BufferImageCopy const & copyInfo
@@ -23,9 +23,4 @@ namespace gl_renderer
 			, m_groupCountY
 			, m_groupCountZ );
 	}
-
-	CommandPtr DispatchCommand::clone()const
-	{
-		return std::make_unique< DispatchCommand >( *this );
-	}
 }
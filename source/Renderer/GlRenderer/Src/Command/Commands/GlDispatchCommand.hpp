@@ -27,7 +27,6 @@ namespace gl_renderer
 			, uint32_t groupCountZ );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		uint32_t m_groupCountX;
@@ -30,9 +30,4 @@ namespace gl_renderer
 			, m_instCount
 			, m_firstInstance );
 	}
-
-	CommandPtr DrawCommand::clone()const
-	{
-		return std::make_unique< DrawCommand >( *this );
-	}
 }
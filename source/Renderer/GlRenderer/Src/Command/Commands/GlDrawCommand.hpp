@@ -6,13 +6,15 @@ See LICENSE file in root folder
 
 #include "GlCommandBase.hpp"
 
+#include <Miscellaneous/DrawIndirectCommand.hpp>
+
 namespace gl_renderer
 {
 	/**
 	*\brief
 	*	Commande de dessin non index�.
 	*/
-	class DrawCommand
+	class DrawCommand final
 		: public CommandBase
 	{
 	public:
@@ -35,7 +37,22 @@ namespace gl_renderer
 			, renderer::PrimitiveTopology mode );
 
 		void apply()const override;
-		CommandPtr clone()const override;
+		/**
+		*\return
+		*	Les paramètres du dessin, sous la forme d'une commande de dessin indirect.
+		*/
+		inline renderer::DrawIndirectCommand getIndirectCommand()const
+		{
+			return { m_vtxCount, m_instCount, m_firstVertex, m_firstInstance };
+		}
+		/**
+		*\return
+		*	Le type de primitives.
+		*/
+		inline GlPrimitiveTopology getMode()const
+		{
+			return m_mode;
+		}
 
 	private:
 		uint32_t m_vtxCount;
@@ -44,4 +61,10 @@ namespace gl_renderer
 		uint32_t m_firstInstance;
 		GlPrimitiveTopology m_mode;
 	};
+
+	template<>
+	struct CommandTypeGetter< DrawCommand >
+	{
+		static CommandType constexpr value = CommandType::eDraw;
+	};
 }
@@ -53,9 +53,4 @@ namespace gl_renderer
 			, m_vertexOffset
 			, m_firstInstance );
 	}
-
-	CommandPtr DrawIndexedCommand::clone()const
-	{
-		return std::make_unique< DrawIndexedCommand >( *this );
-	}
 }
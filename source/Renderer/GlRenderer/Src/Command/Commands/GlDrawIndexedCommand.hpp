@@ -6,13 +6,15 @@ See LICENSE file in root folder
 
 #include "GlCommandBase.hpp"
 
+#include <Miscellaneous/DrawIndexedIndirectCommand.hpp>
+
 namespace gl_renderer
 {
 	/**
 	*\brief
 	*	Commande de dessin index�.
 	*/
-	class DrawIndexedCommand
+	class DrawIndexedCommand final
 		: public CommandBase
 	{
 	public:
@@ -39,7 +41,30 @@ namespace gl_renderer
 			, renderer::IndexType type );
 
 		void apply()const override;
-		CommandPtr clone()const override;
+		/**
+		*\return
+		*	Les paramètres du dessin, sous la forme d'une commande de dessin indirect.
+		*/
+		inline renderer::DrawIndexedIndirectCommand getIndirectCommand()const
+		{
+			return { m_indexCount, m_instCount, uint32_t( m_firstIndex ), int32_t( m_vertexOffset ), m_firstInstance };
+		}
+		/**
+		*\return
+		*	Le type de primitives.
+		*/
+		inline GlPrimitiveTopology getMode()const
+		{
+			return m_mode;
+		}
+		/**
+		*\return
+		*	Le type des indices.
+		*/
+		inline GlIndexType getType()const
+		{
+			return m_type;
+		}
 
 	private:
 		uint32_t m_indexCount;
@@ -51,4 +76,10 @@ namespace gl_renderer
 		GlIndexType m_type;
 		uint32_t m_size;
 	};
+
+	template<>
+	struct CommandTypeGetter< DrawIndexedCommand >
+	{
+		static CommandType constexpr value = CommandType::eDrawIndexed;
+	};
 }
@@ -30,14 +30,9 @@ namespace gl_renderer
 		glLogCall( gl::MultiDrawElementsIndirect
 			, m_mode
 			, m_type
-			, BufferOffset( m_offset )
+			, BufferOffset( m_buffer.getOffset() + m_offset )
 			, m_drawCount
 			, m_stride );
 		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_DRAW_INDIRECT, 0 );
 	}
-
-	CommandPtr DrawIndexedIndirectCommand::clone()const
-	{
-		return std::make_unique< DrawIndexedIndirectCommand >( *this );
-	}
 }
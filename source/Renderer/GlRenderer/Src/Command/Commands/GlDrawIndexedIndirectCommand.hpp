@@ -20,7 +20,6 @@ namespace gl_renderer
 			, renderer::IndexType type );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		Buffer const & m_buffer;
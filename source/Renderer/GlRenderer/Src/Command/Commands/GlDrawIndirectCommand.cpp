@@ -27,14 +27,9 @@ namespace gl_renderer
 		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_DRAW_INDIRECT, m_buffer.getBuffer() );
 		glLogCall( gl::MultiDrawArraysIndirect
 			, m_mode
-			, BufferOffset( m_offset )
+			, BufferOffset( m_buffer.getOffset() + m_offset )
 			, m_drawCount
 			, m_stride );
 		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_DRAW_INDIRECT, 0 );
 	}
-
-	CommandPtr DrawIndirectCommand::clone()const
-	{
-		return std::make_unique< DrawIndirectCommand >( *this );
-	}
 }
@@ -23,6 +23,5 @@ namespace gl_renderer
 		EndRenderPassCommand();
 
 		void apply()const override;
-		CommandPtr clone()const override;
 	};
 }
@@ -59,9 +59,4 @@ namespace gl_renderer
 			}
 		}
 	}
-
-	CommandPtr EndSubpassCommand::clone()const
-	{
-		return std::make_unique< EndSubpassCommand >( *this );
-	}
 }
@@ -0,0 +1,35 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "GlCommandBase.hpp"
+
+namespace gl_renderer
+{
+	/**
+	*\brief
+	*	Commande d'exécution d'un tampon de commandes secondaire.
+	*\remarks
+	*	Le tampon secondaire est référencé, pas copié : ses commandes sont rejouées en place.
+	*	Comme avec Vulkan, il ne doit pas être réenregistré tant que le tampon primaire est utilisé.
+	*/
+	class ExecuteCommandsCommand
+		: public CommandBase
+	{
+	public:
+		/**
+		*\brief
+		*	Constructeur.
+		*\param[in] commandBuffer
+		*	Le tampon de commandes secondaire.
+		*/
+		ExecuteCommandsCommand( CommandBuffer const & commandBuffer );
+
+		void apply()const override;
+
+	private:
+		CommandBuffer const & m_commandBuffer;
+	};
+}
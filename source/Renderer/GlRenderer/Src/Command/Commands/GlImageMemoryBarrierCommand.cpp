@@ -18,9 +18,4 @@ namespace gl_renderer
 		//glLogCommand( "ImageMemoryBarrierCommand" );
 		//glLogCall( gl::MemoryBarrier, m_flags );
 	}
-
-	CommandPtr ImageMemoryBarrierCommand::clone()const
-	{
-		return std::make_unique< ImageMemoryBarrierCommand >( *this );
-	}
 }
@@ -25,7 +25,6 @@ namespace gl_renderer
 			, renderer::ImageMemoryBarrier const & transitionBarrier );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		GlMemoryBarrierFlags m_flags;
@@ -0,0 +1,55 @@
+/*
+This file belongs to GlRenderer.
+See LICENSE file in root folder.
+*/
+#include "GlMultiDrawCommand.hpp"
+
+#include <cstring>
+
+namespace gl_renderer
+{
+	namespace
+	{
+		void doAppend( DrawIndirectStorage & storage
+			, renderer::DrawIndirectCommand const & draw )
+		{
+			auto offset = storage.data.size();
+			storage.data.resize( offset + sizeof( draw ) );
+			std::memcpy( storage.data.data() + offset, &draw, sizeof( draw ) );
+			storage.dirty = true;
+		}
+	}
+
+	MultiDrawCommand::MultiDrawCommand( DrawIndirectStorage & storage
+		, renderer::DrawIndirectCommand const & first
+		, renderer::DrawIndirectCommand const & second
+		, GlPrimitiveTopology mode )
+		: m_storage{ storage }
+		, m_offset{ GLintptr( storage.data.size() ) }
+		, m_drawCount{ 2 }
+		, m_mode{ mode }
+	{
+		doAppend( storage, first );
+		doAppend( storage, second );
+	}
+
+	void MultiDrawCommand::addDraw( renderer::DrawIndirectCommand const & draw )
+	{
+		assert( m_storage.data.size() == m_offset + m_drawCount * sizeof( draw )
+			&& "Another draw has been recorded after this one" );
+		doAppend( m_storage, draw );
+		++m_drawCount;
+	}
+
+	void MultiDrawCommand::apply()const
+	{
+		glLogCommand( "MultiDrawCommand" );
+		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_DRAW_INDIRECT, m_storage.buffer );
+		glLogCall( gl::MultiDrawArraysIndirect
+			, m_mode
+			, BufferOffset( m_offset )
+			, m_drawCount
+			, 0 );
+		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_DRAW_INDIRECT, 0 );
+	}
+}
@@ -0,0 +1,80 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "GlCommandBase.hpp"
+
+#include <Miscellaneous/DrawIndirectCommand.hpp>
+
+namespace gl_renderer
+{
+	/**
+	*\brief
+	*	Les commandes de dessin indirect générées par le regroupement des dessins d'un tampon de commandes.
+	*/
+	struct DrawIndirectStorage
+	{
+		//! Les renderer::DrawIndirectCommand et renderer::DrawIndexedIndirectCommand, à la suite.
+		renderer::ByteArray data;
+		//! Le tampon GL_DRAW_INDIRECT_BUFFER contenant data, créé lors de la soumission.
+		GLuint buffer{ GL_INVALID_INDEX };
+		//! Dit si data a changé depuis la création de buffer.
+		bool dirty{ false };
+	};
+	/**
+	*\brief
+	*	Commande de dessins non indexés consécutifs, regroupés en un seul glMultiDrawArraysIndirect.
+	*\remarks
+	*	Générée par CommandBuffer lorsque des appels à draw se suivent sans autre commande entre eux,
+	*	ils partagent alors le pipeline, les descriptor sets, le VAO et les push constants.
+	*/
+	class MultiDrawCommand final
+		: public CommandBase
+	{
+	public:
+		/**
+		*\brief
+		*	Constructeur.
+		*\param[in,out] storage
+		*	Le stockage des commandes de dessin indirect du tampon de commandes.
+		*\param[in] first, second
+		*	Les deux premiers dessins du groupe.
+		*\param[in] mode
+		*	Le type de primitives.
+		*/
+		MultiDrawCommand( DrawIndirectStorage & storage
+			, renderer::DrawIndirectCommand const & first
+			, renderer::DrawIndirectCommand const & second
+			, GlPrimitiveTopology mode );
+		/**
+		*\brief
+		*	Ajoute un dessin au groupe.
+		*\remarks
+		*	Aucune autre commande ne doit avoir été enregistrée depuis la création de celle-ci.
+		*/
+		void addDraw( renderer::DrawIndirectCommand const & draw );
+		void apply()const override;
+		/**
+		*\return
+		*	Le type de primitives.
+		*/
+		inline GlPrimitiveTopology getMode()const
+		{
+			return m_mode;
+		}
+
+	private:
+		DrawIndirectStorage & m_storage;
+		GLintptr m_offset;
+		GLsizei m_drawCount;
+		GlPrimitiveTopology m_mode;
+	};
+
+	template<>
+	struct CommandTypeGetter< MultiDrawCommand >
+	{
+		static CommandType constexpr value = CommandType::eMultiDraw;
+	};
+}
@@ -0,0 +1,58 @@
+/*
+This file belongs to GlRenderer.
+See LICENSE file in root folder.
+*/
+#include "GlMultiDrawIndexedCommand.hpp"
+
+#include <cstring>
+
+namespace gl_renderer
+{
+	namespace
+	{
+		void doAppend( DrawIndirectStorage & storage
+			, renderer::DrawIndexedIndirectCommand const & draw )
+		{
+			auto offset = storage.data.size();
+			storage.data.resize( offset + sizeof( draw ) );
+			std::memcpy( storage.data.data() + offset, &draw, sizeof( draw ) );
+			storage.dirty = true;
+		}
+	}
+
+	MultiDrawIndexedCommand::MultiDrawIndexedCommand( DrawIndirectStorage & storage
+		, renderer::DrawIndexedIndirectCommand const & first
+		, renderer::DrawIndexedIndirectCommand const & second
+		, GlPrimitiveTopology mode
+		, GlIndexType type )
+		: m_storage{ storage }
+		, m_offset{ GLintptr( storage.data.size() ) }
+		, m_drawCount{ 2 }
+		, m_mode{ mode }
+		, m_type{ type }
+	{
+		doAppend( storage, first );
+		doAppend( storage, second );
+	}
+
+	void MultiDrawIndexedCommand::addDraw( renderer::DrawIndexedIndirectCommand const & draw )
+	{
+		assert( m_storage.data.size() == m_offset + m_drawCount * sizeof( draw )
+			&& "Another draw has been recorded after this one" );
+		doAppend( m_storage, draw );
+		++m_drawCount;
+	}
+
+	void MultiDrawIndexedCommand::apply()const
+	{
+		glLogCommand( "MultiDrawIndexedCommand" );
+		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_DRAW_INDIRECT, m_storage.buffer );
+		glLogCall( gl::MultiDrawElementsIndirect
+			, m_mode
+			, m_type
+			, BufferOffset( m_offset )
+			, m_drawCount
+			, 0 );
+		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_DRAW_INDIRECT, 0 );
+	}
+}
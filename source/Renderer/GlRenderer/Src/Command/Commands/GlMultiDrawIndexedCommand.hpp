@@ -0,0 +1,79 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "GlMultiDrawCommand.hpp"
+
+#include <Miscellaneous/DrawIndexedIndirectCommand.hpp>
+
+namespace gl_renderer
+{
+	/**
+	*\brief
+	*	Commande de dessins indexés consécutifs, regroupés en un seul glMultiDrawElementsIndirect.
+	*\remarks
+	*	Générée par CommandBuffer lorsque des appels à drawIndexed se suivent sans autre commande entre eux,
+	*	ils partagent alors le pipeline, les descriptor sets, le VAO et les push constants.
+	*/
+	class MultiDrawIndexedCommand final
+		: public CommandBase
+	{
+	public:
+		/**
+		*\brief
+		*	Constructeur.
+		*\param[in,out] storage
+		*	Le stockage des commandes de dessin indirect du tampon de commandes.
+		*\param[in] first, second
+		*	Les deux premiers dessins du groupe.
+		*\param[in] mode
+		*	Le type de primitives.
+		*\param[in] type
+		*	Le type des indices.
+		*/
+		MultiDrawIndexedCommand( DrawIndirectStorage & storage
+			, renderer::DrawIndexedIndirectCommand const & first
+			, renderer::DrawIndexedIndirectCommand const & second
+			, GlPrimitiveTopology mode
+			, GlIndexType type );
+		/**
+		*\brief
+		*	Ajoute un dessin au groupe.
+		*\remarks
+		*	Aucune autre commande ne doit avoir été enregistrée depuis la création de celle-ci.
+		*/
+		void addDraw( renderer::DrawIndexedIndirectCommand const & draw );
+		void apply()const override;
+		/**
+		*\return
+		*	Le type de primitives.
+		*/
+		inline GlPrimitiveTopology getMode()const
+		{
+			return m_mode;
+		}
+		/**
+		*\return
+		*	Le type des indices.
+		*/
+		inline GlIndexType getType()const
+		{
+			return m_type;
+		}
+
+	private:
+		DrawIndirectStorage & m_storage;
+		GLintptr m_offset;
+		GLsizei m_drawCount;
+		GlPrimitiveTopology m_mode;
+		GlIndexType m_type;
+	};
+
+	template<>
+	struct CommandTypeGetter< MultiDrawIndexedCommand >
+	{
+		static CommandType constexpr value = CommandType::eMultiDrawIndexed;
+	};
+}
@@ -29,9 +29,4 @@ namespace gl_renderer
 			m_frameBuffer.setDrawBuffers( m_subpass.colorAttachments );
 		}
 	}
-
-	CommandPtr NextSubpassCommand::clone()const
-	{
-		return std::make_unique< NextSubpassCommand >( *this );
-	}
 }
@@ -33,7 +33,6 @@ namespace gl_renderer
 			, renderer::SubpassDescription const & subpass );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		RenderPass const & m_renderPass;
@@ -96,9 +96,4 @@ namespace gl_renderer
 			buffer += getSize( constant.format );
 		}
 	}
-
-	CommandPtr PushConstantsCommand::clone()const
-	{
-		return std::make_unique< PushConstantsCommand >( *this );
-	}
 }
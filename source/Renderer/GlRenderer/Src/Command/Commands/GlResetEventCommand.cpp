@@ -19,9 +19,4 @@ namespace gl_renderer
 		glLogCommand( "ResetEventCommand" );
 		m_event.reset();
 	}
-
-	CommandPtr ResetEventCommand::clone()const
-	{
-		return std::make_unique< ResetEventCommand >( *this );
-	}
 }
@@ -20,6 +20,5 @@ namespace gl_renderer
 			, uint32_t firstQuery
 			, uint32_t queryCount );
 		void apply()const override;
-		CommandPtr clone()const override;
 	};
 }
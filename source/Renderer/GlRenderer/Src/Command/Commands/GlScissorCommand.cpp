@@ -30,9 +30,4 @@ namespace gl_renderer
 			save = m_scissor;
 		}
 	}
-
-	CommandPtr ScissorCommand::clone()const
-	{
-		return std::make_unique< ScissorCommand >( *this );
-	}
 }
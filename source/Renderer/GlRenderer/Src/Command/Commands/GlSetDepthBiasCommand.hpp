@@ -17,7 +17,6 @@ namespace gl_renderer
 			, float slopeFactor );
 
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		float m_constantFactor;
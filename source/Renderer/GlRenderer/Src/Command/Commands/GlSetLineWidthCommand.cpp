@@ -16,9 +16,4 @@ namespace gl_renderer
 		glLogCommand( "SetLineWidthCommand" );
 		glLogCall( gl::LineWidth, m_width );
 	}
-
-	CommandPtr SetLineWidthCommand::clone()const
-	{
-		return std::make_unique< SetLineWidthCommand >( *this );
-	}
 }
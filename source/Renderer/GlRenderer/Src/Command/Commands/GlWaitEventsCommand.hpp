@@ -18,7 +18,6 @@ namespace gl_renderer
 			, renderer::BufferMemoryBarrierArray const & bufferMemoryBarriers
 			, renderer::ImageMemoryBarrierArray const & imageMemoryBarriers );
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		renderer::EventCRefArray const & m_events;
@@ -20,9 +20,4 @@ namespace gl_renderer
 		glLogCommand( "WriteTimestampCommand" );
 		glLogCall( gl::QueryCounter, m_query, GL_QUERY_TYPE_TIMESTAMP );
 	}
-
-	CommandPtr WriteTimestampCommand::clone()const
-	{
-		return std::make_unique< WriteTimestampCommand >( *this );
-	}
 }
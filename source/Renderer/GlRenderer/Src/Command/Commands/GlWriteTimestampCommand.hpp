@@ -20,7 +20,6 @@ namespace gl_renderer
 			, renderer::QueryPool const & pool
 			, uint32_t query );
 		void apply()const override;
-		CommandPtr clone()const override;
 
 	private:
 		GLuint m_query;
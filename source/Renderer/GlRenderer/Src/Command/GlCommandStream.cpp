@@ -0,0 +1,153 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Command/GlCommandStream.hpp"
+
+#include "Commands/GlBindDescriptorSetCommand.hpp"
+#include "Commands/GlBindGeometryBuffersCommand.hpp"
+#include "Commands/GlBindPipelineCommand.hpp"
+#include "Commands/GlDrawCommand.hpp"
+#include "Commands/GlDrawIndexedCommand.hpp"
+#include "Commands/GlMultiDrawCommand.hpp"
+#include "Commands/GlMultiDrawIndexedCommand.hpp"
+#include "Commands/GlPushConstantsBufferCommand.hpp"
+#include "Commands/GlPushConstantsCommand.hpp"
+#include "Commands/GlScissorCommand.hpp"
+#include "Commands/GlViewportCommand.hpp"
+
+namespace gl_renderer
+{
+	CommandStream::~CommandStream()
+	{
+		clear();
+	}
+
+	void CommandStream::replay()const
+	{
+		doForEach( []( Header const & header )
+			{
+				auto & command = *header.command;
+
+				switch ( header.type )
+				{
+				case CommandType::eBindDescriptorSet:
+					static_cast< BindDescriptorSetCommand const & >( command ).apply();
+					break;
+				case CommandType::eBindGeometryBuffers:
+					static_cast< BindGeometryBuffersCommand const & >( command ).apply();
+					break;
+				case CommandType::eBindPipeline:
+					static_cast< BindPipelineCommand const & >( command ).apply();
+					break;
+				case CommandType::eDraw:
+					static_cast< DrawCommand const & >( command ).apply();
+					break;
+				case CommandType::eDrawIndexed:
+					static_cast< DrawIndexedCommand const & >( command ).apply();
+					break;
+				case CommandType::eMultiDraw:
+					static_cast< MultiDrawCommand const & >( command ).apply();
+					break;
+				case CommandType::eMultiDrawIndexed:
+					static_cast< MultiDrawIndexedCommand const & >( command ).apply();
+					break;
+				case CommandType::ePushConstants:
+					static_cast< PushConstantsCommand const & >( command ).apply();
+					break;
+				case CommandType::ePushConstantsBuffer:
+					static_cast< PushConstantsBufferCommand const & >( command ).apply();
+					break;
+				case CommandType::eScissor:
+					static_cast< ScissorCommand const & >( command ).apply();
+					break;
+				case CommandType::eViewport:
+					static_cast< ViewportCommand const & >( command ).apply();
+					break;
+				default:
+					command.apply();
+					break;
+				}
+			} );
+	}
+
+	void CommandStream::clear()
+	{
+		doForEach( []( Header const & header )
+			{
+				if ( header.destroy )
+				{
+					header.command->~CommandBase();
+				}
+			} );
+
+		for ( auto & chunk : m_chunks )
+		{
+			chunk.used = 0u;
+		}
+
+		m_last = nullptr;
+		m_current = 0u;
+		m_count = 0u;
+		m_genericCount = 0u;
+	}
+
+	void CommandStream::removeLast()
+	{
+		assert( m_last && "No command to remove" );
+
+		if ( m_last->destroy )
+		{
+			m_last->command->~CommandBase();
+		}
+
+		if ( m_last->type == CommandType::eGeneric )
+		{
+			--m_genericCount;
+		}
+
+		// The last command is always at the end of the current chunk.
+		m_chunks[m_current].used -= m_last->size;
+		--m_count;
+		m_last = nullptr;
+	}
+
+	void CommandStream::release()
+	{
+		clear();
+		m_chunks.clear();
+	}
+
+	uint8_t * CommandStream::doReserve( size_t size )
+	{
+		if ( !m_chunks.empty()
+			&& m_chunks[m_current].used + size > m_chunks[m_current].capacity )
+		{
+			++m_current;
+		}
+
+		if ( m_current == m_chunks.size()
+			|| m_chunks[m_current].capacity < size )
+		{
+			// The chunks after the current one are empty, so a new one can be inserted here.
+			auto capacity = std::max( ChunkSize, size );
+			m_chunks.insert( m_chunks.begin() + m_current
+				, Chunk{ std::make_unique< uint8_t[] >( capacity ), capacity, 0u } );
+		}
+
+		auto & chunk = m_chunks[m_current];
+		return chunk.data.get() + chunk.used;
+	}
+
+	void CommandStream::doCommit( size_t size
+		, CommandType type )
+	{
+		m_chunks[m_current].used += size;
+		++m_count;
+
+		if ( type == CommandType::eGeneric )
+		{
+			++m_genericCount;
+		}
+	}
+}
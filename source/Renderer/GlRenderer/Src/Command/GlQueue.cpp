@@ -5,16 +5,18 @@ See LICENSE file in root folder.
 #include "Command/GlQueue.hpp"
 
 #include "Command/GlCommandBuffer.hpp"
+#include "Command/GlCommandStream.hpp"
 #include "Core/GlDevice.hpp"
+#include "Core/GlSubmissionThread.hpp"
 #include "Sync/GlFence.hpp"
 #include "Sync/GlSemaphore.hpp"
 #include "Core/GlSwapChain.hpp"
-#include "Commands/GlCommandBase.hpp"
 
 namespace gl_renderer
 {
 	Queue::Queue( Device const & device )
 		: renderer::Queue{ device }
+		, m_device{ device }
 	{
 	}
 
@@ -24,17 +26,19 @@ namespace gl_renderer
 		, renderer::SemaphoreCRefArray const & semaphoresToSignal
 		, renderer::Fence const * fence )const
 	{
-		for ( auto & commandBuffer : commandBuffers )
-		{
-			auto & glCommandBuffer = static_cast< CommandBuffer const & >( commandBuffer.get() );
-			glCommandBuffer.initialiseGeometryBuffers();
-
-			for ( auto & command : glCommandBuffer.getCommands() )
-			{
-				command->apply();
-			}
+		auto thread = m_device.getSubmissionThread();
 
-			glCommandBuffer.applyPostSubmitActions();
+		if ( thread && !thread->isCurrentThread() )
+		{
+			// The semaphores are honoured by the submission order, the thread executing the jobs in sequence.
+			thread->post( [commandBuffers, fence]()
+				{
+					doSubmit( commandBuffers, fence );
+				} );
+		}
+		else
+		{
+			doSubmit( commandBuffers, fence );
 		}
 	}
 
@@ -48,4 +52,24 @@ namespace gl_renderer
 	{
 		glLogCall( gl::Finish );
 	}
+
+	void Queue::doSubmit( renderer::CommandBufferCRefArray const & commandBuffers
+		, renderer::Fence const * fence )
+	{
+		for ( auto & commandBuffer : commandBuffers )
+		{
+			auto & glCommandBuffer = static_cast< CommandBuffer const & >( commandBuffer.get() );
+			glCommandBuffer.initialiseGeometryBuffers();
+			glCommandBuffer.uploadBuffers();
+
+			glCommandBuffer.getCommands().replay();
+
+			glCommandBuffer.applyPostSubmitActions();
+		}
+
+		if ( fence )
+		{
+			static_cast< Fence const * >( fence )->insert();
+		}
+	}
 }
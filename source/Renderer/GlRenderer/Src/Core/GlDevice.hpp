@@ -133,6 +133,14 @@ namespace gl_renderer
 		*/
 		void waitIdle()const override;
 		/**
+		*\copydoc	renderer::Device::setCallTracing
+		*/
+		void setCallTracing( bool enable )const override;
+		/**
+		*\copydoc	renderer::Device::flushCallTrace
+		*/
+		void flushCallTrace( std::string const & fileName )const override;
+		/**
 		*\brief
 		*	Echange les tampons.
 		*/
@@ -182,6 +190,129 @@ namespace gl_renderer
 		{
 			return m_currentProgram;
 		}
+		/**
+		*\brief
+		*	Active une texture sur une unité de texture, si elle n'y est pas déjà.
+		*\param[in] unit
+		*	L'unité de texture.
+		*\param[in] target
+		*	La cible de la texture.
+		*\param[in] name
+		*	Le nom de la texture.
+		*/
+		void bindTexture( uint32_t unit
+			, GLenum target
+			, GLuint name )const;
+		/**
+		*\brief
+		*	Active un échantillonneur sur une unité de texture, s'il n'y est pas déjà.
+		*\param[in] unit
+		*	L'unité de texture.
+		*\param[in] name
+		*	Le nom de l'échantillonneur.
+		*/
+		void bindSampler( uint32_t unit
+			, GLuint name )const;
+		/**
+		*\brief
+		*	Active un intervalle de tampon sur un point d'attache indexé, s'il n'y est pas déjà.
+		*\param[in] target
+		*	La cible (GL_BUFFER_TARGET_UNIFORM ou GL_BUFFER_TARGET_SHADER_STORAGE).
+		*\param[in] index
+		*	L'indice du point d'attache.
+		*\param[in] name
+		*	Le nom du tampon.
+		*\param[in] offset, range
+		*	L'intervalle du tampon.
+		*/
+		void bindBufferRange( GlBufferTarget target
+			, uint32_t index
+			, GLuint name
+			, GLintptr offset
+			, GLsizeiptr range )const;
+		/**
+		*\brief
+		*	Active une image sur une unité d'image, si elle n'y est pas déjà.
+		*/
+		void bindImageTexture( uint32_t unit
+			, GLuint name
+			, GLint level
+			, GLboolean layered
+			, GLint layer
+			, GLenum access
+			, GLenum format )const;
+		/**
+		*\brief
+		*	Active des textures sur des unités de texture consécutives.
+		*\remarks
+		*	Utilise glBindTextures si ARB_multi_bind est disponible.
+		*	Aucun appel n'est fait si toutes les unités ont déjà la bonne texture.
+		*\param[in] first
+		*	La première unité de texture.
+		*\param[in] count
+		*	Le nombre d'unités.
+		*\param[in] targets, names
+		*	Les cibles et noms des textures, \p count éléments chacun.
+		*/
+		void bindTextures( uint32_t first
+			, uint32_t count
+			, GLenum const * targets
+			, GLuint const * names )const;
+		/**
+		*\brief
+		*	Active des échantillonneurs sur des unités de texture consécutives.
+		*\remarks
+		*	Utilise glBindSamplers si ARB_multi_bind est disponible.
+		*/
+		void bindSamplers( uint32_t first
+			, uint32_t count
+			, GLuint const * names )const;
+		/**
+		*\brief
+		*	Active des intervalles de tampons sur des points d'attache indexés consécutifs.
+		*\remarks
+		*	Utilise glBindBuffersRange si ARB_multi_bind est disponible.
+		*/
+		void bindBuffersRange( GlBufferTarget target
+			, uint32_t first
+			, uint32_t count
+			, GLuint const * names
+			, GLintptr const * offsets
+			, GLsizeiptr const * ranges )const;
+		/**
+		*\brief
+		*	Active des images entières (niveau 0, toutes les couches) sur des unités d'image consécutives.
+		*\remarks
+		*	Utilise glBindImageTextures si ARB_multi_bind est disponible.
+		*\param[in] formats
+		*	Les formats internes des textures, utilisés par le cache et lorsque ARB_multi_bind n'est pas disponible.
+		*/
+		void bindImageTextures( uint32_t first
+			, uint32_t count
+			, GLuint const * names
+			, GLenum const * formats )const;
+		/**
+		*\brief
+		*	Invalide le cache de l'unité de texture active.
+		*\remarks
+		*	A appeler après un BindTexture fait hors du cache, sur l'unité active.
+		*/
+		void invalidateActiveTextureUnit()const;
+		/**
+		*\brief
+		*	Retire une texture détruite du cache des unités de texture et d'image.
+		*/
+		void onTextureDeleted( GLuint name )const;
+		/**
+		*\brief
+		*	Retire un échantillonneur détruit du cache des unités de texture.
+		*/
+		void onSamplerDeleted( GLuint name )const;
+		/**
+		*\brief
+		*	Retire un tampon détruit du cache des points d'attache indexés.
+		*/
+		void onBufferDeleted( GLuint name )const;
 
 		inline GeometryBuffers & getEmptyIndexedVao()const
 		{
@@ -202,6 +333,36 @@ namespace gl_renderer
 		{
 			return m_blitFbos[1];
 		}
+		/**
+		*\brief
+		*	Le point d'attache de tampon uniforme réservé au bloc "PushConstants".
+		*\remarks
+		*	C'est le dernier point d'attache disponible (GL_MAX_UNIFORM_BUFFER_BINDINGS - 1),
+		*	les descriptor sets ne doivent donc pas l'utiliser.
+		*/
+		inline GLuint getPushConstantsBinding()const
+		{
+			return m_pushConstantsBinding;
+		}
+		/**
+		*\return
+		*	Le thread de soumission, en mode de soumission asynchrone, \p nullptr sinon.
+		*\remarks
+		*	Dans ce mode, le contexte n'est actif que sur ce thread :
+		*	Device::enable y redirige alors les appels OpenGL du thread appelant.
+		*/
+		inline SubmissionThread * getSubmissionThread()const
+		{
+			return m_submissionThread.get();
+		}
+		/**
+		*\return
+		*	L'allocateur des petits tampons, si la sous-allocation des tampons est activée, \p nullptr sinon.
+		*/
+		inline BufferAllocator * getBufferAllocator()const
+		{
+			return m_bufferAllocator.get();
+		}
 
 	private:
 		/**
@@ -212,6 +373,10 @@ namespace gl_renderer
 		*\copydoc	renderer::Device::disable
 		*/
 		void doDisable()const override;
+		/**
+		*\copydoc	renderer::Device::doFillMemoryStatistics
+		*/
+		void doFillMemoryStatistics( renderer::MemoryStatistics & statistics )const override;
 
 	private:
 		ContextPtr m_context;
@@ -237,6 +402,38 @@ namespace gl_renderer
 		mutable renderer::TessellationState m_tsState;
 		mutable renderer::InputAssemblyState m_iaState;
 		mutable GLuint m_currentProgram;
+		// Cache des unités de texture, d'image et des points d'attache de tampons.
+		// GL_INVALID_INDEX signifie que l'état du contexte est inconnu.
+		struct TextureUnitBinding
+		{
+			GLenum target{ 0u };
+			GLuint texture{ GL_INVALID_INDEX };
+			GLuint sampler{ GL_INVALID_INDEX };
+		};
+		struct BufferRangeBinding
+		{
+			GLuint buffer{ GL_INVALID_INDEX };
+			GLintptr offset{ 0 };
+			GLsizeiptr range{ 0 };
+		};
+		struct ImageUnitBinding
+		{
+			GLuint texture{ GL_INVALID_INDEX };
+			GLint level{ 0 };
+			GLboolean layered{ 0u };
+			GLint layer{ 0 };
+			GLenum access{ 0u };
+			GLenum format{ 0u };
+		};
+		mutable GLuint m_activeTextureUnit{ GL_INVALID_INDEX };
+		mutable std::vector< TextureUnitBinding > m_textureUnits;
+		mutable std::vector< ImageUnitBinding > m_imageUnits;
+		mutable std::vector< BufferRangeBinding > m_uniformBuffers;
+		mutable std::vector< BufferRangeBinding > m_storageBuffers;
+		bool m_hasMultiBind;
+		GLuint m_pushConstantsBinding{ 0u };
+		std::unique_ptr< SubmissionThread > m_submissionThread;
+		std::unique_ptr< BufferAllocator > m_bufferAllocator;
 		GLuint m_blitFbos[2];
 	};
 }
@@ -325,6 +325,8 @@ namespace gl_renderer
 		m_features.hasBaseInstance = gpu.find( "GL_ARB_base_instance" );
 		m_features.hasClearTexImage = gpu.find( "GL_ARB_clear_texture" );
 		m_features.hasComputeShaders = gpu.find( "GL_ARB_compute_shader" );
+		m_features.hasPersistentMapping = gpu.find( "GL_ARB_buffer_storage" );
+		m_features.hasMemoryAliasing = false;
 	}
 
 	renderer::DevicePtr Renderer::createDevice( renderer::ConnectionPtr && connection )const
@@ -21,7 +21,7 @@ namespace gl_renderer
 		, m_device{ device }
 	{
 		m_format = renderer::Format::eR8G8B8A8_UNORM;
-		m_renderingResources.emplace_back( std::make_unique< renderer::RenderingResources >( device ) );
+		m_renderingResources.emplace_back( std::make_unique< renderer::RenderingResources >( device, 0u ) );
 		doCreateBackBuffers();
 	}
 
@@ -1,9 +1,11 @@
 #include "Descriptor/GlDescriptorSet.hpp"
 
 #include "Buffer/GlBuffer.hpp"
+#include "Buffer/GlBufferView.hpp"
 #include "Descriptor/GlDescriptorPool.hpp"
 #include "Image/GlSampler.hpp"
 #include "Image/GlTexture.hpp"
+#include "Image/GlTextureView.hpp"
 #include "Buffer/GlUniformBuffer.hpp"
 
 #include <Descriptor/DescriptorSetLayoutBinding.hpp>
@@ -12,6 +14,93 @@
 
 namespace gl_renderer
 {
+	namespace
+	{
+		struct TextureValue
+		{
+			GLenum target;
+			GLuint name;
+		};
+
+		struct ImageValue
+		{
+			GLuint name;
+			GLenum format;
+		};
+
+		struct BufferValue
+		{
+			GLuint name;
+			GLintptr offset;
+			GLsizeiptr range;
+		};
+
+		template< typename ValueT >
+		using UnitValueArray = std::vector< std::pair< uint32_t, ValueT > >;
+
+		template< typename ValueT, typename BindingsT, typename AddFuncT >
+		void doGroupByUnit( UnitValueArray< ValueT > & values
+			, std::vector< BindingsT > & result
+			, AddFuncT add )
+		{
+			result.clear();
+			std::stable_sort( values.begin()
+				, values.end()
+				, []( std::pair< uint32_t, ValueT > const & lhs
+					, std::pair< uint32_t, ValueT > const & rhs )
+				{
+					return lhs.first < rhs.first;
+				} );
+
+			for ( auto & value : values )
+			{
+				if ( result.empty()
+					|| result.back().first + result.back().names.size() != value.first )
+				{
+					result.push_back( BindingsT{ value.first } );
+				}
+
+				add( result.back(), value.second );
+			}
+		}
+
+		void doAddBuffers( renderer::WriteDescriptorSet const & write
+			, UnitValueArray< BufferValue > & buffers )
+		{
+			for ( auto i = 0u; i < write.bufferInfo.size(); ++i )
+			{
+				auto & info = write.bufferInfo[i];
+				buffers.push_back( { write.dstBinding + write.dstArrayElement + i
+					, BufferValue
+					{
+						static_cast< Buffer const & >( info.buffer.get() ).getBuffer(),
+						GLintptr( info.offset ) + static_cast< Buffer const & >( info.buffer.get() ).getOffset(),
+						GLsizeiptr( info.range ),
+					} } );
+			}
+		}
+
+		void doAddBuffers( renderer::WriteDescriptorSetArray const & writes
+			, std::vector< DescriptorSet::BufferBindings > & result )
+		{
+			UnitValueArray< BufferValue > buffers;
+
+			for ( auto & write : writes )
+			{
+				doAddBuffers( write, buffers );
+			}
+
+			doGroupByUnit( buffers
+				, result
+				, []( DescriptorSet::BufferBindings & bindings, BufferValue const & value )
+				{
+					bindings.names.push_back( value.name );
+					bindings.offsets.push_back( value.offset );
+					bindings.ranges.push_back( value.range );
+				} );
+		}
+	}
+
 	DescriptorSet::DescriptorSet( renderer::DescriptorPool const & pool
 		, renderer::DescriptorSetLayout const & layout
 		, uint32_t bindingPoint )
@@ -80,5 +169,111 @@ namespace gl_renderer
 		{
 			return lhs.dstBinding < rhs.dstBinding;
 		} );
+
+		doBuildBindings();
+	}
+
+	void DescriptorSet::doBuildBindings()const
+	{
+		UnitValueArray< TextureValue > textures;
+		UnitValueArray< GLuint > samplers;
+		UnitValueArray< ImageValue > images;
+
+		for ( auto & write : m_combinedTextureSamplers )
+		{
+			for ( auto i = 0u; i < write.imageInfo.size(); ++i )
+			{
+				uint32_t bindingIndex = write.dstBinding + write.dstArrayElement + i;
+				auto & view = static_cast< TextureView const & >( write.imageInfo[i].imageView.value().get() );
+				auto & sampler = static_cast< Sampler const & >( write.imageInfo[i].sampler.value().get() );
+				textures.push_back( { bindingIndex, TextureValue{ GLenum( convert( view.getType() ) ), view.getImage() } } );
+				samplers.push_back( { bindingIndex, sampler.getSampler() } );
+			}
+		}
+
+		for ( auto & write : m_samplers )
+		{
+			for ( auto i = 0u; i < write.imageInfo.size(); ++i )
+			{
+				auto & sampler = static_cast< Sampler const & >( write.imageInfo[i].sampler.value().get() );
+				samplers.push_back( { write.dstBinding + write.dstArrayElement + i, sampler.getSampler() } );
+			}
+		}
+
+		for ( auto & write : m_sampledTextures )
+		{
+			for ( auto i = 0u; i < write.imageInfo.size(); ++i )
+			{
+				auto & view = static_cast< TextureView const & >( write.imageInfo[i].imageView.value().get() );
+				textures.push_back( { write.dstBinding + write.dstArrayElement + i
+					, TextureValue{ GLenum( convert( view.getType() ) ), view.getImage() } } );
+			}
+		}
+
+		for ( auto & write : m_texelBuffers )
+		{
+			for ( auto i = 0u; i < write.texelBufferView.size(); ++i )
+			{
+				auto & view = static_cast< BufferView const & >( write.texelBufferView[i].get() );
+				textures.push_back( { write.dstBinding + write.dstArrayElement + i
+					, TextureValue{ GLenum( GL_BUFFER_TARGET_TEXTURE ), view.getImage() } } );
+			}
+		}
+
+		for ( auto & write : m_storageTextures )
+		{
+			for ( auto i = 0u; i < write.imageInfo.size(); ++i )
+			{
+				auto & view = static_cast< TextureView const & >( write.imageInfo[i].imageView.value().get() );
+				images.push_back( { write.dstBinding + write.dstArrayElement + i
+					, ImageValue{ view.getImage(), GLenum( getInternal( view.getFormat() ) ) } } );
+			}
+		}
+
+		doGroupByUnit( textures
+			, m_textureBindings
+			, []( TextureBindings & bindings, TextureValue const & value )
+			{
+				bindings.targets.push_back( value.target );
+				bindings.names.push_back( value.name );
+			} );
+		doGroupByUnit( samplers
+			, m_samplerBindings
+			, []( SamplerBindings & bindings, GLuint value )
+			{
+				bindings.names.push_back( value );
+			} );
+		doGroupByUnit( images
+			, m_imageBindings
+			, []( ImageBindings & bindings, ImageValue const & value )
+			{
+				bindings.names.push_back( value.name );
+				bindings.formats.push_back( value.format );
+			} );
+		doAddBuffers( m_uniformBuffers, m_uniformBufferBindings );
+		doAddBuffers( m_storageBuffers, m_storageBufferBindings );
+		m_dynamicBufferBindings.clear();
+
+		for ( auto index = 0u; index < m_dynamicBuffers.size(); ++index )
+		{
+			auto & write = m_dynamicBuffers[index];
+			auto target = write.descriptorType == renderer::DescriptorType::eUniformBufferDynamic
+				? GL_BUFFER_TARGET_UNIFORM
+				: GL_BUFFER_TARGET_SHADER_STORAGE;
+
+			for ( auto i = 0u; i < write.bufferInfo.size(); ++i )
+			{
+				auto & info = write.bufferInfo[i];
+				m_dynamicBufferBindings.push_back(
+				{
+					target,
+					write.dstBinding + write.dstArrayElement + i,
+					static_cast< Buffer const & >( info.buffer.get() ).getBuffer(),
+					GLintptr( info.offset ) + static_cast< Buffer const & >( info.buffer.get() ).getOffset(),
+					GLsizeiptr( info.range ),
+					index,
+				} );
+			}
+		}
 	}
 }
@@ -23,6 +23,62 @@ namespace gl_renderer
 	class DescriptorSet
 		: public renderer::DescriptorSet
 	{
+	public:
+		/**
+		*\brief
+		*	Textures à activer sur des unités de texture consécutives, à partir de \p first.
+		*/
+		struct TextureBindings
+		{
+			uint32_t first;
+			std::vector< GLenum > targets;
+			std::vector< GLuint > names;
+		};
+		/**
+		*\brief
+		*	Echantillonneurs à activer sur des unités de texture consécutives, à partir de \p first.
+		*/
+		struct SamplerBindings
+		{
+			uint32_t first;
+			std::vector< GLuint > names;
+		};
+		/**
+		*\brief
+		*	Images à activer sur des unités d'image consécutives, à partir de \p first.
+		*/
+		struct ImageBindings
+		{
+			uint32_t first;
+			std::vector< GLuint > names;
+			std::vector< GLenum > formats;
+		};
+		/**
+		*\brief
+		*	Intervalles de tampons à activer sur des points d'attache consécutifs, à partir de \p first.
+		*/
+		struct BufferBindings
+		{
+			uint32_t first;
+			std::vector< GLuint > names;
+			std::vector< GLintptr > offsets;
+			std::vector< GLsizeiptr > ranges;
+		};
+		/**
+		*\brief
+		*	Tampon dynamique, dont le décalage final est connu à l'activation du set.
+		*/
+		struct DynamicBufferBinding
+		{
+			GlBufferTarget target;
+			uint32_t unit;
+			GLuint name;
+			GLintptr offset;
+			GLsizeiptr range;
+			//! L'indice du décalage dynamique à ajouter à offset.
+			uint32_t dynamicIndex;
+		};
+
 	public:
 		/**
 		*\~french
@@ -111,6 +167,57 @@ namespace gl_renderer
 		{
 			return m_dynamicBuffers;
 		}
+		/**
+		*\brief
+		*	Les textures (combinées, échantillonnées et tampons de texels), regroupées par unités consécutives.
+		*/
+		inline std::vector< TextureBindings > const & getTextureBindings()const
+		{
+			return m_textureBindings;
+		}
+		/**
+		*\brief
+		*	Les échantillonneurs (combinés ou non), regroupés par unités consécutives.
+		*/
+		inline std::vector< SamplerBindings > const & getSamplerBindings()const
+		{
+			return m_samplerBindings;
+		}
+		/**
+		*\brief
+		*	Les textures de stockage, regroupées par unités consécutives.
+		*/
+		inline std::vector< ImageBindings > const & getImageBindings()const
+		{
+			return m_imageBindings;
+		}
+		/**
+		*\brief
+		*	Les tampons uniformes, regroupés par points d'attache consécutifs.
+		*/
+		inline std::vector< BufferBindings > const & getUniformBufferBindings()const
+		{
+			return m_uniformBufferBindings;
+		}
+		/**
+		*\brief
+		*	Les tampons de stockage, regroupés par points d'attache consécutifs.
+		*/
+		inline std::vector< BufferBindings > const & getStorageBufferBindings()const
+		{
+			return m_storageBufferBindings;
+		}
+		/**
+		*\brief
+		*	Les tampons dynamiques, triés par point d'attache.
+		*/
+		inline std::vector< DynamicBufferBinding > const & getDynamicBufferBindings()const
+		{
+			return m_dynamicBufferBindings;
+		}
+
+	private:
+		void doBuildBindings()const;
 
 	private:
 		mutable renderer::WriteDescriptorSetArray m_combinedTextureSamplers;
@@ -123,6 +230,12 @@ namespace gl_renderer
 		mutable renderer::WriteDescriptorSetArray m_dynamicUniformBuffers;
 		mutable renderer::WriteDescriptorSetArray m_dynamicStorageBuffers;
 		mutable renderer::WriteDescriptorSetArray m_dynamicBuffers;
+		mutable std::vector< TextureBindings > m_textureBindings;
+		mutable std::vector< SamplerBindings > m_samplerBindings;
+		mutable std::vector< ImageBindings > m_imageBindings;
+		mutable std::vector< BufferBindings > m_uniformBufferBindings;
+		mutable std::vector< BufferBindings > m_storageBufferBindings;
+		mutable std::vector< DynamicBufferBinding > m_dynamicBufferBindings;
 	};
 }
 
@@ -6,6 +6,9 @@ namespace gl_renderer
 	{
 		switch ( value )
 		{
+		case gl_renderer::GL_MAX_UNIFORM_BUFFER_BINDINGS:
+			return "GL_MAX_UNIFORM_BUFFER_BINDINGS";
+
 		case gl_renderer::GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT:
 			return "GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT";
 
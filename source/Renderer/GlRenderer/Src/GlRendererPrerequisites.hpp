@@ -70,8 +70,11 @@ namespace gl_renderer
 	struct AttachmentDescription;
 
 	class Buffer;
+	class BufferAllocator;
 	class BufferView;
 	class CommandBase;
+	class CommandBuffer;
+	class CommandStream;
 	class ComputePipeline;
 	class Context;
 	class DescriptorSet;
@@ -86,11 +89,11 @@ namespace gl_renderer
 	class RenderPass;
 	class ShaderModule;
 	class ShaderProgram;
+	class SubmissionThread;
 	class Texture;
 	class TextureView;
 
 	using ContextPtr = std::unique_ptr< Context >;
-	using CommandPtr = std::unique_ptr< CommandBase >;
 	using GeometryBuffersPtr = std::unique_ptr< GeometryBuffers >;
 	using TextureViewPtr = std::unique_ptr< TextureView >;
 
@@ -102,7 +105,6 @@ namespace gl_renderer
 
 	using ShaderModuleCRefArray = std::vector< ShaderModuleCRef >;
 
-	using CommandArray = std::vector< CommandPtr >;
 	using AttachmentDescriptionArray = std::vector< AttachmentDescription >;
 
 	struct BufferObjectBinding
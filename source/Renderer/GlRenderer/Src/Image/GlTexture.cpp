@@ -79,7 +79,8 @@ namespace gl_renderer
 			, format
 			, { dimensions.width, dimensions.height, 1u }
 			, 1u
-			, 1u }
+			, 1u
+			, renderer::ImageUsageFlag::eColourAttachment }
 		, m_device{ device }
 		, m_createInfo{ 
 			0u,
@@ -103,7 +104,8 @@ namespace gl_renderer
 			, createInfo.format
 			, createInfo.extent
 			, createInfo.mipLevels
-			, createInfo.arrayLayers }
+			, createInfo.arrayLayers
+			, createInfo.usage }
 		, m_device{ device }
 		, m_target{ convert( createInfo.imageType, createInfo.arrayLayers, createInfo.samples ) }
 		, m_createInfo{ createInfo }
@@ -114,6 +116,7 @@ namespace gl_renderer
 	Texture::~Texture()
 	{
 		m_storage.reset();
+		m_device.onTextureDeleted( m_texture );
 		glLogCall( gl::DeleteTextures, 1, &m_texture );
 	}
 
@@ -145,6 +148,7 @@ namespace gl_renderer
 
 	void Texture::doBindMemory()
 	{
+		assert( m_storageOffset == 0u && "OpenGL textures can't share their memory" );
 		static_cast< DeviceMemory & >( *m_storage ).bindToImage( *this, m_target, m_createInfo );
 	}
 }
@@ -95,22 +95,24 @@ namespace gl_renderer
 		}
 
 		int minLevel = 0;
-		gl::GetTexParameteriv( m_target, GL_TEXTURE_VIEW_MIN_LEVEL, &minLevel );
+		glLogCall( gl::GetTexParameteriv, m_target, GL_TEXTURE_VIEW_MIN_LEVEL, &minLevel );
 		assert( minLevel == m_createInfo.subresourceRange.baseMipLevel );
 		int numLevels = 0;
-		gl::GetTexParameteriv( m_target, GL_TEXTURE_VIEW_NUM_LEVELS, &numLevels );
+		glLogCall( gl::GetTexParameteriv, m_target, GL_TEXTURE_VIEW_NUM_LEVELS, &numLevels );
 		assert( numLevels == m_createInfo.subresourceRange.levelCount );
 		int minLayer = 0;
-		gl::GetTexParameteriv( m_target, GL_TEXTURE_VIEW_MIN_LAYER, &minLayer );
+		glLogCall( gl::GetTexParameteriv, m_target, GL_TEXTURE_VIEW_MIN_LAYER, &minLayer );
 		assert( minLayer == m_createInfo.subresourceRange.baseArrayLayer );
 		int numLayers = 0;
-		gl::GetTexParameteriv( m_target, GL_TEXTURE_VIEW_NUM_LAYERS, &numLayers );
+		glLogCall( gl::GetTexParameteriv, m_target, GL_TEXTURE_VIEW_NUM_LAYERS, &numLayers );
 		assert( numLayers == m_createInfo.subresourceRange.layerCount );
 		glLogCall( gl::BindTexture, m_target, 0u );
+		m_device.invalidateActiveTextureUnit();
 	}
 
 	TextureView::~TextureView()
 	{
+		m_device.onTextureDeleted( m_texture );
 		glLogCall( gl::DeleteTextures, 1, &m_texture );
 	}
 
@@ -0,0 +1,290 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Miscellaneous/GlBufferAllocator.hpp"
+
+#include "Core/GlDevice.hpp"
+
+#include <algorithm>
+#include <map>
+
+namespace gl_renderer
+{
+	struct BufferPage
+	{
+		GLuint name{ GL_INVALID_INDEX };
+		renderer::MemoryPropertyFlags flags;
+		GlMemoryMapFlags mapFlags{ 0u };
+		// The free ranges, sorted by offset.
+		std::map< GLintptr, GLsizeiptr > freeRanges;
+		GLsizeiptr freeSize{ 0 };
+		uint8_t * mapped{ nullptr };
+		uint32_t mapCount{ 0u };
+	};
+
+	namespace
+	{
+		GLsizeiptr getAlignedSize( GLsizeiptr size )
+		{
+			return ( ( std::max( size, GLsizeiptr( 1 ) ) + BufferAllocator::Alignment - 1 ) / BufferAllocator::Alignment ) * BufferAllocator::Alignment;
+		}
+
+		bool isEmpty( BufferPage const & page )
+		{
+			return page.freeSize == BufferAllocator::PageSize;
+		}
+
+		bool doAllocateRange( BufferPage & page
+			, GLsizeiptr size
+			, GLintptr & offset )
+		{
+			auto it = std::find_if( page.freeRanges.begin()
+				, page.freeRanges.end()
+				, [size]( std::pair< GLintptr const, GLsizeiptr > const & range )
+				{
+					return range.second >= size;
+				} );
+
+			if ( it == page.freeRanges.end() )
+			{
+				return false;
+			}
+
+			offset = it->first;
+			auto remaining = it->second - size;
+			page.freeRanges.erase( it );
+
+			if ( remaining )
+			{
+				page.freeRanges.emplace( offset + size, remaining );
+			}
+
+			page.freeSize -= size;
+			return true;
+		}
+
+		void doDeallocateRange( BufferPage & page
+			, GLintptr offset
+			, GLsizeiptr size )
+		{
+			page.freeSize += size;
+			auto next = page.freeRanges.lower_bound( offset );
+
+			// Merge with the following free range.
+			if ( next != page.freeRanges.end()
+				&& next->first == offset + size )
+			{
+				size += next->second;
+				next = page.freeRanges.erase( next );
+			}
+
+			// Merge with the preceding free range.
+			if ( next != page.freeRanges.begin() )
+			{
+				auto previous = std::prev( next );
+
+				if ( previous->first + previous->second == offset )
+				{
+					previous->second += size;
+					return;
+				}
+			}
+
+			page.freeRanges.emplace_hint( next, offset, size );
+		}
+	}
+
+	BufferAllocator::BufferAllocator( Device const & device )
+		: m_device{ device }
+	{
+	}
+
+	BufferAllocator::~BufferAllocator()
+	{
+		for ( auto & page : m_pages )
+		{
+			if ( page->mapCount )
+			{
+				glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_COPY_WRITE, page->name );
+				glLogCall( gl::UnmapBuffer, GL_BUFFER_TARGET_COPY_WRITE );
+				glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_COPY_WRITE, 0u );
+			}
+
+			m_device.onBufferDeleted( page->name );
+			glLogCall( gl::DeleteBuffers, 1, &page->name );
+		}
+	}
+
+	BufferAllocation BufferAllocator::allocate( GLsizeiptr size
+		, renderer::MemoryPropertyFlags flags )
+	{
+		assert( isSuballocable( uint64_t( size ) ) );
+		auto alignedSize = getAlignedSize( size );
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		GLintptr offset{ 0 };
+
+		for ( auto & page : m_pages )
+		{
+			if ( page->flags == flags
+				&& page->freeSize >= alignedSize
+				&& doAllocateRange( *page, alignedSize, offset ) )
+			{
+				++m_allocationCount;
+				m_allocatedSize += uint64_t( size );
+				return { page.get(), page->name, offset, size };
+			}
+		}
+
+		auto page = doCreatePage( flags );
+		doAllocateRange( *page, alignedSize, offset );
+		++m_allocationCount;
+		m_allocatedSize += uint64_t( size );
+		return { page, page->name, offset, size };
+	}
+
+	void BufferAllocator::deallocate( BufferAllocation const & allocation )
+	{
+		assert( allocation.page );
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		auto & page = *allocation.page;
+		doDeallocateRange( page
+			, allocation.offset
+			, getAlignedSize( allocation.size ) );
+		--m_allocationCount;
+		m_allocatedSize -= uint64_t( allocation.size );
+
+		// Only one empty page is kept per memory properties, to avoid recreating one for each new buffer.
+		if ( isEmpty( page )
+			&& std::count_if( m_pages.begin()
+				, m_pages.end()
+				, [&page]( std::unique_ptr< BufferPage > const & lookup )
+				{
+					return lookup->flags == page.flags
+						&& isEmpty( *lookup );
+				} ) > 1 )
+		{
+			doDestroyPage( page );
+		}
+	}
+
+	uint8_t * BufferAllocator::map( BufferAllocation const & allocation )
+	{
+		assert( allocation.page );
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		auto & page = *allocation.page;
+
+		if ( !page.mapCount )
+		{
+			glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_COPY_WRITE, page.name );
+			auto result = glLogCall( gl::MapBufferRange
+				, GL_BUFFER_TARGET_COPY_WRITE
+				, 0
+				, PageSize
+				, page.mapFlags );
+			glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_COPY_WRITE, 0u );
+			page.mapped = reinterpret_cast< uint8_t * >( result );
+
+			if ( !page.mapped )
+			{
+				return nullptr;
+			}
+		}
+
+		++page.mapCount;
+		return page.mapped + allocation.offset;
+	}
+
+	void BufferAllocator::flush( BufferAllocation const & allocation
+		, GLintptr offset
+		, GLsizeiptr size )
+	{
+		assert( allocation.page );
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		auto & page = *allocation.page;
+		assert( page.mapCount );
+		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_COPY_WRITE, page.name );
+		glLogCall( gl::FlushMappedBufferRange
+			, GL_BUFFER_TARGET_COPY_WRITE
+			, allocation.offset + offset
+			, std::min( size, allocation.size - offset ) );
+		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_COPY_WRITE, 0u );
+	}
+
+	void BufferAllocator::unmap( BufferAllocation const & allocation )
+	{
+		assert( allocation.page );
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		auto & page = *allocation.page;
+		assert( page.mapCount );
+
+		if ( !--page.mapCount )
+		{
+			glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_COPY_WRITE, page.name );
+			glLogCall( gl::UnmapBuffer, GL_BUFFER_TARGET_COPY_WRITE );
+			glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_COPY_WRITE, 0u );
+			page.mapped = nullptr;
+		}
+	}
+
+	void BufferAllocator::fillStatistics( renderer::MemoryUsageStatistics & usage )const
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		usage.allocatedBytes -= std::min( usage.allocatedBytes, m_allocatedSize );
+		usage.blockCount -= std::min( usage.blockCount, m_allocationCount );
+
+		for ( auto & page : m_pages )
+		{
+			usage.allocatedBytes += uint64_t( PageSize );
+			++usage.blockCount;
+			usage.freeBytes += uint64_t( page->freeSize );
+
+			for ( auto & range : page->freeRanges )
+			{
+				usage.largestFreeBlock = std::max( usage.largestFreeBlock, uint64_t( range.second ) );
+			}
+		}
+	}
+
+	BufferPage * BufferAllocator::doCreatePage( renderer::MemoryPropertyFlags flags )
+	{
+		auto page = std::make_unique< BufferPage >();
+		page->flags = flags;
+		page->freeRanges.emplace( 0, PageSize );
+		page->freeSize = PageSize;
+
+		if ( checkFlag( flags, renderer::MemoryPropertyFlag::eHostVisible ) )
+		{
+			page->mapFlags |= GL_MEMORY_MAP_READ_BIT | GL_MEMORY_MAP_WRITE_BIT | GL_MEMORY_MAP_FLUSH_EXPLICIT_BIT;
+		}
+
+		if ( checkFlag( flags, renderer::MemoryPropertyFlag::eHostCoherent ) )
+		{
+			// The page stays usable by the GPU while one of its buffers is mapped.
+			page->mapFlags |= GL_MEMORY_MAP_COHERENT_BIT | GL_MEMORY_MAP_PERSISTENT_BIT;
+		}
+
+		glLogCall( gl::GenBuffers, 1, &page->name );
+		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_COPY_WRITE, page->name );
+		glLogCall( gl::BufferStorage, GL_BUFFER_TARGET_COPY_WRITE, PageSize, nullptr, GLbitfield( convert( flags ) ) );
+		glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_COPY_WRITE, 0u );
+		m_pages.push_back( std::move( page ) );
+		return m_pages.back().get();
+	}
+
+	void BufferAllocator::doDestroyPage( BufferPage const & page )
+	{
+		auto it = std::find_if( m_pages.begin()
+			, m_pages.end()
+			, [&page]( std::unique_ptr< BufferPage > const & lookup )
+			{
+				return lookup.get() == &page;
+			} );
+		assert( it != m_pages.end() );
+		assert( !page.mapCount );
+		auto name = page.name;
+		m_device.onBufferDeleted( name );
+		glLogCall( gl::DeleteBuffers, 1, &name );
+		m_pages.erase( it );
+	}
+}
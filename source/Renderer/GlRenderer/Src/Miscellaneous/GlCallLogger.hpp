@@ -4,12 +4,121 @@ See LICENSE file in root folder
 */
 #pragma once
 
+#include "Miscellaneous/GlCallTracer.hpp"
+
+#include <functional>
 #include <iostream>
+#include <type_traits>
 
 #define GL_LOG_CALLS 0
 
 namespace gl_renderer
 {
+	class SubmissionThread;
+	/**
+	*\brief
+	*	Le thread de soumission auquel sont transférés les appels OpenGL du thread courant.
+	*\remarks
+	*	Défini par Device::enable en mode de soumission asynchrone, nul sinon, ainsi que sur le thread de soumission lui-même.
+	*/
+	extern thread_local SubmissionThread * callerSubmissionThread;
+	/**
+	*\brief
+	*	Exécute la tâche donnée sur le thread de soumission, et attend la fin de son exécution.
+	*/
+	void executeOnSubmissionThread( SubmissionThread & thread
+		, std::function< void() > const & job );
+	/**
+	*\brief
+	*	Appel d'une fonction OpenGL, transféré au thread de soumission si le thread appelant en a un,
+	*	et enregistré par le CallTracer s'il est actif.
+	*/
+	template< typename FuncT >
+	struct GlContextCall
+	{
+		template< typename ... ParamsT >
+		inline auto operator()( ParamsT ... params )const
+		{
+			using ResultT = decltype( function( params... ) );
+
+			if ( !callerSubmissionThread )
+			{
+				return call( params... );
+			}
+
+			if constexpr ( std::is_void< ResultT >::value )
+			{
+				executeOnSubmissionThread( *callerSubmissionThread
+					, [this, &params...]()
+					{
+						call( params... );
+					} );
+			}
+			else
+			{
+				ResultT result{};
+				executeOnSubmissionThread( *callerSubmissionThread
+					, [this, &result, &params...]()
+					{
+						result = call( params... );
+					} );
+				return result;
+			}
+		}
+
+		template< typename ... ParamsT >
+		inline auto call( ParamsT ... params )const
+		{
+			if ( !CallTracer::isEnabled() )
+			{
+				return function( params... );
+			}
+
+			return doTraceCall( params... );
+		}
+
+		FuncT function;
+		char const * name;
+
+	private:
+		template< typename ... ParamsT >
+		auto doTraceCall( ParamsT ... params )const
+		{
+			CallRecord record;
+			record.name = name;
+			packTraceArgs( record, params... );
+			auto begin = CallTracer::Clock::now();
+
+			if constexpr ( std::is_void< decltype( function( params... ) ) >::value )
+			{
+				function( params... );
+				doRecord( record, begin );
+			}
+			else
+			{
+				auto result = function( params... );
+				doRecord( record, begin );
+				return result;
+			}
+		}
+
+		static inline void doRecord( CallRecord & record
+			, CallTracer::Clock::time_point begin )
+		{
+			auto end = CallTracer::Clock::now();
+			record.begin = CallTracer::getTime( begin );
+			record.duration = CallTracer::getTime( end ) - record.begin;
+			CallTracer::record( record );
+		}
+	};
+
+	template< typename FuncT >
+	inline GlContextCall< FuncT > makeContextCall( FuncT function
+		, char const * name )
+	{
+		return GlContextCall< FuncT >{ function, name };
+	}
+
 	template< typename T >
 	struct Stringifier
 	{
@@ -337,7 +446,7 @@ namespace gl_renderer
 			stream << name;
 			logParams( stream, std::forward< ParamsT >( params )... );
 			renderer::Logger::logDebug( stream );
-			return function( std::forward< ParamsT >( params )... );
+			return makeContextCall( function, name )( std::forward< ParamsT >( params )... );
 		}
 	};
 
@@ -349,7 +458,7 @@ namespace gl_renderer
 			, char const * const name )
 		{
 			renderer::Logger::logDebug( std::string{ name } + "()" );
-			function();
+			makeContextCall( function, name )();
 		}
 	};
 
@@ -365,6 +474,9 @@ namespace gl_renderer
 			, std::forward< ParamsT >( params )... );
 	}
 
+#define glContextCall( Name )\
+	gl_renderer::makeContextCall( Name, #Name )
+
 #if GL_LOG_CALLS
 #	define glLogCall( Name, ... )\
 	executeFunction( Name, #Name, __VA_ARGS__ )
@@ -372,11 +484,11 @@ namespace gl_renderer
 	renderer::Logger::logDebug( std::string{ "Command: " } + Name )
 #elif defined( NDEBUG )
 #	define glLogCall( Name, ... )\
-	( Name( __VA_ARGS__ ) )
+	( glContextCall( Name )( __VA_ARGS__ ) )
 #	define glLogCommand( Name )
 #	else
 #	define glLogCall( Name, ... )\
-	( Name( __VA_ARGS__ ) );\
+	( glContextCall( Name )( __VA_ARGS__ ) );\
 	glCheckError( #Name )
 #	define glLogCommand( Name )
 #endif
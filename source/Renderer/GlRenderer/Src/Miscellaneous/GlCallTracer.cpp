@@ -0,0 +1,238 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Miscellaneous/GlCallTracer.hpp"
+
+#include <Miscellaneous/Log.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace gl_renderer
+{
+	namespace
+	{
+		struct CallRing
+		{
+			std::mutex mutex;
+			std::vector< CallRecord > records;
+			size_t next{ 0u };
+			size_t count{ 0u };
+			uint32_t threadIndex{ 0u };
+		};
+		using CallRingPtr = std::shared_ptr< CallRing >;
+
+		struct CallRings
+		{
+			std::mutex mutex;
+			// Shared with the threads, so their records survive them until the next flush.
+			std::vector< CallRingPtr > rings;
+		};
+
+		CallRings & getRings()
+		{
+			static CallRings result;
+			return result;
+		}
+
+		CallRing & getThreadRing()
+		{
+			thread_local CallRingPtr ring = []()
+			{
+				auto & rings = getRings();
+				auto result = std::make_shared< CallRing >();
+				result->records.resize( CallTracer::RingSize );
+				std::lock_guard< std::mutex > lock{ rings.mutex };
+				result->threadIndex = uint32_t( rings.rings.size() );
+				rings.rings.push_back( result );
+				return result;
+			}();
+			return *ring;
+		}
+
+		std::string getFunctionName( char const * name )
+		{
+			// "gl::DrawArrays" becomes "glDrawArrays".
+			std::string result{ name };
+
+			if ( result.find( "gl::" ) == 0u )
+			{
+				result = "gl" + result.substr( 4u );
+			}
+
+			return result;
+		}
+
+		void writeArg( std::ostream & stream
+			, uint64_t arg
+			, CallRecord::ArgType type )
+		{
+			switch ( type )
+			{
+			case CallRecord::ArgType::eFloat:
+				{
+					double value;
+					std::memcpy( &value, &arg, sizeof( value ) );
+
+					if ( std::isfinite( value ) )
+					{
+						stream << value;
+					}
+					else
+					{
+						stream << "\"" << value << "\"";
+					}
+				}
+				break;
+
+			case CallRecord::ArgType::ePointer:
+				stream << "\"0x" << std::hex << arg << std::dec << "\"";
+				break;
+
+			default:
+				stream << int64_t( arg );
+				break;
+			}
+		}
+
+		void writeEvent( std::ostream & stream
+			, uint32_t threadIndex
+			, std::string const & name
+			, CallRecord const & record )
+		{
+			stream << "{\"name\":\"" << name << "\""
+				<< ",\"cat\":\"gl\",\"ph\":\"X\",\"pid\":1"
+				<< ",\"tid\":" << threadIndex
+				<< ",\"ts\":" << double( record.begin ) / 1000.0
+				<< ",\"dur\":" << double( record.duration ) / 1000.0
+				<< ",\"args\":{";
+
+			for ( uint8_t i = 0u; i < record.argCount; ++i )
+			{
+				stream << ( i ? ",\"" : "\"" ) << uint32_t( i ) << "\":";
+				writeArg( stream, record.args[i], record.types[i] );
+			}
+
+			stream << "}}";
+		}
+	}
+
+	std::atomic< bool > CallTracer::stEnabled{ false };
+	CallTracer::Clock::time_point CallTracer::stStart{ CallTracer::Clock::now() };
+
+	void CallTracer::setEnabled( bool enable )
+	{
+		if ( enable )
+		{
+			auto & rings = getRings();
+			std::lock_guard< std::mutex > lock{ rings.mutex };
+
+			for ( auto & ring : rings.rings )
+			{
+				std::lock_guard< std::mutex > ringLock{ ring->mutex };
+				ring->next = 0u;
+				ring->count = 0u;
+			}
+		}
+
+		stEnabled.store( enable, std::memory_order_relaxed );
+	}
+
+	void CallTracer::record( CallRecord const & record )
+	{
+		auto & ring = getThreadRing();
+		std::lock_guard< std::mutex > lock{ ring.mutex };
+		ring.records[ring.next] = record;
+		ring.next = ( ring.next + 1u ) % ring.records.size();
+		ring.count = std::min( ring.count + 1u, ring.records.size() );
+	}
+
+	void CallTracer::flush( std::string const & fileName )
+	{
+		struct Statistics
+		{
+			size_t count{ 0u };
+			int64_t total{ 0 };
+		};
+		std::ofstream file{ fileName };
+
+		if ( !file )
+		{
+			renderer::Logger::logError( "Couldn't open the call trace file " + fileName );
+			return;
+		}
+
+		file << std::fixed << std::setprecision( 3 );
+		file << "{\"traceEvents\":[";
+		std::map< char const *, std::string > names;
+		std::map< std::string, Statistics > statistics;
+		bool first = true;
+		std::vector< CallRingPtr > rings;
+
+		{
+			auto & allRings = getRings();
+			std::lock_guard< std::mutex > lock{ allRings.mutex };
+			rings = allRings.rings;
+		}
+
+		for ( auto & ring : rings )
+		{
+			std::lock_guard< std::mutex > lock{ ring->mutex };
+			auto size = ring->records.size();
+			auto index = ( ring->next + size - ring->count ) % size;
+
+			for ( size_t i = 0u; i < ring->count; ++i )
+			{
+				auto & record = ring->records[index];
+				auto it = names.find( record.name );
+
+				if ( it == names.end() )
+				{
+					it = names.emplace( record.name, getFunctionName( record.name ) ).first;
+				}
+
+				file << ( first ? "\n" : ",\n" );
+				writeEvent( file, ring->threadIndex, it->second, record );
+				auto & stats = statistics[it->second];
+				++stats.count;
+				stats.total += record.duration;
+				first = false;
+				index = ( index + 1u ) % size;
+			}
+
+			ring->count = 0u;
+		}
+
+		file << "\n],\"displayTimeUnit\":\"ns\"}\n";
+
+		std::vector< std::pair< std::string, Statistics > > sorted{ statistics.begin(), statistics.end() };
+		std::sort( sorted.begin()
+			, sorted.end()
+			, []( std::pair< std::string, Statistics > const & lhs
+				, std::pair< std::string, Statistics > const & rhs )
+			{
+				return lhs.second.total > rhs.second.total;
+			} );
+		std::stringstream stream;
+		stream << std::fixed << std::setprecision( 3 );
+		stream << "GL calls trace written to " << fileName << "\n";
+
+		for ( auto & stats : sorted )
+		{
+			stream << "  " << std::left << std::setw( 40 ) << stats.first
+				<< std::right << std::setw( 10 ) << stats.second.count << " calls"
+				<< std::setw( 14 ) << double( stats.second.total ) / 1000000.0 << " ms"
+				<< std::setw( 12 ) << double( stats.second.total ) / ( 1000.0 * double( stats.second.count ) ) << " us/call\n";
+		}
+
+		renderer::Logger::logInfo( stream );
+	}
+}
@@ -78,10 +78,10 @@ namespace gl_renderer
 				}
 
 				int levels = 0;
-				gl::GetTexParameteriv( m_boundTarget, GL_TEXTURE_IMMUTABLE_LEVELS, &levels );
+				glLogCall( gl::GetTexParameteriv, m_boundTarget, GL_TEXTURE_IMMUTABLE_LEVELS, &levels );
 				assert( levels == createInfo.mipLevels );
 				int format = 0;
-				gl::GetTexParameteriv( m_boundTarget, GL_TEXTURE_IMMUTABLE_FORMAT, &format );
+				glLogCall( gl::GetTexParameteriv, m_boundTarget, GL_TEXTURE_IMMUTABLE_FORMAT, &format );
 				assert( format != 0 );
 				glLogCall( gl::BindTexture, m_boundTarget, 0 );
 
@@ -117,7 +117,7 @@ namespace gl_renderer
 			{
 				if ( m_pbo != GL_INVALID_INDEX )
 				{
-					gl::DeleteBuffers( 1u, &m_pbo );
+					glLogCall( gl::DeleteBuffers, 1u, &m_pbo );
 				}
 			}
 
@@ -450,8 +450,24 @@ namespace gl_renderer
 			{
 				assert( checkFlag( m_flags, renderer::MemoryPropertyFlag::eHostVisible ) && "Unsupported action on a device local buffer" );
 				assertDebugValue( m_isLocked, false );
+				m_lockFlags = m_mapFlags;
+
+				// A persistent mapping may stay alive while the GPU uses the buffer,
+				// the coherency making the writes visible without explicit flushes.
+				if ( checkFlag( flags, renderer::MemoryMapFlag::ePersistent )
+					&& checkFlag( m_flags, renderer::MemoryPropertyFlag::eHostCoherent ) )
+				{
+					m_lockFlags = ( m_lockFlags & ~GL_MEMORY_MAP_FLUSH_EXPLICIT_BIT ) | GL_MEMORY_MAP_PERSISTENT_BIT;
+				}
+
+				if ( checkFlag( flags, renderer::MemoryMapFlag::eUnsynchronised ) )
+				{
+					m_lockFlags |= GL_MEMORY_MAP_UNSYNCHRONIZED_BIT;
+				}
+
 				glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_COPY_WRITE, m_boundResource );
-				auto result = glLogCall( gl::MapBufferRange, GL_BUFFER_TARGET_COPY_WRITE, offset, size, m_mapFlags );
+				auto result = glLogCall( gl::MapBufferRange, GL_BUFFER_TARGET_COPY_WRITE, offset, size, m_lockFlags );
+				m_lockOffset = offset;
 				setDebugValue( m_isLocked, result != nullptr );
 				return reinterpret_cast< uint8_t * >( result );
 			}
@@ -461,7 +477,14 @@ namespace gl_renderer
 			{
 				assert( checkFlag( m_flags, renderer::MemoryPropertyFlag::eHostVisible ) && "Unsupported action on a device local buffer" );
 				assertDebugValue( m_isLocked, true );
-				glLogCall( gl::FlushMappedBufferRange, GL_BUFFER_TARGET_COPY_WRITE, offset, size );
+
+				if ( checkFlag( m_lockFlags, GL_MEMORY_MAP_FLUSH_EXPLICIT_BIT ) )
+				{
+					// The flushed range is relative to the mapped range.
+					assert( offset >= m_lockOffset );
+					glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_COPY_WRITE, m_boundResource );
+					glLogCall( gl::FlushMappedBufferRange, GL_BUFFER_TARGET_COPY_WRITE, offset - m_lockOffset, size );
+				}
 			}
 
 			void invalidate( uint32_t offset
@@ -476,6 +499,7 @@ namespace gl_renderer
 			{
 				assert( checkFlag( m_flags, renderer::MemoryPropertyFlag::eHostVisible ) && "Unsupported action on a device local buffer" );
 				assertDebugValue( m_isLocked, true );
+				glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_COPY_WRITE, m_boundResource );
 				glLogCall( gl::UnmapBuffer, GL_BUFFER_TARGET_COPY_WRITE );
 				glLogCall( gl::BindBuffer, GL_BUFFER_TARGET_COPY_WRITE, 0u );
 				setDebugValue( m_isLocked, false );
@@ -483,6 +507,72 @@ namespace gl_renderer
 
 		private:
 			mutable GLenum m_copyTarget;
+			mutable GlMemoryMapFlags m_lockFlags{ 0u };
+			mutable uint32_t m_lockOffset{ 0u };
+		};
+
+		//************************************************************************************************
+
+		class SubBufferMemory
+			: public DeviceMemory::DeviceMemoryImpl
+		{
+		public:
+			SubBufferMemory( renderer::MemoryRequirements const & requirements
+				, renderer::MemoryPropertyFlags flags
+				, BufferAllocator & allocator
+				, BufferAllocation const & allocation
+				, GLuint boundTarget )
+				: DeviceMemory::DeviceMemoryImpl{ requirements, flags, allocation.name, boundTarget }
+				, m_allocator{ allocator }
+				, m_allocation{ allocation }
+			{
+			}
+
+			~SubBufferMemory()
+			{
+				m_allocator.deallocate( m_allocation );
+			}
+
+			uint8_t * lock( uint32_t offset
+				, uint32_t size
+				, renderer::MemoryMapFlags flags )const override
+			{
+				assert( checkFlag( m_flags, renderer::MemoryPropertyFlag::eHostVisible ) && "Unsupported action on a device local buffer" );
+				assertDebugValue( m_isLocked, false );
+				auto result = m_allocator.map( m_allocation );
+				setDebugValue( m_isLocked, result != nullptr );
+				return result
+					? result + offset
+					: nullptr;
+			}
+
+			void flush( uint32_t offset
+				, uint32_t size )const override
+			{
+				assert( checkFlag( m_flags, renderer::MemoryPropertyFlag::eHostVisible ) && "Unsupported action on a device local buffer" );
+				assertDebugValue( m_isLocked, true );
+				m_allocator.flush( m_allocation, offset, size );
+			}
+
+			void invalidate( uint32_t offset
+				, uint32_t size )const override
+			{
+				assert( checkFlag( m_flags, renderer::MemoryPropertyFlag::eHostVisible ) && "Unsupported action on a device local buffer" );
+				assertDebugValue( m_isLocked, true );
+				// The page is shared, its content must not be discarded; the mapping itself is synchronised.
+			}
+
+			void unlock()const override
+			{
+				assert( checkFlag( m_flags, renderer::MemoryPropertyFlag::eHostVisible ) && "Unsupported action on a device local buffer" );
+				assertDebugValue( m_isLocked, true );
+				m_allocator.unmap( m_allocation );
+				setDebugValue( m_isLocked, false );
+			}
+
+		private:
+			BufferAllocator & m_allocator;
+			BufferAllocation m_allocation;
 		};
 	}
 
@@ -514,7 +604,7 @@ namespace gl_renderer
 	DeviceMemory::DeviceMemory( Device const & device
 		, renderer::MemoryRequirements const & requirements
 		, renderer::MemoryPropertyFlags flags )
-		: renderer::DeviceMemory{ device, flags }
+		: renderer::DeviceMemory{ device, requirements, flags }
 		, m_device{ device }
 		, m_requirements{ requirements }
 	{
@@ -527,7 +617,18 @@ namespace gl_renderer
 	void DeviceMemory::bindToBuffer( GLuint resource, GLenum target )
 	{
 		assert( !m_impl && "Memory object was already bound to a resource object" );
-		m_impl = std::make_unique< BufferMemory >( m_requirements, m_flags, resource, target );
+		auto allocator = m_device.getBufferAllocator();
+
+		if ( allocator
+			&& BufferAllocator::isSuballocable( m_requirements.size ) )
+		{
+			m_allocation = allocator->allocate( GLsizeiptr( m_requirements.size ), m_flags );
+			m_impl = std::make_unique< SubBufferMemory >( m_requirements, m_flags, *allocator, m_allocation, target );
+		}
+		else
+		{
+			m_impl = std::make_unique< BufferMemory >( m_requirements, m_flags, resource, target );
+		}
 	}
 
 	void DeviceMemory::bindToImage( Texture const & texture
@@ -536,6 +637,7 @@ namespace gl_renderer
 	{
 		assert( !m_impl && "Memory object was already bound to a resource object" );
 		m_impl = std::make_unique< ImageMemory >( m_requirements, m_flags, texture, target, createInfo );
+		m_device.invalidateActiveTextureUnit();
 	}
 
 	uint8_t * DeviceMemory::lock( uint32_t offset
@@ -564,6 +666,7 @@ namespace gl_renderer
 	{
 		assert( m_impl && "Memory object was not bound to a resource object" );
 		m_impl->unlock();
+		m_device.invalidateActiveTextureUnit();
 	}
 
 	//************************************************************************************************
@@ -4,7 +4,7 @@ See LICENSE file in root folder
 */
 #pragma once
 
-#include "GlRendererPrerequisites.hpp"
+#include "Miscellaneous/GlBufferAllocator.hpp"
 
 #include <Miscellaneous/DeviceMemory.hpp>
 #include <Miscellaneous/MemoryRequirements.hpp>
@@ -18,6 +18,11 @@ namespace gl_renderer
 	*\~english
 	*\brief
 	*	Class wrapping a storage allocated to a data buffer.
+	*\remarks
+	*\~french
+	*	Lorsque le Device a un BufferAllocator, les petits tampons reçoivent un intervalle d'un tampon partagé.
+	*\~english
+	*	When the Device has a BufferAllocator, small buffers get a range of a shared buffer.
 	*/
 	class DeviceMemory
 		: public renderer::DeviceMemory
@@ -54,6 +59,20 @@ namespace gl_renderer
 			, renderer::MemoryRequirements const & requirements
 			, renderer::MemoryPropertyFlags flags );
 		~DeviceMemory();
+		/**
+		*\~french
+		*\brief
+		*	Crée le stockage d'un tampon.
+		*\remarks
+		*	Si la mémoire est sous-allouée, le tampon doit utiliser le nom et le décalage de getBufferAllocation(),
+		*	et \p resource n'est pas utilisé.
+		*\~english
+		*\brief
+		*	Creates a buffer's storage.
+		*\remarks
+		*	If the memory is suballocated, the buffer must use getBufferAllocation()'s name and offset,
+		*	and \p resource is not used.
+		*/
 		void bindToBuffer( GLuint resource, GLenum target );
 		void bindToImage( Texture const & texture
 			, GLenum target
@@ -78,6 +97,31 @@ namespace gl_renderer
 		*\copydoc	renderer::DeviceMemory::unlock
 		*/
 		void unlock()const override;
+		/**
+		*\~french
+		*\return
+		*	\p true si la mémoire est un intervalle d'un tampon partagé.
+		*\~english
+		*\return
+		*	\p true if the memory is a range of a shared buffer.
+		*/
+		inline bool isSuballocated()const
+		{
+			return m_allocation.page != nullptr;
+		}
+		/**
+		*\~french
+		*\return
+		*	L'intervalle du tampon partagé.
+		*\~english
+		*\return
+		*	The shared buffer range.
+		*/
+		inline BufferAllocation const & getBufferAllocation()const
+		{
+			assert( isSuballocated() );
+			return m_allocation;
+		}
 
 	private:
 		void doSetImage1D( uint32_t width
@@ -101,6 +145,7 @@ namespace gl_renderer
 	private:
 		Device const & m_device;
 		renderer::MemoryRequirements m_requirements;
+		BufferAllocation m_allocation;
 		std::unique_ptr< DeviceMemoryImpl > m_impl;
 	};
 }
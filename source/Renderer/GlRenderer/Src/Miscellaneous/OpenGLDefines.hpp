@@ -145,10 +145,14 @@ namespace gl_renderer
 	using PFN_glBindBuffer = void ( GLAPIENTRY * )( GLenum target, GLuint buffer );
 	using PFN_glBindBufferBase = void ( GLAPIENTRY * )( GLenum target, GLuint index, GLuint buffer );
 	using PFN_glBindBufferRange = void ( GLAPIENTRY * )( GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size );
+	using PFN_glBindBuffersRange = void ( GLAPIENTRY * )( GLenum target, GLuint first, GLsizei count, const GLuint * buffers, const GLintptr * offsets, const GLsizeiptr * sizes );
 	using PFN_glBindFramebuffer = void ( GLAPIENTRY * )( GLenum target, GLuint framebuffer );
 	using PFN_glBindImageTexture = void ( GLAPIENTRY * )( GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format );
+	using PFN_glBindImageTextures = void ( GLAPIENTRY * )( GLuint first, GLsizei count, const GLuint * textures );
 	using PFN_glBindSampler = void ( GLAPIENTRY * )( GLuint unit, GLuint sampler );
+	using PFN_glBindSamplers = void ( GLAPIENTRY * )( GLuint first, GLsizei count, const GLuint * samplers );
 	using PFN_glBindTexture = void ( GLAPIENTRY * )( GLenum target, GLuint texture );
+	using PFN_glBindTextures = void ( GLAPIENTRY * )( GLuint first, GLsizei count, const GLuint * textures );
 	using PFN_glBindVertexArray = void ( GLAPIENTRY * )( GLuint array );
 	using PFN_glBlendColor = void ( GLAPIENTRY * )( GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha );
 	using PFN_glBlendEquationSeparatei = void ( GLAPIENTRY * )( GLuint buf, GLenum modeRGB, GLenum modeAlpha );
@@ -232,6 +236,7 @@ namespace gl_renderer
 	using PFN_glGetQueryObjectuiv = void ( GLAPIENTRY * )( GLuint id, GLenum pname, GLuint * params );
 	using PFN_glGetShaderInfoLog = void ( GLAPIENTRY * )( GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog );
 	using PFN_glGetShaderiv = void ( GLAPIENTRY * )( GLuint shader, GLenum pname, GLint* param );
+	using PFN_glGetUniformBlockIndex = GLuint ( GLAPIENTRY * )( GLuint program, const GLchar * uniformBlockName );
 	using PFN_glGetString = GLubyte *( GLAPIENTRY * )( GLenum name ); 
 	using PFN_glGetTexImage = void ( GLAPIENTRY * )( GLenum target, GLint level, GLenum format, GLenum type, void *pixels );
 	using PFN_glGetTexLevelParameterfv = void ( GLAPIENTRY * )( GLenum target, GLint level, GLenum pname, GLfloat * params );
@@ -293,6 +298,7 @@ namespace gl_renderer
 	using PFN_glUniform4fv = void ( GLAPIENTRY * )( GLint location, GLsizei count, const GLfloat* value );
 	using PFN_glUniform4iv = void ( GLAPIENTRY * )( GLint location, GLsizei count, const GLint* value );
 	using PFN_glUniform4uiv = void ( GLAPIENTRY * )( GLint location, GLsizei count, const GLuint *value );
+	using PFN_glUniformBlockBinding = void ( GLAPIENTRY * )( GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding );
 	using PFN_glUniformMatrix2fv = void ( GLAPIENTRY * )( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value );
 	using PFN_glUniformMatrix3fv = void ( GLAPIENTRY * )( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value );
 	using PFN_glUniformMatrix4fv = void ( GLAPIENTRY * )( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value );
@@ -122,6 +122,7 @@ GL_LIB_FUNCTION( GetQueryObjectui64v )
 GL_LIB_FUNCTION( GetQueryObjectuiv )
 GL_LIB_FUNCTION( GetShaderInfoLog )
 GL_LIB_FUNCTION( GetShaderiv )
+GL_LIB_FUNCTION( GetUniformBlockIndex )
 GL_LIB_FUNCTION( InvalidateBufferSubData )
 GL_LIB_FUNCTION( LinkProgram )
 GL_LIB_FUNCTION( MapBufferRange )
@@ -160,6 +161,7 @@ GL_LIB_FUNCTION( Uniform3uiv )
 GL_LIB_FUNCTION( Uniform4fv )
 GL_LIB_FUNCTION( Uniform4iv )
 GL_LIB_FUNCTION( Uniform4uiv )
+GL_LIB_FUNCTION( UniformBlockBinding )
 GL_LIB_FUNCTION( UniformMatrix2fv )
 GL_LIB_FUNCTION( UniformMatrix3fv )
 GL_LIB_FUNCTION( UniformMatrix4fv )
@@ -175,6 +177,10 @@ GL_LIB_FUNCTION( VertexAttribIPointer )
 #	define GL_LIB_FUNCTION_OPT( x )
 #endif
 
+GL_LIB_FUNCTION_OPT( BindBuffersRange )
+GL_LIB_FUNCTION_OPT( BindImageTextures )
+GL_LIB_FUNCTION_OPT( BindSamplers )
+GL_LIB_FUNCTION_OPT( BindTextures )
 GL_LIB_FUNCTION_OPT( ClearTexImage )
 GL_LIB_FUNCTION_OPT( DispatchComputeIndirect )
 GL_LIB_FUNCTION_OPT( MinSampleShading )
@@ -17,6 +17,7 @@ namespace gl_renderer
 		, m_program{ m_createInfo.stage }
 	{
 		m_program.link();
+		m_program.bindPushConstantsBlock( m_device.getPushConstantsBinding() );
 
 		if ( m_createInfo.stage.specialisationInfo )
 		{
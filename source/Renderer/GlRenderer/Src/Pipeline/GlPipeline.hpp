@@ -24,6 +24,7 @@
 #include <Pipeline/Viewport.hpp>
 
 #include <algorithm>
+#include <mutex>
 #include <unordered_map>
 
 namespace gl_renderer
@@ -44,8 +45,21 @@ namespace gl_renderer
 		Pipeline( Device const & device
 			, PipelineLayout const & layout
 			, renderer::GraphicsPipelineCreateInfo && createInfo );
+		/**
+		*\brief
+		*	Recherche les GeometryBuffers correspondant aux tampons donnés.
+		*\remarks
+		*	Peut être appelée depuis plusieurs threads d'enregistrement.
+		*/
 		GeometryBuffers * findGeometryBuffers( VboBindings const & vbos
 			, IboBinding const & ibo )const;
+		/**
+		*\brief
+		*	Crée les GeometryBuffers correspondant aux tampons donnés.
+		*\remarks
+		*	Peut être appelée depuis plusieurs threads d'enregistrement.
+		*	Si un autre thread les a créés entre temps, ceux-ci sont renvoyés.
+		*/
 		GeometryBuffersRef createGeometryBuffers( VboBindings vbos
 			, IboBinding const & ibo
 			, renderer::IndexType type )const;
@@ -201,6 +215,9 @@ namespace gl_renderer
 				, state );
 		}
 
+	private:
+		GeometryBuffers * doFindGeometryBuffers( size_t hash )const;
+
 	private:
 		Device const & m_device;
 		PipelineLayout const & m_layout;
@@ -217,8 +234,9 @@ namespace gl_renderer
 		std::optional< renderer::Scissor > m_scissor;
 		std::vector< renderer::PushConstantsBufferBase > m_constantsPcbs;
 		ShaderProgram m_program;
+		mutable std::mutex m_geometryBuffersMutex;
 		mutable std::vector< std::pair< size_t, GeometryBuffersPtr > > m_geometryBuffers;
-		mutable std::unordered_map< GLuint, BufferDestroyConnection > m_connections;
+		mutable std::unordered_map< Buffer const *, BufferDestroyConnection > m_connections;
 		size_t m_vertexInputStateHash;
 	};
 }
@@ -225,7 +225,7 @@ namespace gl_renderer
 					, target
 					, attachment.object
 					, mipLevel );
-				doCheck( gl::CheckFramebufferStatus( GL_FRAMEBUFFER ) );
+				doCheck( glContextCall( gl::CheckFramebufferStatus )( GL_FRAMEBUFFER ) );
 			}
 			else
 			{
@@ -249,7 +249,7 @@ namespace gl_renderer
 			}
 		}
 
-		doCheck( gl::CheckFramebufferStatus( GL_FRAMEBUFFER ) );
+		doCheck( glContextCall( gl::CheckFramebufferStatus )( GL_FRAMEBUFFER ) );
 		glLogCall( gl::BindFramebuffer, GL_FRAMEBUFFER, 0 );
 	}
 
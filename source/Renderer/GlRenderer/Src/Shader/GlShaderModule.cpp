@@ -65,7 +65,7 @@ namespace gl_renderer
 		, renderer::ShaderStageFlag stage )
 		: renderer::ShaderModule{ device, stage }
 		, m_device{ device }
-		, m_shader{ gl::CreateShader( convert( stage ) ) }
+		, m_shader{ glContextCall( gl::CreateShader )( convert( stage ) ) }
 		, m_isSpirV{ false }
 	{
 	}
@@ -117,7 +117,7 @@ $&)" );
 			throw std::runtime_error{ "Shader compilation from SPIR-V is not supported." };
 		}
 
-		gl::ShaderBinary( 1u, &m_shader, GL_SHADER_BINARY_FORMAT_SPIR_V, fileData.data(), GLsizei( fileData.size() ) );
+		glLogCall( gl::ShaderBinary, 1u, &m_shader, GL_SHADER_BINARY_FORMAT_SPIR_V, fileData.data(), GLsizei( fileData.size() ) );
 		m_isSpirV = true;
 	}
 }
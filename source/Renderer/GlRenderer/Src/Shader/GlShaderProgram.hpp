@@ -15,6 +15,13 @@ namespace gl_renderer
 		ShaderProgram( renderer::ShaderStageState const & stage );
 		~ShaderProgram();
 		void link()const;
+		/**
+		*\brief
+		*	Attache le bloc uniforme "PushConstants", s'il est utilisé par le programme, au point d'attache donné.
+		*\remarks
+		*	Ce bloc est alimenté par CommandBuffer lorsque les push constants sont écrites dans un tampon uniforme.
+		*/
+		void bindPushConstantsBlock( GLuint binding )const;
 
 		inline GLuint getProgram()const
 		{
@@ -5,6 +5,7 @@ See LICENSE file in root folder.
 #include "Sync/GlFence.hpp"
 
 #include "Core/GlDevice.hpp"
+#include "Core/GlSubmissionThread.hpp"
 
 namespace gl_renderer
 {
@@ -23,14 +24,23 @@ namespace gl_renderer
 
 	Fence::~Fence()
 	{
-		if ( m_fence )
-		{
-			glLogCall( gl::DeleteSync, m_fence );
-		}
+		reset();
 	}
 
 	renderer::WaitResult Fence::wait( uint64_t timeout )const
 	{
+		if ( callerSubmissionThread )
+		{
+			// Queued behind the submissions, so the wait covers them.
+			renderer::WaitResult result;
+			executeOnSubmissionThread( *callerSubmissionThread
+				, [this, &result, timeout]()
+				{
+					result = wait( timeout );
+				} );
+			return result;
+		}
+
 		if ( !m_fence )
 		{
 			m_fence = glLogCall( gl::FenceSync, GL_WAIT_FLAG_SYNC_GPU_COMMANDS_COMPLETE, 0u );
@@ -46,10 +56,30 @@ namespace gl_renderer
 
 	void Fence::reset()const
 	{
+		if ( callerSubmissionThread )
+		{
+			executeOnSubmissionThread( *callerSubmissionThread
+				, [this]()
+				{
+					reset();
+				} );
+			return;
+		}
+
 		if ( m_fence )
 		{
 			glLogCall( gl::DeleteSync, m_fence );
 			m_fence = nullptr;
 		}
 	}
+
+	void Fence::insert()const
+	{
+		if ( m_fence )
+		{
+			glLogCall( gl::DeleteSync, m_fence );
+		}
+
+		m_fence = glLogCall( gl::FenceSync, GL_WAIT_FLAG_SYNC_GPU_COMMANDS_COMPLETE, 0u );
+	}
 }
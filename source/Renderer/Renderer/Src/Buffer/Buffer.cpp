@@ -22,6 +22,11 @@ namespace renderer
 
 	BufferBase::~BufferBase()
 	{
+		if ( m_storage )
+		{
+			m_device.doRemoveResourceMemory( m_target, 0u, m_storage->getSize() );
+		}
+
 		unregisterObject( m_device, this );
 	}
 
@@ -29,6 +34,7 @@ namespace renderer
 	{
 		assert( !m_storage && "A resource can only be bound once to a device memory object." );
 		m_storage = std::move( memory );
+		m_device.doAddResourceMemory( m_target, 0u, m_storage->getSize() );
 		doBindMemory();
 	}
 
@@ -0,0 +1,215 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Buffer/RingBuffer.hpp"
+
+#include "Core/Device.hpp"
+#include "Core/Renderer.hpp"
+#include "Core/RenderingResources.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace renderer
+{
+	namespace
+	{
+		uint32_t getRangeAlignment( Device const & device
+			, BufferTargets target )
+		{
+			auto & limits = device.getProperties().limits;
+			uint64_t result = 16u;
+
+			if ( checkFlag( target, BufferTarget::eUniformBuffer ) )
+			{
+				result = std::max( result, limits.minUniformBufferOffsetAlignment );
+			}
+
+			if ( checkFlag( target, BufferTarget::eStorageBuffer )
+				&& limits.minStorageBufferOffsetAlignment != NonAvailable< uint64_t > )
+			{
+				result = std::max( result, limits.minStorageBufferOffsetAlignment );
+			}
+
+			if ( ( checkFlag( target, BufferTarget::eUniformTexelBuffer )
+					|| checkFlag( target, BufferTarget::eStorageTexelBuffer ) )
+				&& limits.minTexelBufferOffsetAlignment != NonAvailable< uint64_t > )
+			{
+				result = std::max( result, limits.minTexelBufferOffsetAlignment );
+			}
+
+			return uint32_t( result );
+		}
+
+		uint32_t getAlignedSize( uint32_t size, uint32_t alignment )
+		{
+			return ( ( size + alignment - 1u ) / alignment ) * alignment;
+		}
+	}
+
+	RingBuffer::RingBuffer( Device const & device
+		, BufferTargets target
+		, uint32_t frameSize
+		, uint32_t frameCount )
+		: m_device{ device }
+		, m_alignment{ getRangeAlignment( device, target ) }
+		, m_frameSize{ getAlignedSize( frameSize, m_alignment ) }
+		, m_frameCount{ frameCount }
+		, m_buffer{ device.createBuffer( m_frameSize * frameCount
+			, target
+			, MemoryPropertyFlag::eHostVisible | MemoryPropertyFlag::eHostCoherent ) }
+		, m_persistent{ device.getRenderer().getFeatures().hasPersistentMapping }
+	{
+		assert( frameCount > 0u );
+
+		if ( m_persistent )
+		{
+			m_data = m_buffer->lock( 0u
+				, m_buffer->getSize()
+				, MemoryMapFlag::eWrite | MemoryMapFlag::ePersistent | MemoryMapFlag::eCoherent );
+			m_persistent = m_data != nullptr;
+		}
+	}
+
+	RingBuffer::~RingBuffer()
+	{
+		if ( m_data )
+		{
+			m_buffer->unlock();
+		}
+	}
+
+	void RingBuffer::beginFrame()
+	{
+		if ( m_tiedToResources )
+		{
+			throw std::runtime_error{ "RingBuffer::beginFrame overloads can't be mixed" };
+		}
+
+		if ( m_fences.empty() )
+		{
+			// The fences are only needed when the regions aren't tied to rendering resources.
+			for ( uint32_t i = 0u; i < m_frameCount; ++i )
+			{
+				m_fences.push_back( m_device.createFence() );
+			}
+
+			m_pending.resize( m_frameCount, false );
+		}
+
+		if ( m_ended )
+		{
+			// The previous region's fence follows the submissions made since its endFrame.
+			auto & fence = *m_fences[m_frame];
+			fence.reset();
+			m_device.getGraphicsQueue().submit( CommandBufferCRefArray{}
+				, SemaphoreCRefArray{}
+				, PipelineStageFlagsArray{}
+				, SemaphoreCRefArray{}
+				, &fence );
+			m_pending[m_frame] = true;
+			m_frame = ( m_frame + 1u ) % m_frameCount;
+			m_ended = false;
+		}
+
+		if ( m_pending[m_frame] )
+		{
+			m_fences[m_frame]->wait( FenceTimeout );
+			m_pending[m_frame] = false;
+		}
+
+		doBeginRegion( m_frame );
+	}
+
+	void RingBuffer::beginFrame( RenderingResources const & resources )
+	{
+		if ( !m_fences.empty() )
+		{
+			throw std::runtime_error{ "RingBuffer::beginFrame overloads can't be mixed" };
+		}
+
+		if ( resources.getIndex() >= m_frameCount )
+		{
+			throw std::runtime_error{ "More rendering resources than RingBuffer frame regions" };
+		}
+
+		// The resources fence has already been waited, when the swap chain gave them.
+		m_tiedToResources = true;
+		m_ended = false;
+		doBeginRegion( resources.getIndex() );
+	}
+
+	void RingBuffer::doBeginRegion( uint32_t frame )
+	{
+		if ( !m_persistent )
+		{
+			// beginFrame called twice without endFrame: the open region is closed, instead of being locked again.
+			assert( !m_data && "RingBuffer::beginFrame called twice without endFrame" );
+			doEndRegion();
+		}
+
+		m_frame = frame;
+		m_offset = 0u;
+
+		if ( !m_persistent )
+		{
+			// The fence wait made the unsynchronised mapping safe.
+			m_data = m_buffer->lock( doGetRegionOffset()
+				, m_frameSize
+				, MemoryMapFlag::eWrite | MemoryMapFlag::eInvalidateRange | MemoryMapFlag::eUnsynchronised );
+		}
+	}
+
+	void RingBuffer::endFrame()
+	{
+		assert( !m_ended && "RingBuffer::endFrame called twice" );
+		doEndRegion();
+		m_ended = true;
+	}
+
+	void RingBuffer::doEndRegion()
+	{
+		if ( !m_persistent && m_data )
+		{
+			if ( m_offset )
+			{
+				m_buffer->flush( doGetRegionOffset(), m_offset );
+			}
+
+			m_buffer->unlock();
+			m_data = nullptr;
+		}
+	}
+
+	RingBufferRange RingBuffer::allocate( uint32_t size )
+	{
+		assert( !m_ended && "RingBuffer::allocate called outside of beginFrame/endFrame" );
+		auto offset = getAlignedSize( m_offset, m_alignment );
+
+		if ( !m_data
+			|| offset + size > m_frameSize )
+		{
+			return { nullptr, 0u, 0u };
+		}
+
+		m_offset = offset + size;
+		auto data = m_persistent
+			? m_data + doGetRegionOffset() + offset
+			: m_data + offset;
+		return { data, doGetRegionOffset() + offset, size };
+	}
+
+	RingBufferRange RingBuffer::upload( void const * data
+		, uint32_t size )
+	{
+		auto result = allocate( size );
+
+		if ( result.data )
+		{
+			std::memcpy( result.data, data, size );
+		}
+
+		return result;
+	}
+}
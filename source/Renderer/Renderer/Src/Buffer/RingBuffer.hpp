@@ -0,0 +1,308 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#ifndef ___Renderer_RingBuffer_HPP___
+#define ___Renderer_RingBuffer_HPP___
+#pragma once
+
+#include "Buffer/Buffer.hpp"
+#include "Sync/Fence.hpp"
+
+namespace renderer
+{
+	/**
+	*\~english
+	*\brief
+	*	A range allocated in a RingBuffer's current frame region.
+	*\~french
+	*\brief
+	*	Un intervalle alloué dans la région de l'image courante d'un RingBuffer.
+	*/
+	struct RingBufferRange
+	{
+		//!\~french		Le pointeur où écrire les données, \p nullptr si la région était pleine.
+		//!\~english	The pointer to write the data to, \p nullptr if the region was full.
+		uint8_t * data;
+		//!\~french		Le décalage de l'intervalle dans le tampon.
+		//!\~english	The range offset in the buffer.
+		uint32_t offset;
+		//!\~french		La taille de l'intervalle.
+		//!\~english	The range size.
+		uint32_t size;
+	};
+	/**
+	*\~english
+	*\brief
+	*	A host visible buffer, split into frame regions, for the data updated each frame.
+	*\remarks
+	*	When the renderer supports it, the buffer is mapped once and persistently,
+	*	otherwise the current region is mapped without synchronisation between beginFrame and endFrame.
+	*	A region is guarded by a fence, inserted at the beginning of the next frame,
+	*	and only rewritten once the GPU is done with it.
+	*	The regions can also be tied to the swap chain's RenderingResources, and be guarded by their fences,
+	*	uniform buffer ranges then being bound through dynamic offsets.
+	*\~french
+	*\brief
+	*	Un tampon visible par l'hôte, découpé en régions par image, pour les données mises à jour à chaque image.
+	*\remarks
+	*	Quand le renderer le supporte, le tampon est mappé une seule fois, de manière persistante,
+	*	sinon la région courante est mappée sans synchronisation entre beginFrame et endFrame.
+	*	Une région est protégée par une barrière, insérée au début de l'image suivante,
+	*	et n'est réécrite qu'une fois que le GPU en a fini avec elle.
+	*	Les régions peuvent aussi être liées aux RenderingResources de la swap chain, et être protégées par leurs barrières,
+	*	les intervalles de tampons de variables uniformes étant alors liés via des décalages dynamiques.
+	*/
+	class RingBuffer
+	{
+	public:
+		/**
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] target
+		*	The buffer targets.
+		*\param[in] frameSize
+		*	The size of a frame region.
+		*\param[in] frameCount
+		*	The number of frame regions, i.e. the number of frames the CPU may be ahead of the GPU.
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] target
+		*	Les cibles du tampon.
+		*\param[in] frameSize
+		*	La taille d'une région.
+		*\param[in] frameCount
+		*	Le nombre de régions, i.e. le nombre d'images d'avance que le CPU peut avoir sur le GPU.
+		*/
+		RingBuffer( Device const & device
+			, BufferTargets target
+			, uint32_t frameSize
+			, uint32_t frameCount = 3u );
+		/**
+		*\~english
+		*\brief
+		*	Destructor.
+		*\~french
+		*\brief
+		*	Destructeur.
+		*/
+		~RingBuffer();
+		/**
+		*\~english
+		*\brief
+		*	Starts a new frame.
+		*\remarks
+		*	Protects the previous frame's region with a fence, covering the command buffers submitted until now,
+		*	then waits for the GPU to be done with the new frame's region.
+		*	The fences are created on the first call.
+		*\throw std::runtime_error
+		*	If the rendering resources based version has already been used.
+		*\~french
+		*\brief
+		*	Démarre une nouvelle image.
+		*\remarks
+		*	Protège la région de l'image précédente par une barrière, couvrant les tampons de commandes soumis jusque là,
+		*	puis attend que le GPU en ait fini avec la région de la nouvelle image.
+		*	Les barrières sont créées au premier appel.
+		*\throw std::runtime_error
+		*	Si la version basée sur les ressources de rendu a déjà été utilisée.
+		*/
+		void beginFrame();
+		/**
+		*\~english
+		*\brief
+		*	Starts a new frame, using the region tied to the given rendering resources.
+		*\remarks
+		*	The region is chosen from the resources index, which survives the swap chain resets.
+		*	The resources fence, waited by SwapChain::getResources, guards the region:
+		*	the command buffers using it must be submitted with this fence.
+		*	This version must not be mixed with the one without parameters.
+		*\param[in] resources
+		*	The rendering resources.
+		*\throw std::runtime_error
+		*	If the resources index is out of the regions, or if the fences based version has already been used.
+		*\~french
+		*\brief
+		*	Démarre une nouvelle image, utilisant la région liée aux ressources de rendu données.
+		*\remarks
+		*	La région est choisie à partir de l'indice des ressources, qui survit aux réinitialisations de la swap chain.
+		*	La barrière des ressources, attendue par SwapChain::getResources, protège la région :
+		*	les tampons de commandes l'utilisant doivent être soumis avec cette barrière.
+		*	Cette version ne doit pas être mélangée avec celle sans paramètres.
+		*\param[in] resources
+		*	Les ressources de rendu.
+		*\throw std::runtime_error
+		*	Si l'indice des ressources est hors des régions, ou si la version basée sur les barrières a déjà été utilisée.
+		*/
+		void beginFrame( RenderingResources const & resources );
+		/**
+		*\~english
+		*\brief
+		*	Ends the writes for the current frame.
+		*\remarks
+		*	Must be called before submitting the command buffers using the current region.
+		*\~french
+		*\brief
+		*	Termine les écritures pour l'image courante.
+		*\remarks
+		*	Doit être appelée avant la soumission des tampons de commandes utilisant la région courante.
+		*/
+		void endFrame();
+		/**
+		*\~english
+		*\brief
+		*	Allocates a range in the current frame region.
+		*\param[in] size
+		*	The range size.
+		*\return
+		*	The range, aligned on the buffer targets' requirements.
+		*	Its data pointer is \p nullptr if the region is full.
+		*\~french
+		*\brief
+		*	Alloue un intervalle dans la région de l'image courante.
+		*\param[in] size
+		*	La taille de l'intervalle.
+		*\return
+		*	L'intervalle, aligné selon les exigences des cibles du tampon.
+		*	Son pointeur de données est \p nullptr si la région est pleine.
+		*/
+		RingBufferRange allocate( uint32_t size );
+		/**
+		*\~english
+		*\brief
+		*	Allocates a range in the current frame region and copies data into it.
+		*\param[in] data
+		*	The data.
+		*\param[in] size
+		*	The data size.
+		*\return
+		*	The range, its data pointer is \p nullptr if the region is full.
+		*\~french
+		*\brief
+		*	Alloue un intervalle dans la région de l'image courante et y copie des données.
+		*\param[in] data
+		*	Les données.
+		*\param[in] size
+		*	La taille des données.
+		*\return
+		*	L'intervalle, son pointeur de données est \p nullptr si la région est pleine.
+		*/
+		RingBufferRange upload( void const * data
+			, uint32_t size );
+		/**
+		*\~english
+		*\brief
+		*	Allocates an element in the current frame region.
+		*\param[out] offset
+		*	Receives the element offset in the buffer, usable as a dynamic offset.
+		*\return
+		*	The pointer to write the element to, \p nullptr if the region is full.
+		*\~french
+		*\brief
+		*	Alloue un élément dans la région de l'image courante.
+		*\param[out] offset
+		*	Reçoit le décalage de l'élément dans le tampon, utilisable comme décalage dynamique.
+		*\return
+		*	Le pointeur où écrire l'élément, \p nullptr si la région est pleine.
+		*/
+		template< typename T >
+		inline T * allocate( uint32_t & offset )
+		{
+			auto range = allocate( uint32_t( sizeof( T ) ) );
+			offset = range.offset;
+			return reinterpret_cast< T * >( range.data );
+		}
+		/**
+		*\~english
+		*\return
+		*	The GPU buffer.
+		*\~french
+		*\return
+		*	Le tampon GPU.
+		*/
+		inline BufferBase const & getBuffer()const
+		{
+			return *m_buffer;
+		}
+		/**
+		*\~english
+		*\return
+		*	The size of a frame region.
+		*\~french
+		*\return
+		*	La taille d'une région.
+		*/
+		inline uint32_t getFrameSize()const
+		{
+			return m_frameSize;
+		}
+		/**
+		*\~english
+		*\return
+		*	The number of frame regions.
+		*\~french
+		*\return
+		*	Le nombre de régions.
+		*/
+		inline uint32_t getFrameCount()const
+		{
+			return m_frameCount;
+		}
+		/**
+		*\~english
+		*\return
+		*	The ranges alignment.
+		*\~french
+		*\return
+		*	L'alignement des intervalles.
+		*/
+		inline uint32_t getAlignment()const
+		{
+			return m_alignment;
+		}
+		/**
+		*\~english
+		*\return
+		*	\p true if the buffer is persistently mapped.
+		*\~french
+		*\return
+		*	\p true si le tampon est mappé de manière persistante.
+		*/
+		inline bool isPersistent()const
+		{
+			return m_persistent;
+		}
+
+	private:
+		inline uint32_t doGetRegionOffset()const
+		{
+			return m_frame * m_frameSize;
+		}
+
+		void doBeginRegion( uint32_t frame );
+		void doEndRegion();
+
+	private:
+		Device const & m_device;
+		uint32_t m_alignment;
+		uint32_t m_frameSize;
+		uint32_t m_frameCount;
+		BufferBasePtr m_buffer;
+		std::vector< FencePtr > m_fences;
+		std::vector< bool > m_pending;
+		bool m_tiedToResources{ false };
+		bool m_persistent;
+		uint8_t * m_data{ nullptr };
+		uint32_t m_frame{ 0u };
+		uint32_t m_offset{ 0u };
+		bool m_ended{ false };
+	};
+}
+
+#endif
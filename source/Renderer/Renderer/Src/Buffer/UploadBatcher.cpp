@@ -0,0 +1,658 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Buffer/UploadBatcher.hpp"
+
+#include "Command/CommandPool.hpp"
+#include "Command/Queue.hpp"
+#include "Core/Device.hpp"
+#include "Core/Exception.hpp"
+#include "Core/Renderer.hpp"
+#include "Image/Texture.hpp"
+#include "Image/TextureView.hpp"
+#include "Sync/BufferMemoryBarrier.hpp"
+#include "Sync/ImageMemoryBarrier.hpp"
+#include "Sync/Semaphore.hpp"
+
+#include <algorithm>
+
+namespace renderer
+{
+	namespace
+	{
+		uint32_t getCopyAlignment( Device const & device )
+		{
+			auto & limits = device.getProperties().limits;
+			uint64_t result = 16u;
+
+			if ( limits.optimalBufferCopyOffsetAlignment != NonAvailable< uint64_t > )
+			{
+				result = std::max( result, limits.optimalBufferCopyOffsetAlignment );
+			}
+
+			return uint32_t( result );
+		}
+
+		uint32_t getAlignedOffset( uint32_t offset, uint32_t alignment )
+		{
+			return ( ( offset + alignment - 1u ) / alignment ) * alignment;
+		}
+
+		Extent3D getMipExtent( Extent3D const & extent
+			, uint32_t level )
+		{
+			return Extent3D
+			{
+				std::max( 1u, extent.width >> level ),
+				std::max( 1u, extent.height >> level ),
+				std::max( 1u, extent.depth >> level )
+			};
+		}
+
+		// The copy must cover the whole of the view's subresources, for their content to be discarded.
+		bool isCoveringView( ImageSubresourceLayers const & subresourceLayers
+			, Offset3D const & offset
+			, Extent3D const & extent
+			, TextureView const & view )
+		{
+			auto & range = view.getSubResourceRange();
+			auto dimensions = getMipExtent( view.getTexture().getDimensions()
+				, subresourceLayers.mipLevel );
+			return range.levelCount == 1u
+				&& range.baseMipLevel == subresourceLayers.mipLevel
+				&& range.baseArrayLayer == subresourceLayers.baseArrayLayer
+				&& range.layerCount == subresourceLayers.layerCount
+				&& offset == Offset3D{ 0, 0, 0 }
+				&& std::max( 1u, extent.width ) >= dimensions.width
+				&& std::max( 1u, extent.height ) >= dimensions.height
+				&& std::max( 1u, extent.depth ) >= dimensions.depth;
+		}
+
+		// The accesses to wait for, before overwriting an image in the given layout.
+		AccessFlags getAccessFlags( ImageLayout layout )
+		{
+			switch ( layout )
+			{
+			case ImageLayout::eUndefined:
+				return 0u;
+
+			case ImageLayout::eColourAttachmentOptimal:
+				return AccessFlag::eColourAttachmentWrite;
+
+			case ImageLayout::eTransferDstOptimal:
+				return AccessFlag::eTransferWrite;
+
+			default:
+				return AccessFlag::eShaderRead;
+			}
+		}
+
+		// The release half of an ownership transfer ignores the destination accesses.
+		BufferMemoryBarrier makeRelease( BufferMemoryBarrier const & barrier )
+		{
+			return BufferMemoryBarrier
+			{
+				barrier.getSrcAccessMask(),
+				0u,
+				barrier.getSrcQueueFamilyIndex(),
+				barrier.getDstQueueFamilyIndex(),
+				barrier.getBuffer(),
+				barrier.getOffset(),
+				barrier.getSize()
+			};
+		}
+
+		// The acquire half of an ownership transfer ignores the source accesses.
+		BufferMemoryBarrier makeAcquire( BufferMemoryBarrier const & barrier )
+		{
+			return BufferMemoryBarrier
+			{
+				0u,
+				barrier.getDstAccessMask(),
+				barrier.getSrcQueueFamilyIndex(),
+				barrier.getDstQueueFamilyIndex(),
+				barrier.getBuffer(),
+				barrier.getOffset(),
+				barrier.getSize()
+			};
+		}
+
+		ImageMemoryBarrier makeRelease( ImageMemoryBarrier const & barrier )
+		{
+			return ImageMemoryBarrier
+			{
+				barrier.getSrcAccessMask(),
+				0u,
+				barrier.getOldLayout(),
+				barrier.getNewLayout(),
+				barrier.getSrcQueueFamilyIndex(),
+				barrier.getDstQueueFamilyIndex(),
+				barrier.getImage(),
+				barrier.getSubresourceRange()
+			};
+		}
+
+		ImageMemoryBarrier makeAcquire( ImageMemoryBarrier const & barrier )
+		{
+			return ImageMemoryBarrier
+			{
+				0u,
+				barrier.getDstAccessMask(),
+				barrier.getOldLayout(),
+				barrier.getNewLayout(),
+				barrier.getSrcQueueFamilyIndex(),
+				barrier.getDstQueueFamilyIndex(),
+				barrier.getImage(),
+				barrier.getSubresourceRange()
+			};
+		}
+	}
+
+	UploadBatcher::UploadBatcher( Device const & device
+		, uint32_t size )
+		: m_device{ device }
+		, m_graphicsFamily{ device.getGraphicsQueue().getFamilyIndex() }
+		, m_transferFamily{ device.getTransferQueue().getFamilyIndex() }
+		, m_useTransferQueue{ m_transferFamily != m_graphicsFamily }
+		, m_size{ size }
+		, m_alignment{ getCopyAlignment( device ) }
+		, m_buffer{ device.createBuffer( size
+			, BufferTarget::eTransferSrc
+			, MemoryPropertyFlag::eHostVisible | MemoryPropertyFlag::eHostCoherent ) }
+		, m_persistent{ device.getRenderer().getFeatures().hasPersistentMapping }
+	{
+		assert( size > 0u );
+
+		if ( m_persistent )
+		{
+			m_data = m_buffer->lock( 0u
+				, m_size
+				, MemoryMapFlag::eWrite | MemoryMapFlag::ePersistent | MemoryMapFlag::eCoherent );
+			m_persistent = m_data != nullptr;
+		}
+
+		doNewBatch();
+	}
+
+	UploadBatcher::~UploadBatcher()
+	{
+		waitAll();
+
+		if ( m_persistent )
+		{
+			m_buffer->unlock();
+		}
+	}
+
+	UploadTicket UploadBatcher::uploadTextureData( ImageSubresourceLayers const & subresourceLayers
+		, Offset3D const & offset
+		, Extent3D const & extent
+		, uint8_t const * const data
+		, uint32_t size
+		, TextureView const & view
+		, ImageLayout currentLayout )
+	{
+		auto range = doAllocate( size );
+		std::memcpy( range.data, data, size );
+		doCommit( range, size );
+
+		auto & commandBuffer = doGetCommandBuffer();
+
+		if ( currentLayout == ImageLayout::eUndefined
+			|| isCoveringView( subresourceLayers, offset, extent, view ) )
+		{
+			// The previous content is discarded, the image doesn't need to be acquired by the transfer queue.
+			commandBuffer.memoryBarrier( PipelineStageFlag::eTopOfPipe
+				, PipelineStageFlag::eTransfer
+				, view.makeTransferDestination( ImageLayout::eUndefined
+					, 0u ) );
+		}
+		else if ( m_useTransferQueue )
+		{
+			// The previous content is kept, the graphics queue hands the image to the transfer queue.
+			auto barrier = view.makeTransferDestination( currentLayout
+				, getAccessFlags( currentLayout )
+				, m_graphicsFamily
+				, m_transferFamily );
+			doGetReleaseCommandBuffer().memoryBarrier( PipelineStageFlag::eFragmentShader
+				, PipelineStageFlag::eBottomOfPipe
+				, makeRelease( barrier ) );
+			commandBuffer.memoryBarrier( PipelineStageFlag::eTopOfPipe
+				, PipelineStageFlag::eTransfer
+				, makeAcquire( barrier ) );
+		}
+		else
+		{
+			commandBuffer.memoryBarrier( PipelineStageFlag::eFragmentShader
+				, PipelineStageFlag::eTransfer
+				, view.makeTransferDestination( currentLayout
+					, getAccessFlags( currentLayout ) ) );
+		}
+
+		commandBuffer.copyToImage( BufferImageCopy
+			{
+				range.offset,
+				0u,
+				0u,
+				subresourceLayers,
+				offset,
+				Extent3D{
+					std::max( 1u, extent.width ),
+					std::max( 1u, extent.height ),
+					std::max( 1u, extent.depth )
+				},
+				size
+			}
+			, *range.buffer
+			, view.getTexture() );
+
+		if ( m_useTransferQueue )
+		{
+			auto barrier = view.makeShaderInputResource( ImageLayout::eTransferDstOptimal
+				, AccessFlag::eTransferWrite
+				, m_transferFamily
+				, m_graphicsFamily );
+			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
+				, PipelineStageFlag::eBottomOfPipe
+				, makeRelease( barrier ) );
+			m_current.acquireCommandBuffer->memoryBarrier( PipelineStageFlag::eTopOfPipe
+				, PipelineStageFlag::eFragmentShader
+				, makeAcquire( barrier ) );
+		}
+		else
+		{
+			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
+				, PipelineStageFlag::eFragmentShader
+				, view.makeShaderInputResource( ImageLayout::eTransferDstOptimal
+					, AccessFlag::eTransferWrite ) );
+		}
+
+		return m_current.ticket;
+	}
+
+	UploadTicket UploadBatcher::uploadTextureData( uint8_t const * const data
+		, uint32_t size
+		, TextureView const & view )
+	{
+		return uploadTextureData( {
+				getAspectMask( view.getFormat() ),
+				view.getSubResourceRange().baseMipLevel,
+				view.getSubResourceRange().baseArrayLayer,
+				view.getSubResourceRange().layerCount
+			}
+			, Offset3D{ 0, 0, 0 }
+			, getMipExtent( view.getTexture().getDimensions()
+				, view.getSubResourceRange().baseMipLevel )
+			, data
+			, size
+			, view
+			, ImageLayout::eUndefined );
+	}
+
+	UploadTicket UploadBatcher::flush()
+	{
+		if ( m_current.recording )
+		{
+			m_current.commandBuffer->end();
+			m_current.fence->reset();
+
+			if ( m_useTransferQueue )
+			{
+				SemaphoreCRefArray waitSemaphores;
+				PipelineStageFlagsArray waitStages;
+
+				if ( m_current.releasing )
+				{
+					m_current.releaseCommandBuffer->end();
+					m_device.getGraphicsQueue().submit( { *m_current.releaseCommandBuffer }
+						, SemaphoreCRefArray{}
+						, PipelineStageFlagsArray{}
+						, { *m_current.releaseSemaphore }
+						, nullptr );
+					waitSemaphores.push_back( *m_current.releaseSemaphore );
+					waitStages.push_back( PipelineStageFlag::eTransfer );
+				}
+
+				m_current.acquireCommandBuffer->end();
+				m_device.getTransferQueue().submit( { *m_current.commandBuffer }
+					, waitSemaphores
+					, waitStages
+					, { *m_current.semaphore }
+					, nullptr );
+				m_device.getGraphicsQueue().submit( { *m_current.acquireCommandBuffer }
+					, { *m_current.semaphore }
+					, { PipelineStageFlag::eAllCommands }
+					, SemaphoreCRefArray{}
+					, m_current.fence.get() );
+			}
+			else
+			{
+				m_device.getGraphicsQueue().submit( *m_current.commandBuffer
+					, m_current.fence.get() );
+			}
+
+			m_current.end = m_head;
+			m_current.recording = false;
+			m_submitted.push_back( std::move( m_current ) );
+			doNewBatch();
+		}
+
+		return m_current.ticket - 1u;
+	}
+
+	bool UploadBatcher::isComplete( UploadTicket ticket )
+	{
+		if ( ticket >= m_current.ticket )
+		{
+			return false;
+		}
+
+		doRetire( 0u );
+		return ticket <= m_lastRetired;
+	}
+
+	void UploadBatcher::wait( UploadTicket ticket )
+	{
+		assert( ticket <= m_current.ticket && "This ticket hasn't been given yet" );
+
+		if ( ticket == m_current.ticket )
+		{
+			flush();
+		}
+
+		doRetire( ticket );
+	}
+
+	void UploadBatcher::waitAll()
+	{
+		wait( flush() );
+	}
+
+	UploadTicket UploadBatcher::doUploadBuffer( uint8_t const * const data
+		, uint32_t size
+		, uint32_t offset
+		, BufferBase const & buffer
+		, PipelineStageFlags dstStageFlags
+		, AccessFlags dstAccessFlags )
+	{
+		doPrepareBuffer( buffer );
+		auto range = doAllocate( size );
+		std::memcpy( range.data, data, size );
+		doCommit( range, size );
+		doCopyBuffer( range
+			, size
+			, offset
+			, buffer
+			, dstStageFlags
+			, dstAccessFlags );
+		return m_current.ticket;
+	}
+
+	void UploadBatcher::doCopyBuffer( Range const & range
+		, uint32_t size
+		, uint32_t offset
+		, BufferBase const & buffer
+		, PipelineStageFlags dstStageFlags
+		, AccessFlags dstAccessFlags )
+	{
+		auto & commandBuffer = doGetCommandBuffer();
+
+		auto srcStageFlags = buffer.getCompatibleStageFlags();
+
+		if ( m_useTransferQueue )
+		{
+			// The graphics queue hands the buffer to the transfer queue, once done with it, so its content is kept.
+			auto barrier = buffer.makeTransferDestination( m_graphicsFamily
+				, m_transferFamily );
+			doGetReleaseCommandBuffer().memoryBarrier( srcStageFlags
+				, PipelineStageFlag::eBottomOfPipe
+				, makeRelease( barrier ) );
+			commandBuffer.memoryBarrier( PipelineStageFlag::eTopOfPipe
+				, PipelineStageFlag::eTransfer
+				, makeAcquire( barrier ) );
+			m_current.buffers.push_back( &buffer );
+		}
+		else
+		{
+			commandBuffer.memoryBarrier( srcStageFlags
+				, PipelineStageFlag::eTransfer
+				, buffer.makeTransferDestination() );
+		}
+
+		commandBuffer.copyBuffer( BufferCopy
+			{
+				range.offset,
+				offset,
+				size
+			}
+			, *range.buffer
+			, buffer );
+
+		if ( m_useTransferQueue )
+		{
+			auto barrier = buffer.makeMemoryTransitionBarrier( dstAccessFlags
+				, m_transferFamily
+				, m_graphicsFamily );
+			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
+				, PipelineStageFlag::eBottomOfPipe
+				, makeRelease( barrier ) );
+			m_current.acquireCommandBuffer->memoryBarrier( PipelineStageFlag::eTopOfPipe
+				, dstStageFlags
+				, makeAcquire( barrier ) );
+		}
+		else
+		{
+			commandBuffer.memoryBarrier( PipelineStageFlag::eTransfer
+				, dstStageFlags
+				, buffer.makeMemoryTransitionBarrier( dstAccessFlags ) );
+		}
+	}
+
+	void UploadBatcher::doPrepareBuffer( BufferBase const & buffer )
+	{
+		// The buffer is already handed back to the graphics queue at the end of the current batch.
+		if ( m_useTransferQueue
+			&& std::find( m_current.buffers.begin(), m_current.buffers.end(), &buffer ) != m_current.buffers.end() )
+		{
+			flush();
+		}
+	}
+
+	UploadBatcher::Range UploadBatcher::doAllocate( uint32_t size )
+	{
+		assert( size > 0u );
+
+		if ( size > m_size )
+		{
+			// Too big for the ring, the upload gets its own staging buffer, kept alive with its batch.
+			auto buffer = m_device.createBuffer( size
+				, BufferTarget::eTransferSrc
+				, MemoryPropertyFlag::eHostVisible | MemoryPropertyFlag::eHostCoherent );
+			auto data = buffer->lock( 0u
+				, size
+				, MemoryMapFlag::eWrite | MemoryMapFlag::eInvalidateRange );
+
+			if ( !data )
+			{
+				throw Exception{ Result::eErrorMemoryMapFailed, "Upload staging buffer memory mapping" };
+			}
+
+			m_current.oversized.push_back( std::move( buffer ) );
+			return { m_current.oversized.back().get(), 0u, data };
+		}
+
+		uint32_t offset{ 0u };
+
+		while ( !doFits( size, offset ) )
+		{
+			// The ring is full: submit what has been recorded until now, then wait for the oldest batch.
+			if ( m_current.recording )
+			{
+				flush();
+			}
+			else
+			{
+				assert( !m_submitted.empty() );
+				doRetire( m_submitted.front().ticket );
+			}
+		}
+
+		m_head = offset + size;
+		uint8_t * data{ nullptr };
+
+		if ( m_persistent )
+		{
+			data = m_data + offset;
+		}
+		else
+		{
+			// The ring guarantees the GPU doesn't use this range anymore.
+			data = m_buffer->lock( offset
+				, size
+				, MemoryMapFlag::eWrite | MemoryMapFlag::eInvalidateRange | MemoryMapFlag::eUnsynchronised );
+
+			if ( !data )
+			{
+				throw Exception{ Result::eErrorMemoryMapFailed, "Upload ring buffer memory mapping" };
+			}
+		}
+
+		return { m_buffer.get(), offset, data };
+	}
+
+	void UploadBatcher::doCommit( Range const & range
+		, uint32_t size )
+	{
+		if ( range.buffer != m_buffer.get()
+			|| !m_persistent )
+		{
+			range.buffer->flush( range.offset, size );
+			range.buffer->unlock();
+		}
+	}
+
+	CommandBuffer const & UploadBatcher::doGetCommandBuffer()
+	{
+		if ( !m_current.recording )
+		{
+			m_current.commandBuffer->begin( CommandBufferUsageFlag::eOneTimeSubmit );
+
+			if ( m_useTransferQueue )
+			{
+				m_current.acquireCommandBuffer->begin( CommandBufferUsageFlag::eOneTimeSubmit );
+			}
+
+			m_current.recording = true;
+		}
+
+		return *m_current.commandBuffer;
+	}
+
+	CommandBuffer const & UploadBatcher::doGetReleaseCommandBuffer()
+	{
+		if ( !m_current.releasing )
+		{
+			m_current.releaseCommandBuffer->begin( CommandBufferUsageFlag::eOneTimeSubmit );
+			m_current.releasing = true;
+		}
+
+		return *m_current.releaseCommandBuffer;
+	}
+
+	bool UploadBatcher::doFits( uint32_t size
+		, uint32_t & offset )const
+	{
+		auto aligned = getAlignedOffset( m_head, m_alignment );
+
+		if ( m_head >= m_tail )
+		{
+			// The used range is [tail, head), try after it, then wrap at the beginning of the ring.
+			if ( aligned + size <= m_size )
+			{
+				offset = aligned;
+				return true;
+			}
+
+			if ( size < m_tail )
+			{
+				offset = 0u;
+				return true;
+			}
+
+			return false;
+		}
+
+		// The used range is wrapped, the head must not reach the tail.
+		if ( aligned + size < m_tail )
+		{
+			offset = aligned;
+			return true;
+		}
+
+		return false;
+	}
+
+	void UploadBatcher::doRetire( UploadTicket waited )
+	{
+		// The batches are retired in submission order, the ring tail following them.
+		while ( !m_submitted.empty() )
+		{
+			auto & batch = m_submitted.front();
+			auto timeout = batch.ticket <= waited
+				? FenceTimeout
+				: 0u;
+
+			if ( batch.fence->wait( timeout ) != WaitResult::eSuccess )
+			{
+				break;
+			}
+
+			m_tail = batch.end;
+			m_lastRetired = batch.ticket;
+			batch.oversized.clear();
+			m_free.push_back( std::move( batch ) );
+			m_submitted.pop_front();
+		}
+
+		if ( m_submitted.empty()
+			&& !m_current.recording )
+		{
+			m_head = 0u;
+			m_tail = 0u;
+		}
+	}
+
+	void UploadBatcher::doNewBatch()
+	{
+		if ( m_free.empty() )
+		{
+			m_current.fence = m_device.createFence();
+
+			if ( m_useTransferQueue )
+			{
+				m_current.commandBuffer = m_device.getTransferCommandPool().createCommandBuffer( true );
+				m_current.acquireCommandBuffer = m_device.getGraphicsCommandPool().createCommandBuffer( true );
+				m_current.semaphore = m_device.createSemaphore();
+				m_current.releaseCommandBuffer = m_device.getGraphicsCommandPool().createCommandBuffer( true );
+				m_current.releaseSemaphore = m_device.createSemaphore();
+			}
+			else
+			{
+				m_current.commandBuffer = m_device.getGraphicsCommandPool().createCommandBuffer( true );
+			}
+		}
+		else
+		{
+			m_current = std::move( m_free.back() );
+			m_free.pop_back();
+		}
+
+		m_current.ticket = ++m_lastTicket;
+		m_current.end = 0u;
+		m_current.oversized.clear();
+		m_current.buffers.clear();
+		m_current.recording = false;
+		m_current.releasing = false;
+	}
+}
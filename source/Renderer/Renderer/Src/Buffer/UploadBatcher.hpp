@@ -0,0 +1,349 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#ifndef ___Renderer_UploadBatcher_HPP___
+#define ___Renderer_UploadBatcher_HPP___
+#pragma once
+
+#include "Buffer/Buffer.hpp"
+#include "Buffer/VertexBuffer.hpp"
+#include "Buffer/UniformBuffer.hpp"
+#include "Command/CommandBuffer.hpp"
+#include "Sync/BufferMemoryBarrier.hpp"
+#include "Sync/Fence.hpp"
+#include "Sync/Semaphore.hpp"
+
+#include <deque>
+
+namespace renderer
+{
+	/**
+	*\~english
+	*\brief
+	*	Identifies the batch an upload was recorded in.
+	*\remarks
+	*	The tickets grow with the batches, 0 is never given and is always complete.
+	*\~french
+	*\brief
+	*	Identifie le lot dans lequel un transfert a été enregistré.
+	*\remarks
+	*	Les tickets croissent avec les lots, 0 n'est jamais donné et est toujours terminé.
+	*/
+	using UploadTicket = uint64_t;
+	/**
+	*\~english
+	*\brief
+	*	Batches uploads to VRAM, without waiting for each of them.
+	*\remarks
+	*	The data is copied into a host visible ring buffer, and the copies are recorded
+	*	into one command buffer, submitted once, when flush is called or when the ring is full.
+	*	Each upload returns the ticket of its batch, which can be polled or waited for.
+	*	The uploads bigger than the ring get their own staging buffer, released with their batch.
+	*	When the device has a dedicated transfer queue, the copies are submitted to it, and the resources
+	*	are handed to the graphics queue through queue family ownership transfers, waited for by a semaphore.
+	*	The buffers and the partially uploaded textures are first released by the graphics queue, after its
+	*	previous submissions, to keep their content. A buffer uploaded twice starts a new batch.
+	*	The fully overwritten textures must not be in use by the graphics queue.
+	*	Otherwise, the batches are submitted to the graphics queue.
+	*	The batcher must be used from one thread at a time.
+	*\~french
+	*\brief
+	*	Groupe les transferts vers la VRAM, sans attendre chacun d'entre eux.
+	*\remarks
+	*	Les données sont copiées dans un tampon circulaire visible par l'hôte, et les copies sont enregistrées
+	*	dans un seul tampon de commandes, soumis une fois, quand flush est appelée ou quand le tampon circulaire est plein.
+	*	Chaque transfert retourne le ticket de son lot, qui peut être interrogé ou attendu.
+	*	Les transferts plus gros que le tampon circulaire ont leur propre tampon de transfert, libéré avec leur lot.
+	*	Quand le périphérique a une file dédiée aux transferts, les copies y sont soumises, et les ressources
+	*	sont transmises à la file graphique via des transferts de propriété entre familles de files, attendus via un sémaphore.
+	*	Les tampons et les textures partiellement transférées sont d'abord libérés par la file graphique, après
+	*	ses soumissions précédentes, afin de conserver leur contenu. Un tampon transféré deux fois démarre un nouveau lot.
+	*	Les textures entièrement écrasées ne doivent pas être utilisées par la file graphique.
+	*	Sinon, les lots sont soumis à la file graphique.
+	*	Le batcher doit être utilisé par un seul thread à la fois.
+	*/
+	class UploadBatcher
+	{
+	public:
+		/**
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] size
+		*	The ring buffer size.
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] size
+		*	La taille du tampon circulaire.
+		*/
+		UploadBatcher( Device const & device
+			, uint32_t size = 32u * 1024u * 1024u );
+		/**
+		*\~english
+		*\brief
+		*	Destructor, submits the pending uploads and waits for all of them.
+		*\~french
+		*\brief
+		*	Destructeur, soumet les transferts en attente et les attend tous.
+		*/
+		~UploadBatcher();
+		/**
+		*\name
+		*	Texture.
+		**/
+		/**@{*/
+		/**
+		*\~english
+		*\brief
+		*	Uploads data to a region of a texture.
+		*\remarks
+		*	When the copy covers all of the view's subresources, their previous content is discarded.
+		*	Otherwise, it is kept, and the image must be in \p currentLayout.
+		*\param[in] subresourceLayers
+		*	The destination subresources.
+		*\param[in] offset
+		*	The region offset.
+		*\param[in] extent
+		*	The region extent.
+		*\param[in] data
+		*	The data.
+		*\param[in] size
+		*	The data size.
+		*\param[in] view
+		*	The destination view.
+		*\param[in] currentLayout
+		*	The image layout before the upload, ImageLayout::eUndefined to discard its content.
+		*\return
+		*	The upload's batch ticket.
+		*\~french
+		*\brief
+		*	Transfère des données vers une région d'une texture.
+		*\remarks
+		*	Quand la copie couvre toutes les sous-ressources de la vue, leur contenu précédent est abandonné.
+		*	Sinon, il est conservé, et l'image doit être dans le layout \p currentLayout.
+		*\param[in] subresourceLayers
+		*	Les sous-ressources de destination.
+		*\param[in] offset
+		*	Le décalage de la région.
+		*\param[in] extent
+		*	Les dimensions de la région.
+		*\param[in] data
+		*	Les données.
+		*\param[in] size
+		*	La taille des données.
+		*\param[in] view
+		*	La vue de destination.
+		*\param[in] currentLayout
+		*	Le layout de l'image avant le transfert, ImageLayout::eUndefined pour abandonner son contenu.
+		*\return
+		*	Le ticket du lot du transfert.
+		*/
+		UploadTicket uploadTextureData( ImageSubresourceLayers const & subresourceLayers
+			, Offset3D const & offset
+			, Extent3D const & extent
+			, uint8_t const * const data
+			, uint32_t size
+			, TextureView const & view
+			, ImageLayout currentLayout );
+		inline UploadTicket uploadTextureData( ImageSubresourceLayers const & subresourceLayers
+			, Offset3D const & offset
+			, Extent3D const & extent
+			, ByteArray const & data
+			, TextureView const & view
+			, ImageLayout currentLayout );
+		UploadTicket uploadTextureData( uint8_t const * const data
+			, uint32_t size
+			, TextureView const & view );
+		inline UploadTicket uploadTextureData( ByteArray const & data
+			, TextureView const & view );
+		/**@}*/
+		/**
+		*\name
+		*	Buffer.
+		**/
+		/**@{*/
+		template< typename T >
+		inline UploadTicket uploadBufferData( std::vector< T > const & data
+			, Buffer< T > const & buffer );
+		template< typename T >
+		inline UploadTicket uploadBufferData( uint8_t const * const data
+			, uint32_t size
+			, uint32_t offset
+			, Buffer< T > const & buffer );
+		/**@}*/
+		/**
+		*\name
+		*	Vertex buffer.
+		**/
+		/**@{*/
+		template< typename T >
+		inline UploadTicket uploadVertexData( std::vector< T > const & data
+			, VertexBuffer< T > const & buffer );
+		template< typename T >
+		inline UploadTicket uploadVertexData( uint8_t const * const data
+			, uint32_t size
+			, uint32_t offset
+			, VertexBuffer< T > const & buffer );
+		/**@}*/
+		/**
+		*\name
+		*	Uniform buffer.
+		**/
+		/**@{*/
+		template< typename T >
+		inline UploadTicket uploadUniformData( std::vector< T > const & data
+			, UniformBuffer< T > const & buffer
+			, PipelineStageFlags dstStageFlags );
+		template< typename T >
+		inline UploadTicket uploadUniformData( T const * const data
+			, uint32_t count
+			, uint32_t offset
+			, UniformBuffer< T > const & buffer
+			, PipelineStageFlags dstStageFlags );
+		/**@}*/
+		/**
+		*\~english
+		*\brief
+		*	Submits the current batch, if it holds uploads.
+		*\return
+		*	The ticket of the last submitted batch.
+		*\~french
+		*\brief
+		*	Soumet le lot courant, s'il contient des transferts.
+		*\return
+		*	Le ticket du dernier lot soumis.
+		*/
+		UploadTicket flush();
+		/**
+		*\~english
+		*\brief
+		*	Tells, without waiting, if the uploads of a batch are done.
+		*\remarks
+		*	The current batch is never complete, until it is submitted.
+		*\param[in] ticket
+		*	The batch ticket.
+		*\~french
+		*\brief
+		*	Dit, sans attendre, si les transferts d'un lot sont terminés.
+		*\remarks
+		*	Le lot courant n'est jamais terminé, tant qu'il n'est pas soumis.
+		*\param[in] ticket
+		*	Le ticket du lot.
+		*/
+		bool isComplete( UploadTicket ticket );
+		/**
+		*\~english
+		*\brief
+		*	Waits for the uploads of a batch, submitting it first if it is the current one.
+		*\param[in] ticket
+		*	The batch ticket.
+		*\~french
+		*\brief
+		*	Attend les transferts d'un lot, en le soumettant d'abord si c'est le lot courant.
+		*\param[in] ticket
+		*	Le ticket du lot.
+		*/
+		void wait( UploadTicket ticket );
+		/**
+		*\~english
+		*\brief
+		*	Submits the current batch and waits for all the uploads.
+		*\~french
+		*\brief
+		*	Soumet le lot courant et attend tous les transferts.
+		*/
+		void waitAll();
+		/**
+		*\~english
+		*\return
+		*	The ring buffer size.
+		*\~french
+		*\return
+		*	La taille du tampon circulaire.
+		*/
+		inline uint32_t getSize()const
+		{
+			return m_size;
+		}
+
+	private:
+		struct Batch
+		{
+			UploadTicket ticket;
+			CommandBufferPtr commandBuffer;
+			// Acquires the uploaded resources on the graphics queue, when the copies are done on the transfer queue.
+			CommandBufferPtr acquireCommandBuffer;
+			SemaphorePtr semaphore;
+			// Releases the partially uploaded textures from the graphics queue, before the copies on the transfer queue.
+			CommandBufferPtr releaseCommandBuffer;
+			SemaphorePtr releaseSemaphore;
+			bool releasing;
+			FencePtr fence;
+			// The ring head when the batch was submitted, the ring tail once it is done.
+			uint32_t end;
+			std::vector< BufferBasePtr > oversized;
+			// The buffers owned by the transfer queue, each one is released and acquired once per batch.
+			std::vector< BufferBase const * > buffers;
+			bool recording;
+		};
+
+		struct Range
+		{
+			BufferBase const * buffer;
+			uint32_t offset;
+			uint8_t * data;
+		};
+
+		UploadTicket doUploadBuffer( uint8_t const * const data
+			, uint32_t size
+			, uint32_t offset
+			, BufferBase const & buffer
+			, PipelineStageFlags dstStageFlags
+			, AccessFlags dstAccessFlags );
+		void doCopyBuffer( Range const & range
+			, uint32_t size
+			, uint32_t offset
+			, BufferBase const & buffer
+			, PipelineStageFlags dstStageFlags
+			, AccessFlags dstAccessFlags );
+		void doPrepareBuffer( BufferBase const & buffer );
+		Range doAllocate( uint32_t size );
+		void doCommit( Range const & range
+			, uint32_t size );
+		CommandBuffer const & doGetCommandBuffer();
+		CommandBuffer const & doGetReleaseCommandBuffer();
+		bool doFits( uint32_t size
+			, uint32_t & offset )const;
+		void doRetire( UploadTicket waited );
+		void doNewBatch();
+
+	private:
+		Device const & m_device;
+		uint32_t m_graphicsFamily;
+		uint32_t m_transferFamily;
+		bool m_useTransferQueue;
+		uint32_t m_size;
+		uint32_t m_alignment;
+		BufferBasePtr m_buffer;
+		bool m_persistent;
+		uint8_t * m_data{ nullptr };
+		uint32_t m_head{ 0u };
+		uint32_t m_tail{ 0u };
+		Batch m_current;
+		std::deque< Batch > m_submitted;
+		// Command buffers and fences of the retired batches, reused by the next ones.
+		std::vector< Batch > m_free;
+		UploadTicket m_lastTicket{ 0u };
+		UploadTicket m_lastRetired{ 0u };
+	};
+}
+
+#include "UploadBatcher.inl"
+
+#endif
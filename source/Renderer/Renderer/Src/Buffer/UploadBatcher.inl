@@ -0,0 +1,122 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include <cstring>
+
+namespace renderer
+{
+	inline UploadTicket UploadBatcher::uploadTextureData( ImageSubresourceLayers const & subresourceLayers
+		, Offset3D const & offset
+		, Extent3D const & extent
+		, ByteArray const & data
+		, TextureView const & view
+		, ImageLayout currentLayout )
+	{
+		return uploadTextureData( subresourceLayers
+			, offset
+			, extent
+			, data.data()
+			, uint32_t( data.size() )
+			, view
+			, currentLayout );
+	}
+
+	inline UploadTicket UploadBatcher::uploadTextureData( ByteArray const & data
+		, TextureView const & view )
+	{
+		return uploadTextureData( data.data()
+			, uint32_t( data.size() )
+			, view );
+	}
+
+	template< typename T >
+	inline UploadTicket UploadBatcher::uploadBufferData( std::vector< T > const & data
+		, Buffer< T > const & buffer )
+	{
+		return uploadBufferData( reinterpret_cast< uint8_t const * const >( data.data() )
+			, uint32_t( data.size() * sizeof( T ) )
+			, 0u
+			, buffer );
+	}
+
+	template< typename T >
+	inline UploadTicket UploadBatcher::uploadBufferData( uint8_t const * const data
+		, uint32_t size
+		, uint32_t offset
+		, Buffer< T > const & buffer )
+	{
+		return doUploadBuffer( data
+			, size
+			, offset
+			, buffer.getBuffer()
+			, PipelineStageFlag::eAllCommands
+			, AccessFlag::eMemoryRead );
+	}
+
+	template< typename T >
+	inline UploadTicket UploadBatcher::uploadVertexData( std::vector< T > const & data
+		, VertexBuffer< T > const & buffer )
+	{
+		return uploadVertexData( reinterpret_cast< uint8_t const * const >( data.data() )
+			, uint32_t( data.size() * sizeof( T ) )
+			, 0u
+			, buffer );
+	}
+
+	template< typename T >
+	inline UploadTicket UploadBatcher::uploadVertexData( uint8_t const * const data
+		, uint32_t size
+		, uint32_t offset
+		, VertexBuffer< T > const & buffer )
+	{
+		return doUploadBuffer( data
+			, size
+			, offset
+			, buffer.getBuffer()
+			, PipelineStageFlag::eVertexInput
+			, AccessFlag::eVertexAttributeRead );
+	}
+
+	template< typename T >
+	inline UploadTicket UploadBatcher::uploadUniformData( std::vector< T > const & data
+		, UniformBuffer< T > const & buffer
+		, PipelineStageFlags dstStageFlags )
+	{
+		return uploadUniformData( data.data()
+			, uint32_t( data.size() )
+			, 0u
+			, buffer
+			, dstStageFlags );
+	}
+
+	template< typename T >
+	inline UploadTicket UploadBatcher::uploadUniformData( T const * const data
+		, uint32_t count
+		, uint32_t offset
+		, UniformBuffer< T > const & buffer
+		, PipelineStageFlags dstStageFlags )
+	{
+		auto elemAlignedSize = buffer.getAlignedSize();
+		auto size = count * elemAlignedSize;
+		doPrepareBuffer( buffer.getUbo().getBuffer() );
+		auto range = doAllocate( size );
+		auto dst = range.data;
+
+		// The elements are padded in place, in the staging memory.
+		for ( uint32_t i = 0; i < count; ++i )
+		{
+			std::memcpy( dst, &data[i], sizeof( T ) );
+			dst += elemAlignedSize;
+		}
+
+		doCommit( range, size );
+		doCopyBuffer( range
+			, size
+			, offset * elemAlignedSize
+			, buffer.getUbo().getBuffer()
+			, dstStageFlags
+			, AccessFlag::eUniformRead );
+		return m_current.ticket;
+	}
+}
@@ -19,9 +19,21 @@ namespace renderer
 	*\~english
 	*\brief
 	*	A command buffer.
+	*\remarks
+	*	The member functions are const, but they modify the recording state:
+	*	a command buffer must only be recorded by one thread at a time.
+	*	Secondary command buffers can be recorded on worker threads, from per thread pools,
+	*	and then be executed in a primary command buffer, through executeCommands.
+	*	The OpenGL backends record on the CPU side and replay on the context thread, at submit time.
 	*\~french
 	*\brief
 	*	Un tampon de commandes.
+	*\remarks
+	*	Les fonctions membres sont constantes, mais modifient l'état d'enregistrement :
+	*	un tampon de commandes ne doit être enregistré que par un thread à la fois.
+	*	Des tampons de commandes secondaires peuvent être enregistrés sur des threads de travail, depuis des pools par thread,
+	*	puis être exécutés dans un tampon de commandes primaire, via executeCommands.
+	*	Les renderers OpenGL enregistrent côté CPU et rejouent sur le thread du contexte, lors de la soumission.
 	*/
 	class CommandBuffer
 	{
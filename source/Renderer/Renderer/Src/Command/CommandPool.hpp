@@ -11,8 +11,22 @@ See LICENSE file in root folder.
 namespace renderer
 {
 	/**
+	*\~english
+	*\brief
+	*	Command buffers pool.
+	*\remarks
+	*	A pool and the command buffers allocated from it must be externally synchronised:
+	*	to record on several threads, use one pool per thread.
+	*	Command buffers from different pools may be recorded concurrently.
+	*\~french
 	*\brief
 	*	Pool de tampons de commandes.
+	*\remarks
+	*	Un pool et les tampons de commandes qu'il a alloués doivent être synchronisés de manière externe :
+	*	pour enregistrer sur plusieurs threads, utiliser un pool par thread.
+	*	Des tampons de commandes issus de pools différents peuvent être enregistrés simultanément.
+	*\see
+	*	renderer::ParallelCommandRecorder
 	*/
 	class CommandPool
 	{
@@ -0,0 +1,173 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Command/ParallelCommandRecorder.hpp"
+
+#include "Command/CommandBuffer.hpp"
+#include "Core/Device.hpp"
+
+#include <algorithm>
+
+namespace renderer
+{
+	ParallelCommandRecorder::ParallelCommandRecorder( Device const & device
+		, uint32_t queueFamilyIndex
+		, uint32_t threadCount )
+	{
+		if ( !threadCount )
+		{
+			threadCount = std::max( 1u, std::thread::hardware_concurrency() );
+		}
+
+		// Pools and buffers are created here, only their recording is spread across threads.
+		m_recorders.resize( threadCount );
+
+		for ( auto & recorder : m_recorders )
+		{
+			recorder.pool = device.createCommandPool( queueFamilyIndex
+				, CommandPoolCreateFlag::eResetCommandBuffer );
+			recorder.commandBuffer = recorder.pool->createCommandBuffer( false );
+		}
+
+		for ( auto index = 1u; index < threadCount; ++index )
+		{
+			m_threads.emplace_back( [this, index]()
+			{
+				doWork( index );
+			} );
+		}
+	}
+
+	ParallelCommandRecorder::~ParallelCommandRecorder()
+	{
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			m_stopped = true;
+		}
+
+		m_start.notify_all();
+
+		for ( auto & thread : m_threads )
+		{
+			thread.join();
+		}
+	}
+
+	CommandBufferCRefArray const & ParallelCommandRecorder::record( CommandBufferInheritanceInfo const & inheritanceInfo
+		, uint32_t count
+		, RecordFunction const & function
+		, CommandBufferUsageFlags flags )
+	{
+		auto threadCount = getThreadCount();
+		auto rangeSize = count / threadCount;
+		auto remainder = count % threadCount;
+		auto first = 0u;
+
+		for ( auto index = 0u; index < threadCount; ++index )
+		{
+			auto & recorder = m_recorders[index];
+			recorder.first = first;
+			recorder.count = rangeSize + ( index < remainder ? 1u : 0u );
+			first += recorder.count;
+		}
+
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+			m_inheritanceInfo = &inheritanceInfo;
+			m_function = &function;
+			m_flags = flags;
+			m_exception = nullptr;
+			m_pending = threadCount - 1u;
+			++m_generation;
+		}
+
+		m_start.notify_all();
+		doRecord( 0u );
+
+		{
+			std::unique_lock< std::mutex > lock{ m_mutex };
+			m_end.wait( lock, [this]()
+			{
+				return m_pending == 0u;
+			} );
+		}
+
+		if ( m_exception )
+		{
+			std::rethrow_exception( m_exception );
+		}
+
+		m_commandBuffers.clear();
+
+		for ( auto & recorder : m_recorders )
+		{
+			if ( recorder.count )
+			{
+				m_commandBuffers.emplace_back( *recorder.commandBuffer );
+			}
+		}
+
+		return m_commandBuffers;
+	}
+
+	void ParallelCommandRecorder::doRecord( uint32_t index )
+	{
+		auto & recorder = m_recorders[index];
+
+		if ( !recorder.count )
+		{
+			return;
+		}
+
+		try
+		{
+			recorder.commandBuffer->begin( m_flags, *m_inheritanceInfo );
+			( *m_function )( *recorder.commandBuffer
+				, recorder.first
+				, recorder.count );
+			recorder.commandBuffer->end();
+		}
+		catch ( ... )
+		{
+			std::lock_guard< std::mutex > lock{ m_mutex };
+
+			if ( !m_exception )
+			{
+				m_exception = std::current_exception();
+			}
+		}
+	}
+
+	void ParallelCommandRecorder::doWork( uint32_t index )
+	{
+		uint64_t generation = 0u;
+
+		while ( true )
+		{
+			{
+				std::unique_lock< std::mutex > lock{ m_mutex };
+				m_start.wait( lock, [this, &generation]()
+				{
+					return m_stopped || m_generation != generation;
+				} );
+
+				if ( m_stopped )
+				{
+					return;
+				}
+
+				generation = m_generation;
+			}
+
+			doRecord( index );
+
+			{
+				std::lock_guard< std::mutex > lock{ m_mutex };
+				--m_pending;
+			}
+
+			m_end.notify_one();
+		}
+	}
+}
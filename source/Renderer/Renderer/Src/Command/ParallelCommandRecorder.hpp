@@ -0,0 +1,166 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#ifndef ___Renderer_ParallelCommandRecorder_HPP___
+#define ___Renderer_ParallelCommandRecorder_HPP___
+#pragma once
+
+#include "Command/CommandBufferInheritanceInfo.hpp"
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace renderer
+{
+	/**
+	*\~english
+	*\brief
+	*	Records a range of draws into secondary command buffers, using several threads.
+	*\remarks
+	*	Each thread owns its command pool and its secondary command buffer.
+	*	The calling thread records the first sub-range, the worker threads record the other ones.
+	*	The resulting command buffers are meant to be given to CommandBuffer::executeCommands,
+	*	inside the render pass described by the inheritance informations.
+	*	The record function is called concurrently, it must only modify the command buffer it receives.
+	*\~french
+	*\brief
+	*	Enregistre un intervalle de dessins dans des tampons de commandes secondaires, en utilisant plusieurs threads.
+	*\remarks
+	*	Chaque thread possède son pool de commandes et son tampon de commandes secondaire.
+	*	Le thread appelant enregistre le premier sous-intervalle, les threads de travail enregistrent les autres.
+	*	Les tampons de commandes résultants sont destinés à CommandBuffer::executeCommands,
+	*	dans la passe de rendu décrite par les informations d'héritage.
+	*	La fonction d'enregistrement est appelée de manière concurrente, elle ne doit modifier que le tampon de commandes qu'elle reçoit.
+	*/
+	class ParallelCommandRecorder
+	{
+	public:
+		/**
+		*\~english
+		*\brief
+		*	The function recording the draws [first, first + count) into a command buffer.
+		*\~french
+		*\brief
+		*	La fonction enregistrant les dessins [first, first + count) dans un tampon de commandes.
+		*/
+		using RecordFunction = std::function< void( CommandBuffer const & commandBuffer
+			, uint32_t first
+			, uint32_t count ) >;
+
+	public:
+		/**
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] queueFamilyIndex
+		*	The queue family index the command pools are created for.
+		*\param[in] threadCount
+		*	The number of recording threads, including the calling one (0 to use the hardware concurrency).
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] queueFamilyIndex
+		*	L'index de la famille de files pour laquelle les pools de commandes sont créés.
+		*\param[in] threadCount
+		*	Le nombre de threads d'enregistrement, thread appelant inclus (0 pour utiliser la concurrence matérielle).
+		*/
+		ParallelCommandRecorder( Device const & device
+			, uint32_t queueFamilyIndex
+			, uint32_t threadCount = 0u );
+		/**
+		*\~english
+		*\brief
+		*	Destructor, stops the worker threads.
+		*\~french
+		*\brief
+		*	Destructeur, arrête les threads de travail.
+		*/
+		~ParallelCommandRecorder();
+		/**
+		*\~english
+		*\brief
+		*	Splits [0, count) in contiguous sub-ranges and records each of them on its own thread.
+		*\remarks
+		*	Blocks until all the threads are done.
+		*	If a record function throws, the first exception is rethrown here.
+		*\param[in] inheritanceInfo
+		*	The inheritance informations given to the secondary command buffers.
+		*\param[in] count
+		*	The number of draws.
+		*\param[in] function
+		*	The record function.
+		*\param[in] flags
+		*	The usage flags for the secondary command buffers.
+		*\return
+		*	The recorded command buffers, in draws order, empty sub-ranges being omitted.
+		*\~french
+		*\brief
+		*	Découpe [0, count) en sous-intervalles contigus et enregistre chacun d'eux sur son propre thread.
+		*\remarks
+		*	Bloque jusqu'à ce que tous les threads aient fini.
+		*	Si une fonction d'enregistrement lance une exception, la première est relancée ici.
+		*\param[in] inheritanceInfo
+		*	Les informations d'héritage données aux tampons de commandes secondaires.
+		*\param[in] count
+		*	Le nombre de dessins.
+		*\param[in] function
+		*	La fonction d'enregistrement.
+		*\param[in] flags
+		*	Les indicateurs d'utilisation des tampons de commandes secondaires.
+		*\return
+		*	Les tampons de commandes enregistrés, dans l'ordre des dessins, les sous-intervalles vides étant omis.
+		*/
+		CommandBufferCRefArray const & record( CommandBufferInheritanceInfo const & inheritanceInfo
+			, uint32_t count
+			, RecordFunction const & function
+			, CommandBufferUsageFlags flags = CommandBufferUsageFlag::eRenderPassContinue );
+		/**
+		*\~english
+		*\return
+		*	The number of recording threads, including the calling one.
+		*\~french
+		*\return
+		*	Le nombre de threads d'enregistrement, thread appelant inclus.
+		*/
+		inline uint32_t getThreadCount()const
+		{
+			return uint32_t( m_recorders.size() );
+		}
+
+	private:
+		void doRecord( uint32_t index );
+		void doWork( uint32_t index );
+
+	private:
+		struct Recorder
+		{
+			CommandPoolPtr pool;
+			CommandBufferPtr commandBuffer;
+			uint32_t first{ 0u };
+			uint32_t count{ 0u };
+		};
+
+		std::vector< Recorder > m_recorders;
+		std::vector< std::thread > m_threads;
+		std::mutex m_mutex;
+		std::condition_variable m_start;
+		std::condition_variable m_end;
+		uint64_t m_generation{ 0u };
+		uint32_t m_pending{ 0u };
+		bool m_stopped{ false };
+		CommandBufferInheritanceInfo const * m_inheritanceInfo{ nullptr };
+		RecordFunction const * m_function{ nullptr };
+		CommandBufferUsageFlags m_flags;
+		std::exception_ptr m_exception;
+		CommandBufferCRefArray m_commandBuffers;
+	};
+}
+
+#endif
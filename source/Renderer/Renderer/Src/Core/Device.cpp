@@ -17,14 +17,58 @@ See LICENSE file in root folder.
 #include "RenderPass/RenderSubpassState.hpp"
 #include "Utils/CallStack.hpp"
 
+#include <algorithm>
+
 namespace renderer
 {
+	namespace
+	{
+		template< typename FlagType, typename Function >
+		void forEachFlag( FlagCombination< FlagType > flags
+			, Function function )
+		{
+			using BaseType = typename FlagCombination< FlagType >::BaseType;
+
+			for ( BaseType bit = 1u; bit && bit <= flags.value(); bit <<= 1 )
+			{
+				if ( flags.value() & bit )
+				{
+					function( FlagType( bit ) );
+				}
+			}
+		}
+
+		void accumulate( MemoryUsageStatistics & result
+			, MemoryUsageStatistics const & usage )
+		{
+			result.allocatedBytes += usage.allocatedBytes;
+			result.usedBytes += usage.usedBytes;
+			result.blockCount += usage.blockCount;
+			result.allocationCount += usage.allocationCount;
+			result.freeBytes += usage.freeBytes;
+			result.largestFreeBlock = std::max( result.largestFreeBlock, usage.largestFreeBlock );
+		}
+
+		void computeFragmentation( MemoryUsageStatistics & usage )
+		{
+			usage.fragmentation = usage.freeBytes
+				? 1.0f - float( usage.largestFreeBlock ) / float( usage.freeBytes )
+				: 0.0f;
+		}
+	}
+
 	Device::Device( Renderer const & renderer
 		, PhysicalDevice const & gpu
 		, Connection const & connection )
 		: m_renderer{ renderer }
 		, m_gpu{ gpu }
 	{
+#ifndef NDEBUG
+
+		m_objectTracking = renderer.getObjectTracking();
+		m_objectStackSampling = renderer.getObjectStackSampling();
+
+#endif
 	}
 
 	Device::~Device()
@@ -44,6 +88,163 @@ namespace renderer
 		doDisable();
 	}
 
+	void Device::setCallTracing( bool enable )const
+	{
+	}
+
+	void Device::flushCallTrace( std::string const & fileName )const
+	{
+	}
+
+	void Device::setObjectStacksCapture( std::string const & type
+		, bool enable )const
+	{
+#ifndef NDEBUG
+
+		std::lock_guard< std::mutex > lock{ m_allocatedMutex };
+
+		if ( enable )
+		{
+			m_capturedTypes.insert( type );
+		}
+		else
+		{
+			m_capturedTypes.erase( type );
+		}
+
+		auto it = m_objectTypes.find( type.c_str() );
+
+		if ( it != m_objectTypes.end() )
+		{
+			it->second.captureStacks = enable;
+		}
+
+#endif
+	}
+
+	void Device::reportObjectCounters()const
+	{
+#ifndef NDEBUG
+
+		std::lock_guard< std::mutex > lock{ m_allocatedMutex };
+
+		for ( auto & type : m_objectTypes )
+		{
+			std::stringstream stream;
+			stream << "[" << type.first << "]: " << type.second.alive << " alive, " << type.second.created << " created";
+			Logger::logInfo( stream );
+		}
+
+#endif
+	}
+
+	MemoryStatistics Device::getMemoryStatistics()const
+	{
+		auto & properties = getMemoryProperties();
+		MemoryStatistics result;
+		result.types.resize( properties.memoryTypes.size() );
+		result.heaps.resize( properties.memoryHeaps.size() );
+
+		{
+			std::lock_guard< std::mutex > lock{ m_memoryMutex };
+
+			for ( size_t index = 0u; index < std::min( m_memoryTypes.size(), result.types.size() ); ++index )
+			{
+				result.types[index] = m_memoryTypes[index];
+			}
+
+			result.bufferTargets = m_bufferTargetsMemory;
+			result.imageUsages = m_imageUsagesMemory;
+		}
+
+		doFillMemoryStatistics( result );
+
+		for ( size_t index = 0u; index < result.types.size(); ++index )
+		{
+			auto & type = result.types[index];
+			computeFragmentation( type );
+			accumulate( result.heaps[properties.memoryTypes[index].heapIndex], type );
+			accumulate( result.total, type );
+		}
+
+		for ( auto & heap : result.heaps )
+		{
+			computeFragmentation( heap );
+		}
+
+		computeFragmentation( result.total );
+		return result;
+	}
+
+	void Device::doFillMemoryStatistics( MemoryStatistics & statistics )const
+	{
+		for ( auto & type : statistics.types )
+		{
+			type.allocatedBytes = type.usedBytes;
+			type.blockCount = type.allocationCount;
+		}
+	}
+
+	void Device::doAddMemory( uint32_t memoryTypeIndex
+		, uint64_t size )const
+	{
+		std::lock_guard< std::mutex > lock{ m_memoryMutex };
+
+		if ( m_memoryTypes.size() <= memoryTypeIndex )
+		{
+			m_memoryTypes.resize( memoryTypeIndex + 1u );
+		}
+
+		auto & type = m_memoryTypes[memoryTypeIndex];
+		type.usedBytes += size;
+		++type.allocationCount;
+	}
+
+	void Device::doRemoveMemory( uint32_t memoryTypeIndex
+		, uint64_t size )const
+	{
+		std::lock_guard< std::mutex > lock{ m_memoryMutex };
+		assert( memoryTypeIndex < m_memoryTypes.size() );
+		auto & type = m_memoryTypes[memoryTypeIndex];
+		assert( type.usedBytes >= size && type.allocationCount );
+		type.usedBytes -= size;
+		--type.allocationCount;
+	}
+
+	void Device::doAddResourceMemory( BufferTargets targets
+		, ImageUsageFlags usage
+		, uint64_t size )const
+	{
+		std::lock_guard< std::mutex > lock{ m_memoryMutex };
+		forEachFlag( targets
+			, [this, size]( BufferTarget target )
+			{
+				m_bufferTargetsMemory[target] += size;
+			} );
+		forEachFlag( usage
+			, [this, size]( ImageUsageFlag flag )
+			{
+				m_imageUsagesMemory[flag] += size;
+			} );
+	}
+
+	void Device::doRemoveResourceMemory( BufferTargets targets
+		, ImageUsageFlags usage
+		, uint64_t size )const
+	{
+		std::lock_guard< std::mutex > lock{ m_memoryMutex };
+		forEachFlag( targets
+			, [this, size]( BufferTarget target )
+			{
+				m_bufferTargetsMemory[target] -= size;
+			} );
+		forEachFlag( usage
+			, [this, size]( ImageUsageFlag flag )
+			{
+				m_imageUsagesMemory[flag] -= size;
+			} );
+	}
+
 	std::array< float, 16u > Device::frustum( float left
 		, float right
 		, float bottom
@@ -230,32 +431,74 @@ namespace renderer
 #ifndef NDEBUG
 	void Device::doRegisterObject( char const * const type, void * object )const
 	{
-		auto hash = std::hash< void const * >{}( object );
-		std::stringstream stream;
-		stream << Debug::Backtrace{ 20, 4 };
-		m_allocated.emplace( hash
-			, ObjectAllocation{
-				std::string{ type },
-				stream.str()
-			} );
+		ObjectType * objectType{ nullptr };
+		bool capture{ false };
+
+		{
+			std::lock_guard< std::mutex > lock{ m_allocatedMutex };
+			auto it = m_objectTypes.find( type );
+
+			if ( it == m_objectTypes.end() )
+			{
+				it = m_objectTypes.emplace( type, ObjectType{} ).first;
+				it->second.name = type;
+				it->second.captureStacks = m_capturedTypes.find( type ) != m_capturedTypes.end();
+			}
+
+			objectType = &it->second;
+			++objectType->created;
+			++objectType->alive;
+			capture = objectType->captureStacks
+				|| m_objectTracking == ObjectTracking::eAllStacks
+				|| ( m_objectTracking == ObjectTracking::eSampledStacks
+					&& m_objectStackSampling
+					&& ( objectType->created % m_objectStackSampling ) == 1u % m_objectStackSampling );
+
+			if ( !capture )
+			{
+				m_allocated.emplace( object, ObjectAllocation{ objectType, {} } );
+				return;
+			}
+		}
+
+		// Only the frames addresses are captured, and outside of the lock, the symbols are resolved when reporting.
+		auto callstack = Debug::captureBacktrace( 20, 4 );
+		std::lock_guard< std::mutex > lock{ m_allocatedMutex };
+		m_allocated.emplace( object, ObjectAllocation{ objectType, std::move( callstack ) } );
 	}
 
 	void Device::doUnregisterObject( void * object )const
 	{
-		auto hash = std::hash< void * >{}( object );
-		auto it = m_allocated.find( hash );
+		std::lock_guard< std::mutex > lock{ m_allocatedMutex };
+		auto it = m_allocated.find( object );
 		assert( it != m_allocated.end() );
+		--it->second.type->alive;
 		m_allocated.erase( it );
 	}
 
 	void Device::doReportRegisteredObjects()const
 	{
+		std::lock_guard< std::mutex > lock{ m_allocatedMutex };
+
+		for ( auto & type : m_objectTypes )
+		{
+			if ( type.second.alive )
+			{
+				std::stringstream stream;
+				stream << "Leaked " << type.second.alive << " [" << type.first << "], out of " << type.second.created << " created";
+				Logger::logError( stream );
+			}
+		}
+
 		for ( auto & alloc : m_allocated )
 		{
-			std::stringstream stream;
-			stream << "Leaked [" << alloc.second.type << "], allocation stack:\n";
-			stream << alloc.second.callstack;
-			Logger::logError( stream );
+			if ( !alloc.second.callstack.frames.empty() )
+			{
+				std::stringstream stream;
+				stream << "Leaked [" << alloc.second.type->name << "], allocation stack:\n";
+				stream << alloc.second.callstack;
+				Logger::logError( stream );
+			}
 		}
 	}
 
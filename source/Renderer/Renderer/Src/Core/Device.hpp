@@ -12,9 +12,15 @@ See LICENSE file in root folder.
 #include "Core/PhysicalDevice.hpp"
 #include "Image/ImageCreateInfo.hpp"
 #include "Image/SamplerCreateInfo.hpp"
+#include "Miscellaneous/MemoryStatistics.hpp"
 #include "Pipeline/ColourBlendState.hpp"
 #include "Pipeline/RasterisationState.hpp"
+#include "Utils/CallStack.hpp"
 
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <set>
 #include <string>
 #include <sstream>
 #include <unordered_map>
@@ -27,11 +33,17 @@ namespace renderer
 	*	The class containing the informations related to the logical device.
 	*\remarks
 	*	It creates most of the rendering API objects.
+	*	The creation functions may be called from any thread.
+	*	Queue submissions must be done from the thread owning the device
+	*	(the context thread, for OpenGL backends).
 	*\~french
 	*\brief
 	*	Classe contenant les informations liées au GPU logique.
 	*\remarks
 	*	Elle crée la plupart des objets de rendu.
+	*	Les fonctions de création peuvent être appelées depuis n'importe quel thread.
+	*	Les soumissions aux files doivent être faites depuis le thread possédant le périphérique
+	*	(le thread du contexte, pour les renderers OpenGL).
 	*/
 	class Device
 	{
@@ -792,6 +804,82 @@ namespace renderer
 		virtual void waitIdle()const = 0;
 		/**
 		*\~english
+		*\brief
+		*	Starts or stops the tracing of the rendering API calls.
+		*\remarks
+		*	Only the OpenGL renderers trace their calls, the default implementation does nothing.
+		*\param[in] enable
+		*	\p true to start tracing, previously traced calls being discarded.
+		*\~french
+		*\brief
+		*	Démarre ou arrête la trace des appels à l'API de rendu.
+		*\remarks
+		*	Seuls les renderers OpenGL tracent leurs appels, l'implémentation par défaut ne fait rien.
+		*\param[in] enable
+		*	\p true pour démarrer la trace, les appels tracés précédemment étant supprimés.
+		*/
+		virtual void setCallTracing( bool enable )const;
+		/**
+		*\~english
+		*\brief
+		*	Writes the traced calls in a Chrome trace file (JSON, readable by Perfetto), and logs their statistics.
+		*\param[in] fileName
+		*	The trace file path.
+		*\~french
+		*\brief
+		*	Ecrit les appels tracés dans un fichier Chrome trace (JSON, lisible par Perfetto), et journalise leurs statistiques.
+		*\param[in] fileName
+		*	Le chemin du fichier de trace.
+		*/
+		virtual void flushCallTrace( std::string const & fileName )const;
+		/**
+		*\~english
+		*\brief
+		*	Retrieves the device memory usage.
+		*\remarks
+		*	The used bytes are gathered from the DeviceMemory objects, the allocated bytes and free ranges
+		*	from the renderer's allocators, when it suballocates its memory.
+		*\~french
+		*\brief
+		*	Récupère l'utilisation de la mémoire du périphérique.
+		*\remarks
+		*	Les octets utilisés sont récupérés depuis les objets DeviceMemory, les octets alloués et les intervalles libres
+		*	depuis les allocateurs du renderer, quand celui-ci sous-alloue sa mémoire.
+		*/
+		MemoryStatistics getMemoryStatistics()const;
+		/**
+		*\~english
+		*\brief
+		*	Enables or disables the allocation call stack capture for every object of the given type.
+		*\remarks
+		*	Only available in debug builds, whatever the configured ObjectTracking.
+		*\param[in] type
+		*	The objects type name (as given to registerObject, "Buffer", "Texture", ...).
+		*\param[in] enable
+		*	\p true to capture the call stacks of the objects created from now on.
+		*\~french
+		*\brief
+		*	Active ou désactive la capture de la pile d'appels d'allocation pour chaque objet du type donné.
+		*\remarks
+		*	Disponible uniquement en debug, quel que soit l'ObjectTracking configuré.
+		*\param[in] type
+		*	Le nom du type des objets (tel que donné à registerObject, "Buffer", "Texture", ...).
+		*\param[in] enable
+		*	\p true pour capturer les piles d'appels des objets créés dorénavant.
+		*/
+		void setObjectStacksCapture( std::string const & type
+			, bool enable )const;
+		/**
+		*\~english
+		*\brief
+		*	Logs the created and alive objects counts, per type (debug builds only).
+		*\~french
+		*\brief
+		*	Journalise le nombre d'objets créés et vivants, par type (en debug seulement).
+		*/
+		void reportObjectCounters()const;
+		/**
+		*\~english
 		*name
 		*	Getters.
 		*\~french
@@ -839,6 +927,11 @@ namespace renderer
 			return *m_graphicsQueue;
 		}
 
+		inline Queue const & getTransferQueue()const
+		{
+			return *m_transferQueue;
+		}
+
 		inline CommandPool const & getPresentCommandPool()const
 		{
 			return *m_presentCommandPool;
@@ -854,6 +947,11 @@ namespace renderer
 			return *m_graphicsCommandPool;
 		}
 
+		inline CommandPool const & getTransferCommandPool()const
+		{
+			return *m_transferCommandPool;
+		}
+
 		inline Renderer const & getRenderer()const
 		{
 			return m_renderer;
@@ -890,6 +988,47 @@ namespace renderer
 		*/
 		virtual void doDisable()const = 0;
 
+	protected:
+		/**
+		*\~french
+		*\brief
+		*	Remplit les octets alloués, le nombre de blocs et les intervalles libres, par type de mémoire.
+		*\remarks
+		*	L'implémentation par défaut considère que chaque objet DeviceMemory est une allocation de l'API.
+		*\param[in,out] statistics
+		*	Les statistiques, dont les octets utilisés et le nombre d'allocations sont déjà remplis.
+		*\~english
+		*\brief
+		*	Fills the allocated bytes, the blocks count and the free ranges, per memory type.
+		*\remarks
+		*	The default implementation considers each DeviceMemory object as an API allocation.
+		*\param[in,out] statistics
+		*	The statistics, with the used bytes and the allocations count already filled.
+		*/
+		virtual void doFillMemoryStatistics( MemoryStatistics & statistics )const;
+
+	private:
+		friend class BufferBase;
+		friend class DeviceMemory;
+		friend class Texture;
+
+		void doAddMemory( uint32_t memoryTypeIndex
+			, uint64_t size )const;
+		void doRemoveMemory( uint32_t memoryTypeIndex
+			, uint64_t size )const;
+		void doAddResourceMemory( BufferTargets targets
+			, ImageUsageFlags usage
+			, uint64_t size )const;
+		void doRemoveResourceMemory( BufferTargets targets
+			, ImageUsageFlags usage
+			, uint64_t size )const;
+
+	private:
+		mutable std::mutex m_memoryMutex;
+		mutable std::vector< MemoryUsageStatistics > m_memoryTypes;
+		mutable std::map< BufferTarget, uint64_t > m_bufferTargetsMemory;
+		mutable std::map< ImageUsageFlag, uint64_t > m_imageUsagesMemory;
+
 	public:
 		DeviceEnabledSignal onEnabled;
 		DeviceDisabledSignal onDisabled;
@@ -900,20 +1039,46 @@ namespace renderer
 		QueuePtr m_presentQueue;
 		QueuePtr m_computeQueue;
 		QueuePtr m_graphicsQueue;
+		QueuePtr m_transferQueue;
 		CommandPoolPtr m_presentCommandPool;
 		CommandPoolPtr m_computeCommandPool;
 		CommandPoolPtr m_graphicsCommandPool;
+		CommandPoolPtr m_transferCommandPool;
 		float m_timestampPeriod;
 		uint32_t m_shaderVersion;
 
 #ifndef NDEBUG
+		struct ObjectType
+		{
+			char const * name{ nullptr };
+			uint32_t created{ 0u };
+			uint32_t alive{ 0u };
+			bool captureStacks{ false };
+		};
+
+		struct ObjectTypeLess
+		{
+			inline bool operator()( char const * lhs, char const * rhs )const
+			{
+				return std::strcmp( lhs, rhs ) < 0;
+			}
+		};
+
 		struct ObjectAllocation
 		{
-			std::string type;
-			std::string callstack;
+			ObjectType * type;
+			// Empty when the object's call stack was not captured.
+			Debug::CapturedBacktrace callstack;
 		};
 
-		mutable std::unordered_map< size_t, ObjectAllocation > m_allocated;
+		ObjectTracking m_objectTracking;
+		uint32_t m_objectStackSampling;
+		mutable std::mutex m_allocatedMutex;
+		// The type names given to registerObject are literals, stored without a copy, but compared as strings,
+		// so that a same name coming from different modules gives one type.
+		mutable std::map< char const *, ObjectType, ObjectTypeLess > m_objectTypes;
+		mutable std::set< std::string > m_capturedTypes;
+		mutable std::unordered_map< void const *, ObjectAllocation > m_allocated;
 
 	public:
 		static inline void stRegisterObject( Device const & device, char const * const type, void * object )
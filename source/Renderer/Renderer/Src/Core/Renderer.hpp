@@ -37,6 +37,18 @@ namespace renderer
 			//!\~french		Dit si la couche de validation doit être activée.
 			//!\~english	Tells if the validation layer must be enabled.
 			bool enableValidation;
+			//!\~french		Dit si les soumissions aux files doivent être asynchrones (OpenGL seulement, le contexte vit alors sur un thread dédié).
+			//!\~english	Tells if the queue submissions must be asynchronous (OpenGL only, the context then lives on a dedicated thread).
+			bool asynchronousSubmission{ false };
+			//!\~french		Dit si les petits tampons doivent être découpés dans quelques grands tampons partagés (OpenGL seulement).
+			//!\~english	Tells if the small buffers must be carved out of a few big shared buffers (OpenGL only).
+			bool bufferSuballocation{ false };
+			//!\~french		La manière dont les objets créés sont suivis, pour rapporter les fuites (en debug seulement).
+			//!\~english	The way the created objects are tracked, to report the leaks (debug builds only).
+			ObjectTracking objectTracking{ ObjectTracking::eAllStacks };
+			//!\~french		Pour ObjectTracking::eSampledStacks, la pile d'appels d'un objet sur objectStackSampling est capturée, par type.
+			//!\~english	For ObjectTracking::eSampledStacks, the call stack of one object out of objectStackSampling is captured, per type.
+			uint32_t objectStackSampling{ 64u };
 		};
 
 	protected:
@@ -236,6 +248,26 @@ namespace renderer
 			return m_configuration.enableValidation;
 		}
 
+		inline bool isAsynchronousSubmissionEnabled()const
+		{
+			return m_configuration.asynchronousSubmission;
+		}
+
+		inline bool isBufferSuballocationEnabled()const
+		{
+			return m_configuration.bufferSuballocation;
+		}
+
+		inline ObjectTracking getObjectTracking()const
+		{
+			return m_configuration.objectTracking;
+		}
+
+		inline uint32_t getObjectStackSampling()const
+		{
+			return m_configuration.objectStackSampling;
+		}
+
 		inline ClipDirection getClipDirection()const
 		{
 			return m_clipDirection;
@@ -9,8 +9,10 @@ See LICENSE file in root folder.
 
 namespace renderer
 {
-	RenderingResources::RenderingResources( Device const & device )
+	RenderingResources::RenderingResources( Device const & device
+		, uint32_t index )
 		: m_device{ device }
+		, m_index{ index }
 		, m_commandBuffer{ m_device.getGraphicsCommandPool().createCommandBuffer() }
 		, m_imageAvailableSemaphore{ m_device.createSemaphore() }
 		, m_finishedRenderingSemaphore{ m_device.createSemaphore() }
@@ -29,13 +29,18 @@ namespace renderer
 		*	Constructor.
 		*\param[in] device
 		*	The parent Device.
+		*\param[in] index
+		*	The resources index in the swap chain.
 		*\~french
 		*\brief
 		*	Constructeur.
 		*\param[in] device
 		*	Le Device parent.
+		*\param[in] index
+		*	L'indice des ressources dans la swap chain.
 		*/
-		RenderingResources( Device const & device );
+		RenderingResources( Device const & device
+			, uint32_t index );
 		/**
 		*\~english
 		*\brief
@@ -150,9 +155,22 @@ namespace renderer
 		{
 			return m_device;
 		}
+		/**
+		*\~english
+		*\return
+		*	The resources index in the swap chain, stable through its resets.
+		*\~french
+		*\return
+		*	L'indice des ressources dans la swap chain, stable à travers ses réinitialisations.
+		*/
+		inline uint32_t getIndex()const
+		{
+			return m_index;
+		}
 
 	protected:
 		Device const & m_device;
+		uint32_t m_index;
 		SemaphorePtr m_imageAvailableSemaphore;
 		SemaphorePtr m_finishedRenderingSemaphore;
 		FencePtr m_fence;
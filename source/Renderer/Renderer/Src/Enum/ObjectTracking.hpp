@@ -0,0 +1,71 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#ifndef ___Renderer_ObjectTracking_HPP___
+#define ___Renderer_ObjectTracking_HPP___
+#pragma once
+
+#include "RendererPrerequisites.hpp"
+
+namespace renderer
+{
+	/**
+	*\~english
+	*\brief
+	*	The way the device tracks the objects it creates, in debug builds, to report the leaked ones.
+	*\~french
+	*\brief
+	*	La manière dont le périphérique suit les objets qu'il crée, en debug, pour rapporter ceux qui ont fui.
+	*/
+	enum class ObjectTracking
+	{
+		//!\~english	Only the created and alive objects counts, per type.
+		//!\~french		Uniquement le nombre d'objets créés et vivants, par type.
+		eCounters,
+		//!\~english	The counters, and the allocation call stack of one object out of N, per type.
+		//!\~french		Les compteurs, et la pile d'appels d'allocation d'un objet sur N, par type.
+		eSampledStacks,
+		//!\~english	The counters, and the allocation call stack of every object.
+		//!\~french		Les compteurs, et la pile d'appels d'allocation de chaque objet.
+		eAllStacks,
+	};
+	/**
+	*\~english
+	*\brief
+	*	Gets the name of the given object tracking mode.
+	*\param[in] value
+	*	The object tracking mode.
+	*\return
+	*	The name.
+	*\~french
+	*\brief
+	*	Récupère le nom du mode de suivi d'objets donné.
+	*\param[in] value
+	*	Le mode de suivi d'objets.
+	*\return
+	*	Le nom.
+	*/
+	inline std::string getName( ObjectTracking value )
+	{
+		switch ( value )
+		{
+		case ObjectTracking::eCounters:
+			return "counters";
+
+		case ObjectTracking::eSampledStacks:
+			return "sampled_stacks";
+
+		case ObjectTracking::eAllStacks:
+			return "all_stacks";
+
+		default:
+			assert( false && "Unsupported ObjectTracking." );
+			throw std::runtime_error{ "Unsupported ObjectTracking" };
+		}
+
+		return 0;
+	}
+}
+
+#endif
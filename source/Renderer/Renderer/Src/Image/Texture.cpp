@@ -21,12 +21,18 @@ namespace renderer
 		, m_dimensions{ rhs.m_dimensions }
 		, m_mipLevels{ rhs.m_mipLevels }
 		, m_arrayLayers{ rhs.m_arrayLayers }
+		, m_usage{ rhs.m_usage }
 	{
 		registerObject( m_device, "Texture", this );
 	}
 
 	Texture::~Texture()
 	{
+		if ( m_storage )
+		{
+			m_device.doRemoveResourceMemory( 0u, m_usage, m_storage->getSize() );
+		}
+
 		unregisterObject( m_device, this );
 	}
 
@@ -40,6 +46,7 @@ namespace renderer
 			m_dimensions = rhs.m_dimensions;
 			m_mipLevels = rhs.m_mipLevels;
 			m_arrayLayers = rhs.m_arrayLayers;
+			m_usage = rhs.m_usage;
 			registerObject( m_device, "Texture", this );
 		}
 
@@ -52,7 +59,8 @@ namespace renderer
 		, Format format
 		, Extent3D dimensions
 		, uint32_t mipLevels
-		, uint32_t arrayLayers )
+		, uint32_t arrayLayers
+		, ImageUsageFlags usage )
 		: m_device{ device }
 		, m_flags{ flags }
 		, m_imageType{ type }
@@ -60,14 +68,18 @@ namespace renderer
 		, m_dimensions{ dimensions }
 		, m_mipLevels{ mipLevels }
 		, m_arrayLayers{ arrayLayers }
+		, m_usage{ usage }
 	{
 		registerObject( m_device, "Texture", this );
 	}
 
-	void Texture::bindMemory( DeviceMemoryPtr memory )
+	void Texture::bindMemory( DeviceMemoryPtr memory
+		, uint64_t memoryOffset )
 	{
 		assert( !m_storage && "A resource can only be bound once to a device memory object." );
 		m_storage = std::move( memory );
+		m_storageOffset = memoryOffset;
+		m_device.doAddResourceMemory( 0u, m_usage, m_storage->getSize() );
 		doBindMemory();
 	}
 
@@ -60,6 +60,8 @@ namespace renderer
 		*	Le nombre de niveaux de mipmaps.
 		*\param[in] arrayLayers
 		*	Le nombre de couches du tableau.
+		*\param[in] usage
+		*	Les utilisations de la texture.
 		*\~english
 		*\brief
 		*	Constructor.
@@ -75,6 +77,8 @@ namespace renderer
 		*	The mipmap levelx count.
 		*\param[in] arrayLayers
 		*	The array layers count.
+		*\param[in] usage
+		*	The texture's usages.
 		*/
 		Texture( Device const & device
 			, ImageCreateFlags flags
@@ -82,7 +86,8 @@ namespace renderer
 			, Format format
 			, Extent3D dimensions
 			, uint32_t mipLevels
-			, uint32_t arrayLayers );
+			, uint32_t arrayLayers
+			, ImageUsageFlags usage );
 
 	public:
 		Texture & operator=( Texture const & ) = delete;
@@ -100,15 +105,24 @@ namespace renderer
 		*\~english
 		*\brief
 		*	Binds this buffer to given device memory object.
+		*\remarks
+		*	When the renderer supports memory aliasing, several textures may be bound to the same memory object.
 		*\param[in] memory
 		*	The memory object.
+		*\param[in] memoryOffset
+		*	The texture offset in the memory object.
 		*\~french
 		*\brief
 		*	Lie ce tampon à l'objet mémoire donné.
+		*\remarks
+		*	Quand le renderer supporte l'aliasing mémoire, plusieurs textures peuvent être liées au même objet mémoire.
 		*\param[in] memory
 		*	L'object mémoire de périphérique.
+		*\param[in] memoryOffset
+		*	Le décalage de la texture dans l'objet mémoire.
 		*/
-		void bindMemory( DeviceMemoryPtr memory );
+		void bindMemory( DeviceMemoryPtr memory
+			, uint64_t memoryOffset = 0u );
 		/**
 		*\~french
 		*\brief
@@ -340,6 +354,18 @@ namespace renderer
 		{
 			return m_imageType;
 		}
+		/**
+		*\~french
+		*\return
+		*	Les utilisations de la texture.
+		*\~english
+		*\return
+		*	The texture usages.
+		*/
+		inline ImageUsageFlags getUsage()const
+		{
+			return m_usage;
+		}
 
 	private:
 		virtual void doBindMemory() = 0;
@@ -352,7 +378,9 @@ namespace renderer
 		Extent3D m_dimensions;
 		uint32_t m_mipLevels;
 		uint32_t m_arrayLayers;
+		ImageUsageFlags m_usage;
 		DeviceMemoryPtr m_storage;
+		uint64_t m_storageOffset{ 0u };
 	};
 }
 
@@ -0,0 +1,284 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Image/TransientTextureAllocator.hpp"
+
+#include "Core/Device.hpp"
+#include "Core/Renderer.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace renderer
+{
+	namespace
+	{
+		uint64_t getAlignedOffset( uint64_t offset, uint64_t alignment )
+		{
+			alignment = std::max( alignment, uint64_t( 1u ) );
+			return ( ( offset + alignment - 1u ) / alignment ) * alignment;
+		}
+
+		bool overlap( uint32_t lhsBegin, uint32_t lhsEnd
+			, uint32_t rhsBegin, uint32_t rhsEnd )
+		{
+			return lhsBegin <= rhsEnd
+				&& rhsBegin <= lhsEnd;
+		}
+
+		AccessFlags getWriteAccessFlags( ImageUsageFlags usage )
+		{
+			AccessFlags result{ 0u };
+
+			if ( checkFlag( usage, ImageUsageFlag::eColourAttachment ) )
+			{
+				result |= AccessFlag::eColourAttachmentWrite;
+			}
+
+			if ( checkFlag( usage, ImageUsageFlag::eDepthStencilAttachment ) )
+			{
+				result |= AccessFlag::eDepthStencilAttachmentWrite;
+			}
+
+			if ( checkFlag( usage, ImageUsageFlag::eStorage ) )
+			{
+				result |= AccessFlag::eShaderWrite;
+			}
+
+			if ( checkFlag( usage, ImageUsageFlag::eTransferDst ) )
+			{
+				result |= AccessFlag::eTransferWrite;
+			}
+
+			return result;
+		}
+
+		PipelineStageFlags getWriteStageFlags( ImageUsageFlags usage )
+		{
+			PipelineStageFlags result{ 0u };
+
+			if ( checkFlag( usage, ImageUsageFlag::eColourAttachment ) )
+			{
+				result |= PipelineStageFlag::eColourAttachmentOutput;
+			}
+
+			if ( checkFlag( usage, ImageUsageFlag::eDepthStencilAttachment ) )
+			{
+				result |= PipelineStageFlag::eEarlyFragmentTests | PipelineStageFlag::eLateFragmentTests;
+			}
+
+			if ( checkFlag( usage, ImageUsageFlag::eStorage ) )
+			{
+				result |= PipelineStageFlag::eFragmentShader | PipelineStageFlag::eComputeShader;
+			}
+
+			if ( checkFlag( usage, ImageUsageFlag::eTransferDst ) )
+			{
+				result |= PipelineStageFlag::eTransfer;
+			}
+
+			return result;
+		}
+	}
+
+	TransientTextureAllocator::TransientTextureAllocator( Device const & device )
+		: m_device{ device }
+	{
+	}
+
+	uint32_t TransientTextureAllocator::declare( ImageCreateInfo const & createInfo
+		, uint32_t firstUse
+		, uint32_t lastUse )
+	{
+		assert( m_memories.empty() && "TransientTextureAllocator::declare called after allocate" );
+		assert( firstUse <= lastUse );
+		auto texture = m_device.createTexture( createInfo );
+		auto requirements = texture->getMemoryRequirements();
+		m_resources.push_back( { std::move( texture ), requirements, firstUse, lastUse, 0u, {} } );
+		m_requiredSize += requirements.size;
+		return uint32_t( m_resources.size() - 1u );
+	}
+
+	void TransientTextureAllocator::allocate( MemoryPropertyFlags flags )
+	{
+		assert( m_memories.empty() && "TransientTextureAllocator::allocate called twice" );
+
+		if ( !m_device.getRenderer().getFeatures().hasMemoryAliasing )
+		{
+			for ( auto & resource : m_resources )
+			{
+				m_memories.push_back( m_device.allocateMemory( resource.requirements, flags ) );
+				resource.texture->bindMemory( m_memories.back() );
+				m_allocatedSize += resource.requirements.size;
+			}
+
+			return;
+		}
+
+		// The biggest textures are placed first, the smaller ones then fill the holes.
+		std::vector< uint32_t > order( m_resources.size() );
+		std::iota( order.begin(), order.end(), 0u );
+		std::stable_sort( order.begin()
+			, order.end()
+			, [this]( uint32_t lhs, uint32_t rhs )
+			{
+				return m_resources[lhs].requirements.size > m_resources[rhs].requirements.size;
+			} );
+		std::vector< Block > blocks;
+
+		for ( auto index : order )
+		{
+			auto & resource = m_resources[index];
+			Block * selected{ nullptr };
+			uint64_t selectedGrowth{ ~uint64_t( 0u ) };
+
+			// The resource goes in the compatible block that grows the least.
+			for ( auto & block : blocks )
+			{
+				if ( block.memoryTypeBits & resource.requirements.memoryTypeBits )
+				{
+					auto offset = doFindOffset( block, resource );
+					auto end = offset + resource.requirements.size;
+					auto growth = end > block.size
+						? end - block.size
+						: 0u;
+
+					if ( growth < selectedGrowth )
+					{
+						selected = &block;
+						selectedGrowth = growth;
+						resource.offset = offset;
+					}
+				}
+			}
+
+			if ( !selected )
+			{
+				blocks.push_back( { resource.requirements.memoryTypeBits, 0u, 1u, {} } );
+				selected = &blocks.back();
+				resource.offset = 0u;
+			}
+
+			selected->memoryTypeBits &= resource.requirements.memoryTypeBits;
+			selected->size = std::max( selected->size, resource.offset + resource.requirements.size );
+			selected->alignment = std::max( selected->alignment, resource.requirements.alignment );
+			selected->resources.push_back( index );
+		}
+
+		for ( auto & block : blocks )
+		{
+			MemoryRequirements requirements{};
+			requirements.type = ResourceType::eImage;
+			requirements.size = block.size;
+			requirements.alignment = block.alignment;
+			requirements.memoryTypeBits = block.memoryTypeBits;
+			m_memories.push_back( m_device.allocateMemory( requirements, flags ) );
+			m_allocatedSize += block.size;
+
+			for ( auto index : block.resources )
+			{
+				auto & resource = m_resources[index];
+				resource.texture->bindMemory( m_memories.back(), resource.offset );
+
+				for ( auto other : block.resources )
+				{
+					auto & lookup = m_resources[other];
+
+					if ( other != index
+						&& resource.offset < lookup.offset + lookup.requirements.size
+						&& lookup.offset < resource.offset + resource.requirements.size )
+					{
+						resource.aliases.push_back( other );
+					}
+				}
+			}
+		}
+	}
+
+	ImageMemoryBarrier TransientTextureAllocator::makeAliasingBarrier( uint32_t index
+		, ImageLayout dstLayout
+		, AccessFlags dstAccessFlags )const
+	{
+		assert( index < m_resources.size() );
+		auto & resource = m_resources[index];
+		auto & texture = *resource.texture;
+		AccessFlags srcAccessFlags{ 0u };
+
+		for ( auto alias : resource.aliases )
+		{
+			srcAccessFlags |= getWriteAccessFlags( m_resources[alias].texture->getUsage() );
+		}
+
+		return ImageMemoryBarrier
+		{
+			srcAccessFlags,
+			dstAccessFlags,
+			ImageLayout::eUndefined,
+			dstLayout,
+			~( 0u ),
+			~( 0u ),
+			texture,
+			{
+				getAspectMask( texture.getFormat() ),
+				0u,
+				texture.getMipmapLevels(),
+				0u,
+				texture.getLayerCount()
+			}
+		};
+	}
+
+	PipelineStageFlags TransientTextureAllocator::getAliasingSrcStages( uint32_t index )const
+	{
+		assert( index < m_resources.size() );
+		PipelineStageFlags result{ 0u };
+
+		for ( auto alias : m_resources[index].aliases )
+		{
+			result |= getWriteStageFlags( m_resources[alias].texture->getUsage() );
+		}
+
+		return result
+			? result
+			: PipelineStageFlags{ PipelineStageFlag::eTopOfPipe };
+	}
+
+	bool TransientTextureAllocator::isAliased( uint32_t index )const
+	{
+		assert( index < m_resources.size() );
+		return !m_resources[index].aliases.empty();
+	}
+
+	uint64_t TransientTextureAllocator::doFindOffset( Block const & block
+		, Resource const & resource )const
+	{
+		// The memory ranges of the block's resources which are alive at the same time as the given one.
+		std::vector< std::pair< uint64_t, uint64_t > > ranges;
+
+		for ( auto index : block.resources )
+		{
+			auto & lookup = m_resources[index];
+
+			if ( overlap( lookup.firstUse, lookup.lastUse, resource.firstUse, resource.lastUse ) )
+			{
+				ranges.emplace_back( lookup.offset, lookup.offset + lookup.requirements.size );
+			}
+		}
+
+		std::sort( ranges.begin(), ranges.end() );
+		auto result = uint64_t( 0u );
+
+		for ( auto & range : ranges )
+		{
+			if ( result + resource.requirements.size <= range.first )
+			{
+				break;
+			}
+
+			result = std::max( result, getAlignedOffset( range.second, resource.requirements.alignment ) );
+		}
+
+		return result;
+	}
+}
@@ -0,0 +1,204 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#ifndef ___Renderer_TransientTextureAllocator_HPP___
+#define ___Renderer_TransientTextureAllocator_HPP___
+#pragma once
+
+#include "Image/ImageCreateInfo.hpp"
+#include "Image/Texture.hpp"
+#include "Miscellaneous/MemoryRequirements.hpp"
+#include "Sync/ImageMemoryBarrier.hpp"
+
+namespace renderer
+{
+	/**
+	*\~english
+	*\brief
+	*	Allocates the memory of the textures only living within a frame (render targets of intermediate passes).
+	*\remarks
+	*	Each texture is declared with its first and last use, as pass indices within the frame.
+	*	Textures with disjoint lifetimes share the same memory object, at the same offsets.
+	*	At its first use in a frame, an aliased texture's content is undefined:
+	*	it must be transitioned from ImageLayout::eUndefined, with the barrier given by makeAliasingBarrier.
+	*	When the renderer doesn't support memory aliasing, each texture gets its own memory.
+	*\~french
+	*\brief
+	*	Alloue la mémoire des textures ne vivant qu'au sein d'une image (cibles de rendu des passes intermédiaires).
+	*\remarks
+	*	Chaque texture est déclarée avec sa première et sa dernière utilisation, en indices de passes au sein de l'image.
+	*	Les textures ayant des durées de vie disjointes partagent le même objet mémoire, aux mêmes décalages.
+	*	A sa première utilisation dans une image, le contenu d'une texture aliasée est indéfini :
+	*	elle doit être transitionnée depuis ImageLayout::eUndefined, avec la barrière donnée par makeAliasingBarrier.
+	*	Quand le renderer ne supporte pas l'aliasing mémoire, chaque texture a sa propre mémoire.
+	*/
+	class TransientTextureAllocator
+	{
+	public:
+		/**
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*/
+		explicit TransientTextureAllocator( Device const & device );
+		/**
+		*\~english
+		*\brief
+		*	Declares a texture, before the call to allocate.
+		*\param[in] createInfo
+		*	The texture creation informations.
+		*\param[in] firstUse, lastUse
+		*	The indices of the first and last passes using the texture, in the frame.
+		*\return
+		*	The texture index.
+		*\~french
+		*\brief
+		*	Déclare une texture, avant l'appel à allocate.
+		*\param[in] createInfo
+		*	Les informations de création de la texture.
+		*\param[in] firstUse, lastUse
+		*	Les indices de la première et de la dernière passe utilisant la texture, dans l'image.
+		*\return
+		*	L'indice de la texture.
+		*/
+		uint32_t declare( ImageCreateInfo const & createInfo
+			, uint32_t firstUse
+			, uint32_t lastUse );
+		/**
+		*\~english
+		*\brief
+		*	Places the declared textures in as few memory as possible, allocates it and binds the textures.
+		*\param[in] flags
+		*	The memory properties.
+		*\~french
+		*\brief
+		*	Place les textures déclarées dans le moins de mémoire possible, l'alloue et y lie les textures.
+		*\param[in] flags
+		*	Les propriétés de la mémoire.
+		*/
+		void allocate( MemoryPropertyFlags flags = MemoryPropertyFlag::eDeviceLocal );
+		/**
+		*\~english
+		*\brief
+		*	Creates the barrier to put before the first use of a texture, in each frame.
+		*\remarks
+		*	It makes the texture wait for the writes of the textures sharing its memory,
+		*	they must be made available before the stages given by getAliasingSrcStages.
+		*\param[in] index
+		*	The texture index.
+		*\param[in] dstLayout
+		*	The layout for the first use.
+		*\param[in] dstAccessFlags
+		*	The access flags for the first use.
+		*\~french
+		*\brief
+		*	Crée la barrière à placer avant la première utilisation d'une texture, à chaque image.
+		*\remarks
+		*	Elle fait attendre la texture après les écritures des textures partageant sa mémoire,
+		*	qui doivent être rendues disponibles avant les étapes données par getAliasingSrcStages.
+		*\param[in] index
+		*	L'indice de la texture.
+		*\param[in] dstLayout
+		*	Le layout pour la première utilisation.
+		*\param[in] dstAccessFlags
+		*	Les indicateurs d'accès pour la première utilisation.
+		*/
+		ImageMemoryBarrier makeAliasingBarrier( uint32_t index
+			, ImageLayout dstLayout
+			, AccessFlags dstAccessFlags )const;
+		/**
+		*\~english
+		*\return
+		*	The pipeline stages where the textures sharing the given one's memory write it.
+		*\~french
+		*\return
+		*	Les étapes du pipeline où les textures partageant la mémoire de celle donnée y écrivent.
+		*/
+		PipelineStageFlags getAliasingSrcStages( uint32_t index )const;
+		/**
+		*\~english
+		*\return
+		*	\p true if the given texture shares its memory with other textures.
+		*\~french
+		*\return
+		*	\p true si la texture donnée partage sa mémoire avec d'autres textures.
+		*/
+		bool isAliased( uint32_t index )const;
+		/**
+		*\~english
+		*\return
+		*	The texture at given index.
+		*\~french
+		*\return
+		*	La texture à l'indice donné.
+		*/
+		inline Texture const & getTexture( uint32_t index )const
+		{
+			assert( index < m_resources.size() );
+			return *m_resources[index].texture;
+		}
+		/**
+		*\~english
+		*\return
+		*	The total size of the allocated memory.
+		*\~french
+		*\return
+		*	La taille totale de la mémoire allouée.
+		*/
+		inline uint64_t getAllocatedSize()const
+		{
+			return m_allocatedSize;
+		}
+		/**
+		*\~english
+		*\return
+		*	The sum of the textures sizes, i.e. the memory needed without aliasing.
+		*\~french
+		*\return
+		*	La somme des tailles des textures, i.e. la mémoire nécessaire sans aliasing.
+		*/
+		inline uint64_t getRequiredSize()const
+		{
+			return m_requiredSize;
+		}
+
+	private:
+		struct Resource
+		{
+			TexturePtr texture;
+			MemoryRequirements requirements;
+			uint32_t firstUse;
+			uint32_t lastUse;
+			uint64_t offset;
+			std::vector< uint32_t > aliases;
+		};
+
+		struct Block
+		{
+			uint32_t memoryTypeBits;
+			uint64_t size;
+			uint64_t alignment;
+			std::vector< uint32_t > resources;
+		};
+
+		uint64_t doFindOffset( Block const & block
+			, Resource const & resource )const;
+
+	private:
+		Device const & m_device;
+		std::vector< Resource > m_resources;
+		std::vector< DeviceMemoryPtr > m_memories;
+		uint64_t m_allocatedSize{ 0u };
+		uint64_t m_requiredSize{ 0u };
+	};
+}
+
+#endif
@@ -9,6 +9,7 @@ See LICENSE file in root folder.
 #include "RendererPrerequisites.hpp"
 
 #include "Core/Device.hpp"
+#include "Miscellaneous/MemoryRequirements.hpp"
 
 namespace renderer
 {
@@ -24,16 +25,29 @@ namespace renderer
 	{
 	protected:
 		DeviceMemory( Device const & device
+			, MemoryRequirements const & requirements
 			, MemoryPropertyFlags flags )
 			: m_device{ device }
 			, m_flags{ flags }
+			, m_size{ requirements.size }
 		{
 			registerObject( m_device, "DeviceMemory", this );
+
+			// Some resources (like the OpenGL buffers) don't restrict their memory types.
+			if ( !m_device.getPhysicalDevice().deduceMemoryType( requirements.memoryTypeBits
+				, flags
+				, m_memoryTypeIndex ) )
+			{
+				m_memoryTypeIndex = 0u;
+			}
+
+			m_device.doAddMemory( m_memoryTypeIndex, m_size );
 		}
 
 	public:
 		virtual ~DeviceMemory()
 		{
+			m_device.doRemoveMemory( m_memoryTypeIndex, m_size );
 			unregisterObject( m_device, this );
 		}
 
@@ -109,10 +123,36 @@ namespace renderer
 		*	Unmappe la mémoire de la RAM.
 		*/
 		virtual void unlock()const = 0;
+		/**
+		*\~english
+		*\return
+		*	The memory size.
+		*\~french
+		*\return
+		*	La taille de la mémoire.
+		*/
+		inline uint64_t getSize()const
+		{
+			return m_size;
+		}
+		/**
+		*\~english
+		*\return
+		*	The memory type index.
+		*\~french
+		*\return
+		*	L'indice du type de mémoire.
+		*/
+		inline uint32_t getMemoryTypeIndex()const
+		{
+			return m_memoryTypeIndex;
+		}
 
 	protected:
 		Device const & m_device;
 		MemoryPropertyFlags m_flags;
+		uint64_t m_size;
+		uint32_t m_memoryTypeIndex{ 0u };
 	};
 }
 
@@ -0,0 +1,77 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#ifndef ___Renderer_MemoryStatistics_HPP___
+#define ___Renderer_MemoryStatistics_HPP___
+#pragma once
+
+#include "RendererPrerequisites.hpp"
+
+#include <map>
+
+namespace renderer
+{
+	/**
+	*\~english
+	*\brief
+	*	The device memory usage, for a memory type, a memory heap, or the whole device.
+	*\~french
+	*\brief
+	*	L'utilisation de la mémoire, pour un type de mémoire, un tas mémoire, ou tout le périphérique.
+	*/
+	struct MemoryUsageStatistics
+	{
+		//!\~french		Le nombre d'octets alloués auprès de l'API de rendu.
+		//!\~english	The number of bytes allocated from the rendering API.
+		uint64_t allocatedBytes{ 0u };
+		//!\~french		Le nombre d'octets utilisés par les objets DeviceMemory.
+		//!\~english	The number of bytes used by the DeviceMemory objects.
+		uint64_t usedBytes{ 0u };
+		//!\~french		Le nombre d'allocations auprès de l'API de rendu.
+		//!\~english	The number of allocations from the rendering API.
+		uint32_t blockCount{ 0u };
+		//!\~french		Le nombre d'objets DeviceMemory.
+		//!\~english	The number of DeviceMemory objects.
+		uint32_t allocationCount{ 0u };
+		//!\~french		Le nombre d'octets libres dans les blocs sous-alloués.
+		//!\~english	The number of free bytes in the suballocated blocks.
+		uint64_t freeBytes{ 0u };
+		//!\~french		La taille du plus grand intervalle libre dans un bloc sous-alloué.
+		//!\~english	The size of the largest free range in a suballocated block.
+		uint64_t largestFreeBlock{ 0u };
+		//!\~french		1 - largestFreeBlock / freeBytes, 0 quand il n'y a pas d'espace libre.
+		//!\~english	1 - largestFreeBlock / freeBytes, 0 when there is no free space.
+		float fragmentation{ 0.0f };
+	};
+	/**
+	*\~english
+	*\brief
+	*	The device memory statistics, as returned by Device::getMemoryStatistics.
+	*\~french
+	*\brief
+	*	Les statistiques mémoire du périphérique, telles que retournées par Device::getMemoryStatistics.
+	*/
+	struct MemoryStatistics
+	{
+		//!\~french		L'utilisation par tas mémoire, indexée comme PhysicalDeviceMemoryProperties::memoryHeaps.
+		//!\~english	The usage per memory heap, indexed as PhysicalDeviceMemoryProperties::memoryHeaps.
+		std::vector< MemoryUsageStatistics > heaps;
+		//!\~french		L'utilisation par type de mémoire, indexée comme PhysicalDeviceMemoryProperties::memoryTypes.
+		//!\~english	The usage per memory type, indexed as PhysicalDeviceMemoryProperties::memoryTypes.
+		std::vector< MemoryUsageStatistics > types;
+		//!\~french		L'utilisation totale.
+		//!\~english	The total usage.
+		MemoryUsageStatistics total;
+		//!\~french		Les octets utilisés par les tampons, par cible (un tampon compte pour chacune de ses cibles).
+		//!\~english	The bytes used by the buffers, per target (a buffer counts for each one of its targets).
+		std::map< BufferTarget, uint64_t > bufferTargets;
+		//!\~french		Les octets utilisés par les images, par utilisation (une image compte pour chacune de ses utilisations,
+		//!\~french		et les images aliasées pour toute leur mémoire partagée).
+		//!\~english	The bytes used by the images, per usage (an image counts for each one of its usages,
+		//!\~english	and the aliased images for their whole shared memory).
+		std::map< ImageUsageFlag, uint64_t > imageUsages;
+	};
+}
+
+#endif
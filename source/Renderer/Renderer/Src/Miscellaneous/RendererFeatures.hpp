@@ -26,6 +26,8 @@ namespace renderer
 		bool hasClearTexImage;
 		bool hasComputeShaders;
 		bool hasStorageBuffers;
+		bool hasPersistentMapping;
+		bool hasMemoryAliasing;
 	};
 }
 
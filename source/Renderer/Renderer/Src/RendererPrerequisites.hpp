@@ -75,6 +75,7 @@ namespace renderer
 #include "Enum/MemoryPropertyFlag.hpp"
 #include "Enum/MipmapMode.hpp"
 #include "Enum/MultisampleStateFlag.hpp"
+#include "Enum/ObjectTracking.hpp"
 #include "Enum/PhysicalDeviceType.hpp"
 #include "Enum/PipelineBindPoint.hpp"
 #include "Enum/PipelineStageFlag.hpp"
@@ -182,7 +183,9 @@ namespace renderer
 	struct InputAssemblyState;
 	struct MemoryHeap;
 	struct MemoryRequirements;
+	struct MemoryStatistics;
 	struct MemoryType;
+	struct MemoryUsageStatistics;
 	struct MultisampleState;
 	struct Offset2D;
 	struct Offset3D;
@@ -232,6 +235,7 @@ namespace renderer
 	class FrameBuffer;
 	class ImageMemoryBarrier;
 	class IWindowHandle;
+	class ParallelCommandRecorder;
 	class PhysicalDevice;
 	class Pipeline;
 	class PipelineLayout;
@@ -242,6 +246,7 @@ namespace renderer
 	class RenderingResources;
 	class RenderPass;
 	class RenderSubpass;
+	class RingBuffer;
 	class Sampler;
 	class Semaphore;
 	class ShaderModule;
@@ -253,7 +258,9 @@ namespace renderer
 	class Texture;
 	class FrameBufferAttachment;
 	class TextureView;
+	class TransientTextureAllocator;
 	class UniformBufferBase;
+	class UploadBatcher;
 	class VertexBufferBase;
 	class VertexLayout;
 	class WindowHandle;
@@ -302,6 +309,7 @@ namespace renderer
 	using FencePtr = std::unique_ptr< Fence >;
 	using FrameBufferPtr = std::unique_ptr< FrameBuffer >;
 	using IWindowHandlePtr = std::unique_ptr< IWindowHandle >;
+	using ParallelCommandRecorderPtr = std::unique_ptr< ParallelCommandRecorder >;
 	using PhysicalDevicePtr = std::unique_ptr< PhysicalDevice >;
 	using PipelinePtr = std::unique_ptr< Pipeline >;
 	using PipelineLayoutPtr = std::unique_ptr< PipelineLayout >;
@@ -311,6 +319,7 @@ namespace renderer
 	using RenderingResourcesPtr = std::unique_ptr< RenderingResources >;
 	using RenderPassPtr = std::unique_ptr< RenderPass >;
 	using RenderSubpassPtr = std::unique_ptr< RenderSubpass >;
+	using RingBufferPtr = std::unique_ptr< RingBuffer >;
 	using SamplerPtr = std::unique_ptr< Sampler >;
 	using SemaphorePtr = std::unique_ptr< Semaphore >;
 	using ShaderProgramPtr = std::unique_ptr< ShaderProgram >;
@@ -319,9 +328,11 @@ namespace renderer
 	using SwapChainPtr = std::unique_ptr< SwapChain >;
 	using TexturePtr = std::unique_ptr< Texture >;
 	using TextureViewPtr = std::unique_ptr< TextureView >;
+	using TransientTextureAllocatorPtr = std::unique_ptr< TransientTextureAllocator >;
 	using VertexBufferBasePtr = std::unique_ptr< VertexBufferBase >;
 	using VertexLayoutPtr = std::unique_ptr< VertexLayout >;
 	using UniformBufferBasePtr = std::unique_ptr< UniformBufferBase >;
+	using UploadBatcherPtr = std::unique_ptr< UploadBatcher >;
 
 	using DevicePtr = std::shared_ptr< Device >;
 	using ShaderModulePtr = std::shared_ptr< ShaderModule >;
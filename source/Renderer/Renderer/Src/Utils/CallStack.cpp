@@ -14,6 +14,7 @@
 #	endif
 #endif
 
+#include <algorithm>
 #include <iostream>
 #include <locale>
 
@@ -23,7 +24,11 @@ namespace renderer
 	{
 #if defined( NDEBUG )
 
-		inline void doShowBacktrace( std::ostream & stream, int, int )
+		inline void doCaptureFrames( std::vector< void * > &, int, int )
+		{
+		}
+
+		inline void doShowFrames( std::ostream &, std::vector< void * > const & )
 		{
 		}
 
@@ -67,14 +72,19 @@ namespace renderer
 			}
 		}
 
-		inline void doShowBacktrace( std::ostream & stream, int toCapture, int toSkip )
+		inline void doCaptureFrames( std::vector< void * > & frames, int toCapture, int toSkip )
+		{
+			frames.resize( std::max( toCapture - toSkip, 0 ) );
+			unsigned int num( ::RtlCaptureStackBackTrace( toSkip, DWORD( frames.size() ), frames.data(), nullptr ) );
+			frames.resize( num );
+		}
+
+		inline void doShowFrames( std::ostream & stream, std::vector< void * > const & backTrace )
 		{
 			static std::mutex mutex;
 			std::unique_lock< std::mutex > lock{ mutex };
 			const int MaxFnNameLen( 255 );
-
-			std::vector< void * > backTrace( toCapture - toSkip );
-			unsigned int num( ::RtlCaptureStackBackTrace( toSkip, toCapture - toSkip, backTrace.data(), nullptr ) );
+			auto num = unsigned( backTrace.size() );
 
 			stream << "CALL STACK:" << std::endl;
 
@@ -132,7 +142,11 @@ namespace renderer
 
 #	elif RENDERLIB_ANDROID
 
-		inline void doShowBacktrace( std::ostream & stream, int, int )
+		inline void doCaptureFrames( std::vector< void * > &, int, int )
+		{
+		}
+
+		inline void doShowFrames( std::ostream &, std::vector< void * > const & )
 		{
 		}
 
@@ -173,14 +187,21 @@ namespace renderer
 			return result;
 		}
 
-		inline void doShowBacktrace( std::ostream & stream, int toCapture, int toSkip )
+		inline void doCaptureFrames( std::vector< void * > & frames, int toCapture, int toSkip )
+		{
+			frames.resize( std::max( toCapture, 0 ) );
+			int num( ::backtrace( frames.data(), int( frames.size() ) ) );
+			frames.resize( std::max( num, 0 ) );
+			frames.erase( frames.begin()
+				, frames.begin() + std::min( std::max( toSkip, 0 ), int( frames.size() ) ) );
+		}
+
+		inline void doShowFrames( std::ostream & stream, std::vector< void * > const & backTrace )
 		{
 			stream << "CALL STACK:" << std::endl;
-			std::vector< void * > backTrace( toCapture );
-			unsigned int num( ::backtrace( backTrace.data(), toCapture ) );
-			char ** fnStrings( ::backtrace_symbols( backTrace.data(), num ) );
+			char ** fnStrings( ::backtrace_symbols( backTrace.data(), int( backTrace.size() ) ) );
 
-			for ( unsigned i = toSkip; i < num; ++i )
+			for ( size_t i = 0u; i < backTrace.size(); ++i )
 			{
 				stream << "== " << Demangle( fnStrings[i] ) << std::endl;
 			}
@@ -201,11 +222,29 @@ namespace renderer
 
 #endif
 
+		CapturedBacktrace captureBacktrace( int toCapture, int toSkip )
+		{
+			CapturedBacktrace result;
+			doCaptureFrames( result.frames, toCapture, toSkip );
+			return result;
+		}
+
 		std::ostream & operator<<( std::ostream & stream, Backtrace const & p_backtrace )
 		{
 			static std::locale const loc{ "C" };
 			stream.imbue( loc );
-			doShowBacktrace( stream, p_backtrace.m_toCapture, p_backtrace.m_toSkip );
+			std::vector< void * > frames;
+			// One more frame to skip, for this function.
+			doCaptureFrames( frames, p_backtrace.m_toCapture, p_backtrace.m_toSkip + 1 );
+			doShowFrames( stream, frames );
+			return stream;
+		}
+
+		std::ostream & operator<<( std::ostream & stream, CapturedBacktrace const & p_backtrace )
+		{
+			static std::locale const loc{ "C" };
+			stream.imbue( loc );
+			doShowFrames( stream, p_backtrace.frames );
 			return stream;
 		}
 	}
@@ -21,6 +21,18 @@ namespace renderer
 			{
 			}
 		};
+		/**
+		 *\~english
+		 *\brief		A captured call stack, only holding the frames addresses.
+		 *\remarks		The symbols are only resolved when it is put into a stream.
+		 *\~french
+		 *\brief		Une pile d'appels capturée, ne contenant que les adresses des frames.
+		 *\remarks		Les symboles ne sont résolus que lorsqu'elle est transmise dans un flux.
+		 */
+		struct CapturedBacktrace
+		{
+			std::vector< void * > frames;
+		};
 		/**
 		 *\~english
 		 *\brief		Initialises debug data.
@@ -44,6 +56,26 @@ namespace renderer
 		 *\param[in,out]	p_stream	Le flux
 		 */
 		std::ostream & operator<<( std::ostream & p_stream, Backtrace const & );
+		/**
+		 *\~english
+		 *\brief		Captures the current call stack, without resolving its symbols.
+		 *\param[in]	toCapture	The maximum number of frames to capture.
+		 *\param[in]	toSkip		The number of frames to skip, from the top of the stack.
+		 *\~french
+		 *\brief		Capture la pile d'appels courante, sans résoudre ses symboles.
+		 *\param[in]	toCapture	Le nombre maximal de frames à capturer.
+		 *\param[in]	toSkip		Le nombre de frames à ignorer, depuis le haut de la pile.
+		 */
+		CapturedBacktrace captureBacktrace( int toCapture = 20, int toSkip = 2 );
+		/**
+		 *\~english
+		 *\brief			Puts a captured backtrace into a stream, resolving its symbols.
+		 *\param[in,out]	p_stream	The stream
+		 *\~french
+		 *\brief			Transmet une pile d'appels capturée dans un flux, en résolvant ses symboles.
+		 *\param[in,out]	p_stream	Le flux
+		 */
+		std::ostream & operator<<( std::ostream & p_stream, CapturedBacktrace const & );
 		/*!
 		\author 	Sylvain DOREMUS
 		\date		05/10/2015
@@ -70,10 +70,17 @@ namespace test_renderer
 		m_computeCommandPool = std::make_unique< CommandPool >( *this
 			, m_computeQueue->getFamilyIndex()
 			, renderer::CommandPoolCreateFlag::eResetCommandBuffer | renderer::CommandPoolCreateFlag::eTransient );
+
+		m_transferQueue = std::make_unique< Queue >( *this, m_graphicsQueue->getFamilyIndex() );
+		m_transferCommandPool = std::make_unique< CommandPool >( *this
+			, m_transferQueue->getFamilyIndex()
+			, renderer::CommandPoolCreateFlag::eResetCommandBuffer | renderer::CommandPoolCreateFlag::eTransient );
 	}
 
 	Device::~Device()
 	{
+		m_transferCommandPool.reset();
+		m_transferQueue.reset();
 		m_graphicsCommandPool.reset();
 		m_graphicsQueue.reset();
 		m_presentCommandPool.reset();
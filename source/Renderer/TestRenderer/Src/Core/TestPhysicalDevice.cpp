@@ -203,6 +203,8 @@ namespace test_renderer
 		m_properties.sparseProperties.residencyStandard2DMultisampleBlockShape = true;
 		m_properties.sparseProperties.residencyStandard3DBlockShape = true;
 
+		m_memoryProperties.memoryHeaps.push_back( { 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFF } );
+		m_memoryProperties.memoryTypes.push_back( { 0xFF, 0u } );
 
 		// Et enfin les propriétés des familles de files du GPU.
 		m_queueProperties.reserve( 1u );
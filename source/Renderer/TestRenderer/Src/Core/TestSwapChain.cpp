@@ -29,9 +29,9 @@ namespace test_renderer
 		doCreateBackBuffers();
 		m_renderingResources.resize( 1 );
 
-		for ( auto & resource : m_renderingResources )
+		for ( uint32_t i = 0u; i < m_renderingResources.size(); ++i )
 		{
-			resource = std::make_unique< renderer::RenderingResources >( device );
+			m_renderingResources[i] = std::make_unique< renderer::RenderingResources >( device, i );
 		}
 	}
 
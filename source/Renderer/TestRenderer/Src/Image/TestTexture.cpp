@@ -35,7 +35,8 @@ namespace test_renderer
 			, createInfo.format
 			, createInfo.extent
 			, createInfo.mipLevels
-			, createInfo.arrayLayers }
+			, createInfo.arrayLayers
+			, createInfo.usage }
 		, m_device{ device }
 	{
 	}
@@ -48,8 +49,9 @@ namespace test_renderer
 			, renderer::TextureType::e2D
 			, format
 			, renderer::Extent3D{ dimensions.width, dimensions.height, 1u }
-			, 1u 
-			, 1u }
+			, 1u
+			, 1u
+			, renderer::ImageUsageFlag::eColourAttachment }
 		, m_device{ device }
 	{
 	}
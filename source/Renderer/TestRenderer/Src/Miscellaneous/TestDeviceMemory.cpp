@@ -12,7 +12,7 @@ namespace test_renderer
 	DeviceMemory::DeviceMemory( Device const & device
 		, renderer::MemoryRequirements const & requirements
 		, renderer::MemoryPropertyFlags flags )
-		: renderer::DeviceMemory{ device, flags }
+		: renderer::DeviceMemory{ device, requirements, flags }
 		, m_memory( requirements.size, 0 )
 	{
 	}
@@ -47,10 +47,11 @@ namespace vk_renderer
 
 	void Buffer::doBindMemory()
 	{
+		auto & memory = static_cast< DeviceMemory const & >( *m_storage );
 		auto res = m_device.vkBindBufferMemory( m_device
 			, m_buffer
-			, static_cast< DeviceMemory const & >( *m_storage )
-			, 0 );
+			, memory
+			, memory.getOffset() );
 		checkError( res, "Buffer memory binding" );
 	}
 }
@@ -222,6 +222,7 @@ namespace vk_renderer
 		m_graphicsQueueFamilyIndex = std::numeric_limits< uint32_t >::max();
 		m_presentQueueFamilyIndex = std::numeric_limits< uint32_t >::max();
 		m_computeQueueFamilyIndex = std::numeric_limits< uint32_t >::max();
+		m_transferQueueFamilyIndex = std::numeric_limits< uint32_t >::max();
 
 		for ( auto & present : supportsPresent )
 		{
@@ -266,6 +267,27 @@ namespace vk_renderer
 			++i;
 		}
 
+		// Une file ne supportant que les transferts permet de les faire en parallèle du rendu.
+		for ( uint32_t index = 0u; index < m_gpu.getQueueProperties().size(); ++index )
+		{
+			auto & props = m_gpu.getQueueProperties()[index];
+
+			if ( props.queueCount > 0
+				&& checkFlag( props.queueFlags, renderer::QueueFlag::eTransfer )
+				&& !checkFlag( props.queueFlags, renderer::QueueFlag::eGraphics )
+				&& !checkFlag( props.queueFlags, renderer::QueueFlag::eCompute ) )
+			{
+				m_transferQueueFamilyIndex = index;
+				break;
+			}
+		}
+
+		// Sinon, la file graphique fait aussi les transferts.
+		if ( m_transferQueueFamilyIndex == std::numeric_limits< uint32_t >::max() )
+		{
+			m_transferQueueFamilyIndex = m_graphicsQueueFamilyIndex;
+		}
+
 		if ( m_presentQueueFamilyIndex == std::numeric_limits< uint32_t >::max() )
 		{
 			// Pas de file supportant les deux, on a donc 2 files distinctes.
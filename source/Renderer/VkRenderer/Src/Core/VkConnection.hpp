@@ -87,6 +87,22 @@ namespace vk_renderer
 		/**
 		*\~french
 		*\return
+		*	L'index du type de file de transfert.
+		*\remarks
+		*	C'est celui de la file graphique, si le GPU n'a pas de file dédiée aux transferts.
+		*\~english
+		*\return
+		*	The transfer queue's family index.
+		*\remarks
+		*	It is the graphic queue's one, if the GPU has no queue dedicated to transfers.
+		*/
+		inline auto getTransferQueueFamilyIndex()const
+		{
+			return m_transferQueueFamilyIndex;
+		}
+		/**
+		*\~french
+		*\return
 		*	Le périphérique physique.
 		*\~english
 		*\return
@@ -111,5 +127,6 @@ namespace vk_renderer
 		uint32_t m_graphicsQueueFamilyIndex{ std::numeric_limits< uint32_t >::max() };
 		uint32_t m_computeQueueFamilyIndex{ std::numeric_limits< uint32_t >::max() };
 		uint32_t m_presentQueueFamilyIndex{ std::numeric_limits< uint32_t >::max() };
+		uint32_t m_transferQueueFamilyIndex{ std::numeric_limits< uint32_t >::max() };
 	};
 }
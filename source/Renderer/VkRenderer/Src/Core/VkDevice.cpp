@@ -19,6 +19,7 @@ See LICENSE file in root folder.
 #include "Image/VkTexture.hpp"
 #include "Image/VkTextureView.hpp"
 #include "Miscellaneous/VkDeviceMemory.hpp"
+#include "Miscellaneous/VkMemoryAllocator.hpp"
 #include "Miscellaneous/VkQueryPool.hpp"
 #include "Pipeline/VkPipelineLayout.hpp"
 #include "RenderPass/VkRenderPass.hpp"
@@ -80,6 +81,21 @@ namespace vk_renderer
 			} );
 		}
 
+		if ( m_connection->getTransferQueueFamilyIndex() != m_connection->getGraphicsQueueFamilyIndex()
+			&& m_connection->getTransferQueueFamilyIndex() != m_connection->getPresentQueueFamilyIndex()
+			&& m_connection->getTransferQueueFamilyIndex() != m_connection->getComputeQueueFamilyIndex() )
+		{
+			queueCreateInfos.push_back(
+			{
+				VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,             // sType
+				nullptr,                                                // pNext
+				0,                                                      // flags
+				m_connection->getTransferQueueFamilyIndex(),            // queueFamilyIndex
+				static_cast< uint32_t >( queuePriorities.size() ),      // queueCount
+				queuePriorities.data()                                  // pQueuePriorities
+			} );
+		}
+
 		VkDeviceCreateInfo deviceInfo
 		{
 			VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
@@ -101,6 +117,8 @@ namespace vk_renderer
 #define VK_LIB_DEVICE_FUNCTION( fun ) fun = reinterpret_cast< PFN_##fun >( renderer.vkGetDeviceProcAddr( m_device, #fun ) );
 #include "Miscellaneous/VulkanFunctionsList.inl"
 
+		m_memoryAllocator = std::make_unique< MemoryAllocator >( *this );
+
 		m_presentQueue = std::make_unique< Queue >( *this, m_connection->getPresentQueueFamilyIndex() );
 		m_presentCommandPool = std::make_unique< CommandPool >( *this
 			, m_presentQueue->getFamilyIndex()
@@ -131,16 +149,32 @@ namespace vk_renderer
 		m_computeCommandPool = std::make_unique< CommandPool >( *this
 			, m_computeQueue->getFamilyIndex()
 			, renderer::CommandPoolCreateFlag::eResetCommandBuffer | renderer::CommandPoolCreateFlag::eTransient );
+
+		if ( m_connection->getGraphicsQueueFamilyIndex() != m_connection->getTransferQueueFamilyIndex() )
+		{
+			m_transferQueue = std::make_unique< Queue >( *this, m_connection->getTransferQueueFamilyIndex() );
+		}
+		else
+		{
+			m_transferQueue = std::make_unique< Queue >( *this, m_graphicsQueue->getFamilyIndex() );
+		}
+
+		m_transferCommandPool = std::make_unique< CommandPool >( *this
+			, m_transferQueue->getFamilyIndex()
+			, renderer::CommandPoolCreateFlag::eResetCommandBuffer | renderer::CommandPoolCreateFlag::eTransient );
 	}
 
 	Device::~Device()
 	{
+		m_transferCommandPool.reset();
+		m_transferQueue.reset();
 		m_graphicsCommandPool.reset();
 		m_graphicsQueue.reset();
 		m_presentCommandPool.reset();
 		m_presentQueue.reset();
 		m_computeCommandPool.reset();
 		m_computeQueue.reset();
+		m_memoryAllocator.reset();
 		vkDestroyDevice( m_device, nullptr );
 	}
 
@@ -173,6 +207,7 @@ namespace vk_renderer
 		, renderer::MemoryPropertyFlags flags )const
 	{
 		return std::make_unique< DeviceMemory >( *this
+			, *m_memoryAllocator
 			, requirements
 			, flags );
 	}
@@ -295,6 +330,11 @@ namespace vk_renderer
 		checkError( vkDeviceWaitIdle( m_device ), "Device wait idle" );
 	}
 
+	void Device::doFillMemoryStatistics( renderer::MemoryStatistics & statistics )const
+	{
+		m_memoryAllocator->fillStatistics( statistics );
+	}
+
 	renderer::MemoryRequirements Device::getBufferMemoryRequirements( VkBuffer buffer )const
 	{
 		VkMemoryRequirements requirements;
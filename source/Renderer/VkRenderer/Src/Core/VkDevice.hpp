@@ -233,6 +233,10 @@ namespace vk_renderer
 		void doDisable()const override
 		{
 		}
+		/**
+		*\copydoc	renderer::Device::doFillMemoryStatistics
+		*/
+		void doFillMemoryStatistics( renderer::MemoryStatistics & statistics )const override;
 
 	private:
 		Renderer const & m_renderer;
@@ -240,5 +244,6 @@ namespace vk_renderer
 		ConnectionPtr m_connection;
 		VkPhysicalDeviceFeatures m_enabledFeatures;
 		VkDevice m_device{ VK_NULL_HANDLE };
+		MemoryAllocatorPtr m_memoryAllocator;
 	};
 }
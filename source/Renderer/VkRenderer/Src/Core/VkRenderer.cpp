@@ -137,6 +137,8 @@ namespace vk_renderer
 		m_features.hasClearTexImage = true;
 		m_features.hasComputeShaders = true;
 		m_features.hasStorageBuffers = true;
+		m_features.hasPersistentMapping = true;
+		m_features.hasMemoryAliasing = true;
 		m_library.getFunction( "vkGetInstanceProcAddr", GetInstanceProcAddr );
 
 		if ( !GetInstanceProcAddr )
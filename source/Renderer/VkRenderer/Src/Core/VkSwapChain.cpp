@@ -36,9 +36,9 @@ namespace vk_renderer
 
 		m_renderingResources.resize( 3 );
 
-		for ( auto & resource : m_renderingResources )
+		for ( uint32_t i = 0u; i < m_renderingResources.size(); ++i )
 		{
-			resource = std::make_unique< renderer::RenderingResources >( device );
+			m_renderingResources[i] = std::make_unique< renderer::RenderingResources >( device, i );
 		}
 	}
 
@@ -391,9 +391,9 @@ namespace vk_renderer
 
 		m_renderingResources.resize( 3 );
 
-		for ( auto & resource : m_renderingResources )
+		for ( uint32_t i = 0u; i < m_renderingResources.size(); ++i )
 		{
-			resource = std::make_unique< renderer::RenderingResources >( m_device );
+			m_renderingResources[i] = std::make_unique< renderer::RenderingResources >( m_device, i );
 		}
 
 		onReset();
@@ -111,7 +111,8 @@ namespace vk_renderer
 			, createInfo.format
 			, createInfo.extent
 			, createInfo.mipLevels
-			, createInfo.arrayLayers }
+			, createInfo.arrayLayers
+			, createInfo.usage }
 		, m_device{ device }
 		, m_image{}
 		, m_owner{ true }
@@ -153,8 +154,9 @@ namespace vk_renderer
 			, renderer::TextureType::e2D
 			, doSelectFormat( device, format )
 			, renderer::Extent3D{ dimensions.width, dimensions.height, 1u }
-			, 1u 
-			, 1u }
+			, 1u
+			, 1u
+			, renderer::ImageUsageFlag::eColourAttachment }
 		, m_device{ device }
 		, m_image{ image }
 		, m_owner{ false }
@@ -209,10 +211,11 @@ namespace vk_renderer
 
 	void Texture::doBindMemory()
 	{
+		auto & memory = static_cast< DeviceMemory const & >( *m_storage );
 		auto res = m_device.vkBindImageMemory( m_device
 			, m_image
-			, static_cast< DeviceMemory const & >( *m_storage )
-			, 0 );
+			, memory
+			, memory.getOffset() + m_storageOffset );
 		checkError( res, "Image storage binding" );
 	}
 }
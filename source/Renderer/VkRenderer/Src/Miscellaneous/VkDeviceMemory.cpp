@@ -1,6 +1,6 @@
 /*
 This file belongs to RendererLib.
-See LICENSE file in root folder
+See LICENSE file in root folder.
 */
 #include "Miscellaneous/VkDeviceMemory.hpp"
 
@@ -10,10 +10,12 @@ See LICENSE file in root folder
 namespace vk_renderer
 {
 	DeviceMemory::DeviceMemory( Device const & device
+		, MemoryAllocator & allocator
 		, renderer::MemoryRequirements const & requirements
 		, renderer::MemoryPropertyFlags flags )
-		: renderer::DeviceMemory{ device, flags }
+		: renderer::DeviceMemory{ device, requirements, flags }
 		, m_device{ device }
+		, m_allocator{ allocator }
 	{
 		uint32_t deducedTypeIndex{ 0xFFFFFFFF };
 
@@ -24,49 +26,43 @@ namespace vk_renderer
 			throw std::runtime_error{ "Could not find an appropriate memory type for buffer storage" };
 		}
 
-		VkMemoryAllocateInfo allocateInfo
-		{
-			VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
-			nullptr,
-			requirements.size,                        // allocationSize
-			deducedTypeIndex                          // memoryTypeIndex
-		};
-		DEBUG_DUMP( allocateInfo );
-		auto res = m_device.vkAllocateMemory( m_device, &allocateInfo, nullptr, &m_memory );
-		checkError( res, "DeviceMemory allocation" );
+		m_allocation = m_allocator.allocate( requirements, deducedTypeIndex );
 	}
 
 	DeviceMemory::~DeviceMemory()
 	{
-		m_device.vkFreeMemory( m_device, m_memory, nullptr );
+		m_allocator.deallocate( m_allocation );
 	}
 
 	uint8_t * DeviceMemory::lock( uint32_t offset
 		, uint32_t size
 		, renderer::MemoryMapFlags flags )const
 	{
-		uint8_t * pointer{ nullptr };
-		auto res = m_device.vkMapMemory( m_device
-			, m_memory
-			, offset
-			, size
-			, 0u/*flags*/
-			, reinterpret_cast< void ** >( &pointer ) );
-		checkError( res, "DeviceMemory mapping" );
-		return pointer;
+		if ( !m_allocation.data )
+		{
+			// Only the host visible blocks are mapped, as vkMapMemory would have failed.
+			checkError( VK_ERROR_MEMORY_MAP_FAILED, "DeviceMemory mapping" );
+		}
+
+		if ( uint64_t( offset ) + size > m_allocation.size )
+		{
+			// vkMapMemory would have failed on a range outside of the memory.
+			checkError( VK_ERROR_MEMORY_MAP_FAILED, "DeviceMemory mapping range" );
+		}
+
+		// The block stays mapped as a whole, the flags have nothing left to configure.
+		return m_allocation.data + offset;
 	}
 
 	void DeviceMemory::flush( uint32_t offset
 		, uint32_t size )const
 	{
-		VkMappedMemoryRange mappedRange
+		if ( m_allocation.coherent )
 		{
-			VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
-			nullptr,
-			m_memory,                                         // memory
-			0,                                                // offset
-			size                                              // size
-		};
+			return;
+		}
+
+		auto mappedRange = m_allocator.makeMappedRange( m_allocation, offset, size );
 		DEBUG_DUMP( mappedRange );
 		auto res = m_device.vkFlushMappedMemoryRanges( m_device, 1, &mappedRange );
 		checkError( res, "DeviceMemory range flush" );
@@ -75,14 +71,12 @@ namespace vk_renderer
 	void DeviceMemory::invalidate( uint32_t offset
 		, uint32_t size )const
 	{
-		VkMappedMemoryRange mappedRange
+		if ( m_allocation.coherent )
 		{
-			VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
-			nullptr,
-			m_memory,                                         // memory
-			0,                                                // offset
-			size                                              // size
-		};
+			return;
+		}
+
+		auto mappedRange = m_allocator.makeMappedRange( m_allocation, offset, size );
 		DEBUG_DUMP( mappedRange );
 		auto res = m_device.vkInvalidateMappedMemoryRanges( m_device, 1, &mappedRange );
 		checkError( res, "DeviceMemory mapped range invalidation" );
@@ -90,6 +84,6 @@ namespace vk_renderer
 
 	void DeviceMemory::unlock()const
 	{
-		m_device.vkUnmapMemory( m_device, m_memory );
+		// The memory stays mapped until its block is released.
 	}
 }
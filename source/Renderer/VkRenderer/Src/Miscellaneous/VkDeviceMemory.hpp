@@ -4,7 +4,7 @@ See LICENSE file in root folder
 */
 #pragma once
 
-#include "VkRendererPrerequisites.hpp"
+#include "Miscellaneous/VkMemoryAllocator.hpp"
 
 #include <Miscellaneous/DeviceMemory.hpp>
 
@@ -14,9 +14,21 @@ namespace vk_renderer
 	*\~french
 	*\brief
 	*	Classe encapsulant le stockage alloué à un tampon de données.
+	*\remarks
+	*	Le stockage est sous-alloué par le MemoryAllocator du périphérique,
+	*	les ressources doivent être liées à getOffset() dans la mémoire.
+	*	La mémoire visible par l'hôte reste mappée en entier, lock() ne fait que vérifier l'intervalle
+	*	et calculer un pointeur, sans tenir compte des indicateurs de mapping,
+	*	et flush() et invalidate() ne font rien si elle est cohérente.
 	*\~english
 	*\brief
 	*	Class wrapping a storage allocated to a data buffer.
+	*\remarks
+	*	The storage is suballocated by the device's MemoryAllocator,
+	*	the resources must be bound at getOffset() in the memory.
+	*	Host visible memory stays mapped as a whole, lock() only checks the range
+	*	and computes a pointer, regardless of the mapping flags,
+	*	and flush() and invalidate() do nothing if it is coherent.
 	*/
 	class DeviceMemory
 		: public renderer::DeviceMemory
@@ -28,6 +40,8 @@ namespace vk_renderer
 		*	Constructeur.
 		*\param[in] device
 		*	Le LogicalDevice parent.
+		*\param[in] allocator
+		*	L'allocateur depuis lequel la mémoire est sous-allouée.
 		*\param[in] requirements
 		*	Les exigences mémoire.
 		*\param[in] flags
@@ -37,12 +51,15 @@ namespace vk_renderer
 		*	Constructor.
 		*\param[in] device
 		*	The logical connection to the GPU.
+		*\param[in] allocator
+		*	The allocator from which the memory is suballocated.
 		*\param[in] requirements
 		*	The memory requirements.
 		*\param[in] flags
 		*	The wanted memory flags.
 		*/
 		DeviceMemory( Device const & device
+			, MemoryAllocator & allocator
 			, renderer::MemoryRequirements const & requirements
 			, renderer::MemoryPropertyFlags flags );
 		/**
@@ -84,11 +101,24 @@ namespace vk_renderer
 		*/
 		inline operator VkDeviceMemory const &()const
 		{
-			return m_memory;
+			return m_allocation.memory;
+		}
+		/**
+		*\~french
+		*\return
+		*	Le décalage du stockage dans la VkDeviceMemory.
+		*\~english
+		*\return
+		*	The storage offset in the VkDeviceMemory.
+		*/
+		inline VkDeviceSize getOffset()const
+		{
+			return m_allocation.offset;
 		}
 
 	private:
 		Device const & m_device;
-		VkDeviceMemory m_memory{};
+		MemoryAllocator & m_allocator;
+		MemoryAllocation m_allocation;
 	};
 }
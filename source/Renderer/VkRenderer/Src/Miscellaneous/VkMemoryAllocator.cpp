@@ -0,0 +1,394 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder.
+*/
+#include "Miscellaneous/VkMemoryAllocator.hpp"
+
+#include "Core/VkDevice.hpp"
+#include "Core/VkPhysicalDevice.hpp"
+
+#include <algorithm>
+#include <set>
+
+namespace vk_renderer
+{
+	struct MemoryBlock
+	{
+		VkDeviceMemory memory{ VK_NULL_HANDLE };
+		VkDeviceSize size{ 0u };
+		uint32_t poolIndex{ 0u };
+		bool dedicated{ false };
+		// The free nodes offsets, per order.
+		std::vector< std::set< VkDeviceSize > > freeNodes;
+		VkDeviceSize freeSize{ 0u };
+		uint8_t * mapped{ nullptr };
+	};
+
+	namespace
+	{
+		VkDeviceSize getNextPowerOfTwo( VkDeviceSize value )
+		{
+			VkDeviceSize result = 1u;
+
+			while ( result < value )
+			{
+				result <<= 1;
+			}
+
+			return result;
+		}
+
+		uint32_t getOrder( VkDeviceSize nodeSize )
+		{
+			uint32_t result = 0u;
+
+			while ( ( MemoryAllocator::MinNodeSize << result ) < nodeSize )
+			{
+				++result;
+			}
+
+			return result;
+		}
+
+		bool isEmpty( MemoryBlock const & block )
+		{
+			return !block.dedicated
+				&& block.freeSize == block.size;
+		}
+	}
+
+	MemoryAllocator::MemoryAllocator( Device const & device )
+		: m_device{ device }
+		, m_bufferImageGranularity{ std::max( VkDeviceSize( 1u ), VkDeviceSize( device.getPhysicalDevice().getProperties().limits.bufferImageGranularity ) ) }
+		, m_nonCoherentAtomSize{ std::max( VkDeviceSize( 1u ), VkDeviceSize( device.getPhysicalDevice().getProperties().limits.nonCoherentAtomSize ) ) }
+	{
+		auto & memoryProperties = device.getPhysicalDevice().getMemoryProperties();
+
+		for ( uint32_t index = 0u; index < memoryProperties.memoryTypes.size(); ++index )
+		{
+			auto & memoryType = memoryProperties.memoryTypes[index];
+			auto heapSize = memoryProperties.memoryHeaps[memoryType.heapIndex].size;
+			auto hostVisible = checkFlag( memoryType.propertyFlags, renderer::MemoryPropertyFlag::eHostVisible );
+			auto hostCoherent = checkFlag( memoryType.propertyFlags, renderer::MemoryPropertyFlag::eHostCoherent );
+			auto blockSize = DefaultBlockSize;
+
+			// Small heaps (like the host visible device local one) get smaller blocks.
+			while ( blockSize > MinBlockSize
+				&& blockSize > heapSize / 8u )
+			{
+				blockSize >>= 1;
+			}
+
+			m_pools.push_back( { blockSize, index, hostVisible, hostCoherent, {} } );
+			m_pools.push_back( { blockSize, index, hostVisible, hostCoherent, {} } );
+		}
+	}
+
+	MemoryAllocator::~MemoryAllocator()
+	{
+		for ( auto & pool : m_pools )
+		{
+			for ( auto & block : pool.blocks )
+			{
+				if ( block->mapped )
+				{
+					m_device.vkUnmapMemory( m_device, block->memory );
+				}
+
+				m_device.vkFreeMemory( m_device, block->memory, nullptr );
+			}
+		}
+	}
+
+	MemoryAllocation MemoryAllocator::allocate( renderer::MemoryRequirements const & requirements
+		, uint32_t memoryTypeIndex )
+	{
+		auto poolIndex = memoryTypeIndex * 2u
+			+ ( requirements.type == renderer::ResourceType::eImage ? 1u : 0u );
+		assert( poolIndex < m_pools.size() );
+		auto & pool = m_pools[poolIndex];
+		// Images are padded to the granularity, as they may be linear or optimal.
+		auto granularity = requirements.type == renderer::ResourceType::eImage
+			? m_bufferImageGranularity
+			: VkDeviceSize( 1u );
+		// Buddy nodes are aligned on their size, so a node at least as big as the alignment is correctly aligned.
+		auto nodeSize = getNextPowerOfTwo( std::max( { VkDeviceSize( requirements.size )
+			, VkDeviceSize( requirements.alignment )
+			, granularity
+			, MinNodeSize } ) );
+		std::lock_guard< std::mutex > lock{ m_mutex };
+
+		if ( nodeSize <= pool.blockSize / 2u )
+		{
+			auto order = getOrder( nodeSize );
+			VkDeviceSize offset{ 0u };
+
+			for ( auto & block : pool.blocks )
+			{
+				if ( !block->dedicated
+					&& block->freeSize >= nodeSize
+					&& doAllocateNode( *block, order, offset ) )
+				{
+					return doMakeAllocation( pool, *block, offset, requirements.size, order );
+				}
+			}
+
+			auto block = doCreateBlock( pool, poolIndex, pool.blockSize, false );
+
+			if ( block )
+			{
+				doAllocateNode( *block, order, offset );
+				return doMakeAllocation( pool, *block, offset, requirements.size, order );
+			}
+		}
+
+		auto block = doCreateBlock( pool, poolIndex, requirements.size, true );
+
+		if ( !block )
+		{
+			throw std::runtime_error{ "Could not allocate device memory" };
+		}
+
+		return doMakeAllocation( pool, *block, 0u, requirements.size, 0u );
+	}
+
+	void MemoryAllocator::deallocate( MemoryAllocation const & allocation )
+	{
+		assert( allocation.block );
+		std::lock_guard< std::mutex > lock{ m_mutex };
+		auto & block = *allocation.block;
+		auto & pool = m_pools[block.poolIndex];
+
+		if ( block.dedicated )
+		{
+			doDestroyBlock( pool, block );
+			return;
+		}
+
+		doDeallocateNode( block, allocation.order, allocation.offset );
+
+		// Only one empty block is kept per pool, to avoid reallocating one for each new resource.
+		if ( isEmpty( block )
+			&& std::count_if( pool.blocks.begin()
+				, pool.blocks.end()
+				, []( MemoryBlockPtr const & lookup )
+				{
+					return isEmpty( *lookup );
+				} ) > 1 )
+		{
+			doDestroyBlock( pool, block );
+		}
+	}
+
+	VkMappedMemoryRange MemoryAllocator::makeMappedRange( MemoryAllocation const & allocation
+		, VkDeviceSize offset
+		, VkDeviceSize size )const
+	{
+		assert( allocation.block );
+		auto & block = *allocation.block;
+		auto begin = allocation.offset + offset;
+		auto end = begin + size;
+		begin = ( begin / m_nonCoherentAtomSize ) * m_nonCoherentAtomSize;
+		end = std::min( block.size
+			, ( ( end + m_nonCoherentAtomSize - 1u ) / m_nonCoherentAtomSize ) * m_nonCoherentAtomSize );
+		return VkMappedMemoryRange
+		{
+			VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+			nullptr,
+			block.memory,                                     // memory
+			begin,                                            // offset
+			end - begin                                       // size
+		};
+	}
+
+	void MemoryAllocator::fillStatistics( renderer::MemoryStatistics & statistics )const
+	{
+		std::lock_guard< std::mutex > lock{ m_mutex };
+
+		for ( auto & pool : m_pools )
+		{
+			assert( pool.memoryTypeIndex < statistics.types.size() );
+			auto & type = statistics.types[pool.memoryTypeIndex];
+
+			for ( auto & block : pool.blocks )
+			{
+				type.allocatedBytes += block->size;
+				++type.blockCount;
+
+				if ( !block->dedicated )
+				{
+					type.freeBytes += block->freeSize;
+					// The biggest free node is the one with the highest order.
+					auto it = std::find_if( block->freeNodes.rbegin()
+						, block->freeNodes.rend()
+						, []( std::set< VkDeviceSize > const & nodes )
+						{
+							return !nodes.empty();
+						} );
+
+					if ( it != block->freeNodes.rend() )
+					{
+						auto order = uint32_t( std::distance( it, block->freeNodes.rend() ) - 1 );
+						type.largestFreeBlock = std::max( type.largestFreeBlock, MinNodeSize << order );
+					}
+				}
+			}
+		}
+	}
+
+	MemoryBlock * MemoryAllocator::doCreateBlock( Pool & pool
+		, uint32_t poolIndex
+		, VkDeviceSize size
+		, bool dedicated )
+	{
+		VkMemoryAllocateInfo allocateInfo
+		{
+			VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+			nullptr,
+			size,                                     // allocationSize
+			pool.memoryTypeIndex                      // memoryTypeIndex
+		};
+		DEBUG_DUMP( allocateInfo );
+		VkDeviceMemory memory{ VK_NULL_HANDLE };
+		auto res = m_device.vkAllocateMemory( m_device, &allocateInfo, nullptr, &memory );
+
+		if ( res != VK_SUCCESS )
+		{
+			return nullptr;
+		}
+
+		uint8_t * mapped{ nullptr };
+
+		if ( pool.hostVisible )
+		{
+			// Host visible blocks stay mapped, locking a resource then only computes a pointer.
+			res = m_device.vkMapMemory( m_device
+				, memory
+				, 0u
+				, VK_WHOLE_SIZE
+				, 0u
+				, reinterpret_cast< void ** >( &mapped ) );
+
+			if ( res != VK_SUCCESS )
+			{
+				m_device.vkFreeMemory( m_device, memory, nullptr );
+				checkError( res, "DeviceMemory mapping" );
+			}
+		}
+
+		auto block = std::make_unique< MemoryBlock >();
+		block->memory = memory;
+		block->size = size;
+		block->poolIndex = poolIndex;
+		block->dedicated = dedicated;
+		block->mapped = mapped;
+
+		if ( !dedicated )
+		{
+			auto maxOrder = getOrder( size );
+			block->freeNodes.resize( maxOrder + 1u );
+			block->freeNodes[maxOrder].insert( 0u );
+			block->freeSize = size;
+		}
+
+		pool.blocks.push_back( std::move( block ) );
+		return pool.blocks.back().get();
+	}
+
+	void MemoryAllocator::doDestroyBlock( Pool & pool
+		, MemoryBlock const & block )
+	{
+		auto it = std::find_if( pool.blocks.begin()
+			, pool.blocks.end()
+			, [&block]( MemoryBlockPtr const & lookup )
+			{
+				return lookup.get() == &block;
+			} );
+		assert( it != pool.blocks.end() );
+
+		if ( block.mapped )
+		{
+			m_device.vkUnmapMemory( m_device, block.memory );
+		}
+
+		m_device.vkFreeMemory( m_device, block.memory, nullptr );
+		pool.blocks.erase( it );
+	}
+
+	MemoryAllocation MemoryAllocator::doMakeAllocation( Pool const & pool
+		, MemoryBlock & block
+		, VkDeviceSize offset
+		, VkDeviceSize size
+		, uint32_t order )const
+	{
+		return
+		{
+			&block,
+			block.memory,
+			offset,
+			size,
+			order,
+			block.mapped
+				? block.mapped + offset
+				: nullptr,
+			pool.hostCoherent
+		};
+	}
+
+	bool MemoryAllocator::doAllocateNode( MemoryBlock & block
+		, uint32_t order
+		, VkDeviceSize & offset )
+	{
+		auto current = order;
+
+		while ( current < block.freeNodes.size()
+			&& block.freeNodes[current].empty() )
+		{
+			++current;
+		}
+
+		if ( current >= block.freeNodes.size() )
+		{
+			return false;
+		}
+
+		auto it = block.freeNodes[current].begin();
+		offset = *it;
+		block.freeNodes[current].erase( it );
+
+		// Split the found node until it has the wanted size, the upper halves become free nodes.
+		while ( current > order )
+		{
+			--current;
+			block.freeNodes[current].insert( offset + ( MinNodeSize << current ) );
+		}
+
+		block.freeSize -= MinNodeSize << order;
+		return true;
+	}
+
+	void MemoryAllocator::doDeallocateNode( MemoryBlock & block
+		, uint32_t order
+		, VkDeviceSize offset )
+	{
+		block.freeSize += MinNodeSize << order;
+
+		// Merge the node with its buddy, as long as the buddy is free.
+		while ( order + 1u < block.freeNodes.size() )
+		{
+			auto buddy = offset ^ ( MinNodeSize << order );
+			auto it = block.freeNodes[order].find( buddy );
+
+			if ( it == block.freeNodes[order].end() )
+			{
+				break;
+			}
+
+			block.freeNodes[order].erase( it );
+			offset = std::min( offset, buddy );
+			++order;
+		}
+
+		block.freeNodes[order].insert( offset );
+	}
+}
@@ -0,0 +1,189 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "VkRendererPrerequisites.hpp"
+
+#include <Miscellaneous/MemoryRequirements.hpp>
+#include <Miscellaneous/MemoryStatistics.hpp>
+
+#include <mutex>
+
+namespace vk_renderer
+{
+	struct MemoryBlock;
+	/**
+	*\~french
+	*\brief
+	*	Une sous-allocation dans un bloc de mémoire.
+	*\~english
+	*\brief
+	*	A suballocation inside a memory block.
+	*/
+	struct MemoryAllocation
+	{
+		//! Le bloc contenant l'allocation.
+		MemoryBlock * block{ nullptr };
+		//! La mémoire du bloc, à laquelle les ressources sont liées.
+		VkDeviceMemory memory{ VK_NULL_HANDLE };
+		//! Le décalage de l'allocation dans le bloc.
+		VkDeviceSize offset{ 0u };
+		//! La taille de l'allocation.
+		VkDeviceSize size{ 0u };
+		//! L'ordre du noeud alloué dans le bloc.
+		uint32_t order{ 0u };
+		//! Le pointeur sur le début de l'allocation, si la mémoire est visible par l'hôte.
+		uint8_t * data{ nullptr };
+		//! Dit si la mémoire est cohérente avec l'hôte.
+		bool coherent{ false };
+	};
+	/**
+	*\~french
+	*\brief
+	*	Allocateur de mémoire, sous-allouant les ressources dans de grands blocs.
+	*\remarks
+	*	Chaque type de mémoire a deux groupes de blocs, l'un pour les tampons, l'autre pour les images,
+	*	afin que les ressources linéaires et non linéaires ne partagent jamais une page de bufferImageGranularity.
+	*	Les blocs sont gérés par un allocateur buddy : les noeuds libérés sont fusionnés avec leur voisin
+	*	lorsque celui-ci est libre aussi.
+	*	Les allocations plus grandes que la moitié d'un bloc reçoivent leur propre VkDeviceMemory.
+	*	Les blocs visibles par l'hôte sont mappés en entier pendant toute leur durée de vie.
+	*\~english
+	*\brief
+	*	Memory allocator, suballocating the resources inside big blocks.
+	*\remarks
+	*	Each memory type has two block pools, one for buffers, the other for images,
+	*	so that linear and non linear resources never share a bufferImageGranularity page.
+	*	Blocks are managed by a buddy allocator: released nodes are merged with their buddy
+	*	when it is free too.
+	*	Allocations bigger than half a block get their own VkDeviceMemory.
+	*	Host visible blocks are wholly mapped for their whole lifetime.
+	*/
+	class MemoryAllocator
+	{
+	public:
+		//! La taille du plus petit noeud alloué.
+		static VkDeviceSize constexpr MinNodeSize = 256u;
+		//! La taille par défaut d'un bloc, réduite pour les petits tas.
+		static VkDeviceSize constexpr DefaultBlockSize = 64u * 1024u * 1024u;
+		//! La taille minimale d'un bloc.
+		static VkDeviceSize constexpr MinBlockSize = 1024u * 1024u;
+
+	public:
+		/**
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*/
+		explicit MemoryAllocator( Device const & device );
+		/**
+		*\~french
+		*\brief
+		*	Destructeur, libère tous les blocs.
+		*\~english
+		*\brief
+		*	Destructor, releases all the blocks.
+		*/
+		~MemoryAllocator();
+		/**
+		*\~french
+		*\brief
+		*	Alloue de la mémoire pour une ressource.
+		*\param[in] requirements
+		*	Les exigences mémoire de la ressource.
+		*\param[in] memoryTypeIndex
+		*	L'indice du type de mémoire.
+		*\return
+		*	L'allocation, dont le décalage respecte l'alignement demandé.
+		*\~english
+		*\brief
+		*	Allocates memory for a resource.
+		*\param[in] requirements
+		*	The resource memory requirements.
+		*\param[in] memoryTypeIndex
+		*	The memory type index.
+		*\return
+		*	The allocation, which offset matches the requested alignment.
+		*/
+		MemoryAllocation allocate( renderer::MemoryRequirements const & requirements
+			, uint32_t memoryTypeIndex );
+		/**
+		*\~french
+		*\brief
+		*	Libère une allocation.
+		*\~english
+		*\brief
+		*	Releases an allocation.
+		*/
+		void deallocate( MemoryAllocation const & allocation );
+		/**
+		*\~french
+		*\brief
+		*	Crée l'intervalle mappé correspondant à un intervalle d'une allocation,
+		*	aligné sur nonCoherentAtomSize.
+		*\~english
+		*\brief
+		*	Creates the mapped range matching a range of an allocation,
+		*	aligned on nonCoherentAtomSize.
+		*/
+		VkMappedMemoryRange makeMappedRange( MemoryAllocation const & allocation
+			, VkDeviceSize offset
+			, VkDeviceSize size )const;
+		/**
+		*\~french
+		*\brief
+		*	Remplit les octets alloués, le nombre de blocs et les intervalles libres, par type de mémoire.
+		*\~english
+		*\brief
+		*	Fills the allocated bytes, the blocks count and the free ranges, per memory type.
+		*/
+		void fillStatistics( renderer::MemoryStatistics & statistics )const;
+
+	private:
+		using MemoryBlockPtr = std::unique_ptr< MemoryBlock >;
+
+		struct Pool
+		{
+			VkDeviceSize blockSize;
+			uint32_t memoryTypeIndex;
+			bool hostVisible;
+			bool hostCoherent;
+			std::vector< MemoryBlockPtr > blocks;
+		};
+
+		MemoryBlock * doCreateBlock( Pool & pool
+			, uint32_t poolIndex
+			, VkDeviceSize size
+			, bool dedicated );
+		void doDestroyBlock( Pool & pool
+			, MemoryBlock const & block );
+		MemoryAllocation doMakeAllocation( Pool const & pool
+			, MemoryBlock & block
+			, VkDeviceSize offset
+			, VkDeviceSize size
+			, uint32_t order )const;
+		bool doAllocateNode( MemoryBlock & block
+			, uint32_t order
+			, VkDeviceSize & offset );
+		void doDeallocateNode( MemoryBlock & block
+			, uint32_t order
+			, VkDeviceSize offset );
+
+	private:
+		Device const & m_device;
+		VkDeviceSize m_bufferImageGranularity;
+		VkDeviceSize m_nonCoherentAtomSize;
+		// Two pools per memory type: buffers first, then images.
+		std::vector< Pool > m_pools;
+		mutable std::mutex m_mutex;
+	};
+}
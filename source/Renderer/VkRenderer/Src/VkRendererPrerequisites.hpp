@@ -194,6 +194,7 @@ namespace vk_renderer
 	class DescriptorSetLayout;
 	class DescriptorSetLayoutBinding;
 	class Device;
+	class MemoryAllocator;
 	class Pipeline;
 	class PipelineLayout;
 	class PhysicalDevice;
@@ -219,6 +220,7 @@ namespace vk_renderer
 	using ConnectionPtr = std::unique_ptr< Connection >;
 	using CommandPoolPtr = std::unique_ptr< CommandPool >;
 	using ImageStoragePtr = std::unique_ptr< ImageStorage >;
+	using MemoryAllocatorPtr = std::unique_ptr< MemoryAllocator >;
 	using PhysicalDevicePtr = std::unique_ptr< PhysicalDevice >;
 	using QueuePtr = std::unique_ptr< Queue >;
 	using RenderSubpassPtr = std::unique_ptr< RenderSubpass >;
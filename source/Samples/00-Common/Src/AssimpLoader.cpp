@@ -1,5 +1,7 @@
 #include "AssimpLoader.hpp"
 
+#include "ImageLoader.hpp"
+
 #include <stdlib.h>
 #include <fstream>
 #include <sstream>
@@ -15,67 +17,66 @@ namespace common
 {
 	namespace
 	{
-		bool doLoadTexture( std::string const & folder
+		using ImageRequests = std::map< std::string, std::shared_future< ImagePtr > >;
+
+		void doRequestTexture( std::string const & folder
 			, aiString const & name
-			, ImagePtr & data
-			, std::map< std::string, ImagePtr > & images )
+			, ImageLoader & loader
+			, ImageRequests & requests )
 		{
-			bool result = false;
-			auto it = images.find( name.C_Str() );
-
-			if ( it != images.end() )
-			{
-				data = it->second;
-				return true;
-			}
-
-			if ( name.length > 0 )
+			if ( name.length > 0
+				&& requests.find( name.C_Str() ) == requests.end() )
 			{
-				folder;
-				std::string path = name.C_Str();
-				auto index = 0u;
-				utils::replace( path, R"(\)", "/" );
+				std::string path = utils::replace( name.C_Str(), R"(\)", "/" );
 
 				if ( path.find( '/' ) != std::string::npos )
 				{
-					index = path.find_last_of( '/' ) + 1;
-					path = path.substr( index );
+					path = path.substr( path.find_last_of( '/' ) + 1 );
 				}
 
 				std::clog << "  Loading texture " << path << std::endl;
 				path = folder / path;
-
-				try
-				{
-					data = std::make_shared< Image >( common::loadImage( path ) );
-					result = true;
-				}
-				catch ( std::runtime_error & )
-				{
-					utils::replace( path, ".tga", ".jpg" );
-					try
-					{
-						data = std::make_shared< Image >( common::loadImage( path ) );
-						result = true;
-					}
-					catch ( std::runtime_error & )
-					{
-						utils::replace( path, ".tga", ".png" );
-						try
-						{
-							data = std::make_shared< Image >( common::loadImage( path ) );
-							result = true;
-						}
-						catch ( std::runtime_error & )
+				requests.emplace( std::string{ name.C_Str() }
+					, loader.load( StringArray
 						{
-						}
-					}
-				}
+							path,
+							utils::replace( path, ".tga", ".jpg" ),
+							utils::replace( path, ".tga", ".png" )
+						} ) );
+			}
+		}
+
+		void doRequestTextures( std::string const & folder
+			, aiMaterial const & aiMaterial
+			, ImageLoader & loader
+			, ImageRequests & requests )
+		{
+			for ( auto type : { aiTextureType_DIFFUSE
+				, aiTextureType_SPECULAR
+				, aiTextureType_EMISSIVE
+				, aiTextureType_SHININESS
+				, aiTextureType_OPACITY
+				, aiTextureType_NORMALS } )
+			{
+				aiString name;
+				aiMaterial.Get( AI_MATKEY_TEXTURE( type, 0 ), name );
+				doRequestTexture( folder, name, loader, requests );
+			}
+		}
+
+		bool doLoadTexture( aiString const & name
+			, ImagePtr & data
+			, ImageRequests const & requests )
+		{
+			auto it = requests.find( name.C_Str() );
 
-				images.insert( { std::string{ name.C_Str() }, data } );
+			if ( it == requests.end() )
+			{
+				return false;
 			}
 
-			return result;
+			data = it->second.get();
+			return data != nullptr;
 		}
 
 		template< typename aiMeshType >
@@ -194,10 +195,9 @@ namespace common
 			}
 		}
 
-		void doProcessPassTextures( std::string const & folder
-			, Material & material
+		void doProcessPassTextures( Material & material
 			, aiMaterial const & aiMaterial
-			, std::map< std::string, ImagePtr > & images )
+			, ImageRequests const & images )
 		{
 			aiString ambTexName;
 			aiMaterial.Get( AI_MATKEY_TEXTURE( aiTextureType_AMBIENT, 0 ), ambTexName );
@@ -217,9 +217,8 @@ namespace common
 			aiMaterial.Get( AI_MATKEY_TEXTURE( aiTextureType_SHININESS, 0 ), shnTexName );
 			ImagePtr image;
 			auto index = 0u;
-			auto it = images.find( difTexName.C_Str() );
 
-			if ( doLoadTexture( folder, difTexName, image, images ) )
+			if ( doLoadTexture( difTexName, image, images ) )
 			{
 				material.textures.push_back( image );
 				material.data.textureOperators[index].diffuse = 1;
@@ -232,7 +231,7 @@ namespace common
 				++index;
 			}
 
-			if ( doLoadTexture( folder, spcTexName, image, images ) )
+			if ( doLoadTexture( spcTexName, image, images ) )
 			{
 				material.textures.push_back( image );
 				material.data.textureOperators[index].specular = 1;
@@ -245,21 +244,21 @@ namespace common
 				++index;
 			}
 
-			if ( doLoadTexture( folder, emiTexName, image, images ) )
+			if ( doLoadTexture( emiTexName, image, images ) )
 			{
 				material.textures.push_back( image );
 				material.data.textureOperators[index].emissive = 1;
 				++index;
 			}
 
-			if ( doLoadTexture( folder, shnTexName, image, images ) )
+			if ( doLoadTexture( shnTexName, image, images ) )
 			{
 				material.textures.push_back( image );
 				material.data.textureOperators[index].shininess = 1;
 				++index;
 			}
 
-			if ( doLoadTexture( folder, opaTexName, image, images ) )
+			if ( doLoadTexture( opaTexName, image, images ) )
 			{
 				material.textures.push_back( image );
 				material.hasOpacity = true;
@@ -276,7 +275,7 @@ namespace common
 				++index;
 			}
 
-			if ( doLoadTexture( folder, nmlTexName, image, images ) )
+			if ( doLoadTexture( nmlTexName, image, images ) )
 			{
 				material.textures.push_back( image );
 				material.data.textureOperators[index].normal = 1;
@@ -296,6 +295,8 @@ namespace common
 	Object loadObject( std::string const & folder
 		, std::string const & fileName
 		, common::ImagePtrArray & images
+		, renderer::Format format
+		, std::string const & cacheFolder
 		, float rescale )
 	{
 		Assimp::Importer importer;
@@ -324,7 +325,32 @@ namespace common
 				}
 			};
 
-			std::map< std::string, ImagePtr > uniqueImages;
+			ImageRequests uniqueImages;
+
+			{
+				// All the textures are decoded and compressed in parallel, before processing the materials.
+				ImageLoader loader{ format, cacheFolder };
+
+				for ( size_t meshIndex = 0; meshIndex < aiScene->mNumMeshes; ++meshIndex )
+				{
+					auto & aiMesh = *aiScene->mMeshes[meshIndex];
+
+					if ( aiMesh.HasFaces()
+						&& aiMesh.HasPositions()
+						&& aiMesh.mMaterialIndex < aiScene->mNumMaterials )
+					{
+						doRequestTextures( folder
+							, *aiScene->mMaterials[aiMesh.mMaterialIndex]
+							, loader
+							, uniqueImages );
+					}
+				}
+
+				for ( auto & request : uniqueImages )
+				{
+					request.second.wait();
+				}
+			}
 
 			for ( size_t meshIndex = 0; meshIndex < aiScene->mNumMeshes; ++meshIndex )
 			{
@@ -340,7 +366,7 @@ namespace common
 						aiMaterial.Get( AI_MATKEY_NAME, mtlname );
 						Material material;
 						doProcessPassBaseComponents( material, aiMaterial );
-						doProcessPassTextures( folder, material, aiMaterial, uniqueImages );
+						doProcessPassTextures( material, aiMaterial, uniqueImages );
 						submesh.materials.push_back( material );
 					}
 					else
@@ -407,7 +433,10 @@ namespace common
 
 			for ( auto & image : uniqueImages )
 			{
-				images.emplace_back( std::move( image.second ) );
+				if ( auto data = image.second.get() )
+				{
+					images.emplace_back( std::move( data ) );
+				}
 			}
 		}
 
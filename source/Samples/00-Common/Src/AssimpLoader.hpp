@@ -17,12 +17,18 @@ namespace common
 	*	Charge un objet.
 	*\param[in] filePath
 	*	Le chemin d'accès au fichier.
+	*\param[in] format
+	*	Le format compressé des textures (renderer::Format::eUndefined pour les garder en RGBA8).
+	*\param[in] cacheFolder
+	*	Le dossier du cache des textures compressées (vide pour ne pas utiliser de cache).
 	*\return
 	*	L'objet chargé.
 	*/
 	Object loadObject( std::string const & folder
 		, std::string const & fileName
 		, common::ImagePtrArray & images
+		, renderer::Format format = renderer::Format::eUndefined
+		, std::string const & cacheFolder = std::string{}
 		, float rescale = 8.0f );
 }
 
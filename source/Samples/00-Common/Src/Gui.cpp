@@ -95,67 +95,58 @@ namespace common
 			return;
 		}
 
-		bool updateCmdBuffers = false;
-		auto vertexBufferSize = uint32_t( imDrawData->TotalVtxCount );
+		auto vertexCount = std::max( 1u, uint32_t( imDrawData->TotalVtxCount ) );
 
-		if ( !m_vertexBuffer || m_vertexCount != vertexBufferSize )
+		if ( !m_vertexBuffer || m_vertexCount < vertexCount )
 		{
 			m_vertexBuffer.reset();
-			m_vertexCount = vertexBufferSize;
-			m_vertexBuffer = renderer::makeVertexBuffer< ImDrawVert >( m_device
-				, m_vertexCount
-				, renderer::BufferTargets{ 0u }
-				, renderer::MemoryPropertyFlag::eHostVisible );
-			updateCmdBuffers = true;
+			m_vertexCount = vertexCount;
+			m_vertexBuffer = std::make_unique< renderer::RingBuffer >( m_device
+				, renderer::BufferTarget::eVertexBuffer
+				, uint32_t( m_vertexCount * sizeof( ImDrawVert ) )
+				, 2u );
 		}
 
-		auto indexBufferSize = uint32_t( imDrawData->TotalIdxCount );
+		auto indexCount = std::max( 1u, uint32_t( imDrawData->TotalIdxCount ) );
 
-		if ( !m_indexBuffer || m_indexCount < indexBufferSize )
+		if ( !m_indexBuffer || m_indexCount < indexCount )
 		{
 			m_indexBuffer.reset();
-			m_indexCount = indexBufferSize;
-			m_indexBuffer = renderer::makeBuffer< ImDrawIdx >( m_device
-				, m_indexCount
+			m_indexCount = indexCount;
+			m_indexBuffer = std::make_unique< renderer::RingBuffer >( m_device
 				, renderer::BufferTarget::eIndexBuffer
-				, renderer::MemoryPropertyFlag::eHostVisible );
-			updateCmdBuffers = true;
+				, uint32_t( m_indexCount * sizeof( ImDrawIdx ) )
+				, 2u );
 		}
 
-		if ( auto vtx = m_vertexBuffer->lock( 0u
-			, m_vertexCount
-			, renderer::MemoryMapFlag::eInvalidateRange | renderer::MemoryMapFlag::eWrite ) )
-		{
-			for ( int n = 0; n < imDrawData->CmdListsCount; n++ )
-			{
-				const ImDrawList * cmdList = imDrawData->CmdLists[n];
-				memcpy( vtx, cmdList->VtxBuffer.Data, cmdList->VtxBuffer.Size * sizeof( ImDrawVert ) );
-				vtx += cmdList->VtxBuffer.Size;
-			}
+		// One allocation per frame and per ring buffer, so the offsets only take one value per frame region.
+		m_vertexBuffer->beginFrame();
+		m_indexBuffer->beginFrame();
+		auto vertices = m_vertexBuffer->allocate( uint32_t( vertexCount * sizeof( ImDrawVert ) ) );
+		auto indices = m_indexBuffer->allocate( uint32_t( indexCount * sizeof( ImDrawIdx ) ) );
 
-			m_vertexBuffer->flush( 0u, m_vertexCount );
-			m_vertexBuffer->unlock();
-		}
-
-		if ( auto idx = m_indexBuffer->lock( 0u
-			, m_indexCount
-			, renderer::MemoryMapFlag::eInvalidateRange | renderer::MemoryMapFlag::eWrite ) )
+		if ( vertices.data && indices.data )
 		{
+			auto vtx = vertices.data;
+			auto idx = indices.data;
+
 			for ( int n = 0; n < imDrawData->CmdListsCount; n++ )
 			{
 				const ImDrawList * cmdList = imDrawData->CmdLists[n];
+				memcpy( vtx, cmdList->VtxBuffer.Data, cmdList->VtxBuffer.Size * sizeof( ImDrawVert ) );
 				memcpy( idx, cmdList->IdxBuffer.Data, cmdList->IdxBuffer.Size * sizeof( ImDrawIdx ) );
-				idx += cmdList->IdxBuffer.Size;
+				vtx += cmdList->VtxBuffer.Size * sizeof( ImDrawVert );
+				idx += cmdList->IdxBuffer.Size * sizeof( ImDrawIdx );
 			}
 
-			m_indexBuffer->flush( 0u, m_indexCount );
-			m_indexBuffer->unlock();
+			m_vertexOffset = vertices.offset;
+			m_indexOffset = indices.offset;
 		}
 
-		if ( updateCmdBuffers )
-		{
-			doUpdateCommandBuffers();
-		}
+		m_vertexBuffer->endFrame();
+		m_indexBuffer->endFrame();
+		// The ranges move from one frame to the other.
+		doUpdateCommandBuffers();
 	}
 
 	void Gui::resize( renderer::Extent2D const & size )
@@ -433,8 +424,8 @@ namespace common
 		m_commandBuffer->bindPipeline( *m_pipeline );
 		m_commandBuffer->bindDescriptorSet( *m_descriptorSet
 			, *m_pipelineLayout );
-		m_commandBuffer->bindVertexBuffer( 0u, m_vertexBuffer->getBuffer(), 0u );
-		m_commandBuffer->bindIndexBuffer( m_indexBuffer->getBuffer(), 0u, renderer::IndexType::eUInt16 );
+		m_commandBuffer->bindVertexBuffer( 0u, m_vertexBuffer->getBuffer(), m_vertexOffset );
+		m_commandBuffer->bindIndexBuffer( m_indexBuffer->getBuffer(), m_indexOffset, renderer::IndexType::eUInt16 );
 		m_commandBuffer->setViewport( { uint32_t( ImGui::GetIO().DisplaySize.x )
 			, uint32_t( ImGui::GetIO().DisplaySize.y )
 			, 0
@@ -4,6 +4,7 @@
 #include "imgui.h"
 
 #include <Buffer/PushConstantsBuffer.hpp>
+#include <Buffer/RingBuffer.hpp>
 #include <Image/Sampler.hpp>
 
 namespace common
@@ -49,8 +50,10 @@ namespace common
 		renderer::TextureView const * m_colourView{ nullptr };
 		renderer::Extent2D m_size;
 		renderer::PushConstantsBuffer< PushConstBlock > m_pushConstants;
-		renderer::VertexBufferPtr< ImDrawVert > m_vertexBuffer;
-		renderer::BufferPtr< ImDrawIdx > m_indexBuffer;
+		renderer::RingBufferPtr m_vertexBuffer;
+		renderer::RingBufferPtr m_indexBuffer;
+		uint32_t m_vertexOffset = 0;
+		uint32_t m_indexOffset = 0;
 		renderer::TexturePtr m_target;
 		renderer::TextureViewPtr m_targetView;
 		uint32_t m_vertexCount = 0;
@@ -0,0 +1,139 @@
+#include "ImageLoader.hpp"
+
+#include <MipGenerator.hpp>
+#include <TextureCompressor.hpp>
+
+#include <algorithm>
+
+namespace common
+{
+	void generateMipmaps( Image & image )
+	{
+		assert( image.format == renderer::Format::eR8G8B8A8_UNORM );
+		// Called from the loader workers, which already keep all the cores busy.
+		auto chain = utils::generateMipmaps( image.format
+			, image.size
+			, image.data.data()
+			, utils::MipFilter::eBox
+			, 1u );
+		image.data = std::move( chain.data );
+		image.mipLevels = uint32_t( chain.levels.size() );
+	}
+
+	void compressMipmaps( Image & image
+		, renderer::Format format
+		, std::string const & cacheFolder )
+	{
+		assert( image.format == renderer::Format::eR8G8B8A8_UNORM );
+		// Called from the loader workers, which already keep all the cores busy.
+		auto chain = utils::compressMipmaps( utils::MipChain
+			{
+				image.format,
+				utils::getMipLevels( image.format, image.size, image.mipLevels ),
+				std::move( image.data )
+			}
+			, format
+			, cacheFolder
+			, 1u );
+		image.format = chain.format;
+		image.data = std::move( chain.data );
+	}
+
+	ImageLoader::ImageLoader( renderer::Format format
+		, std::string cacheFolder
+		, uint32_t threadCount )
+		: m_format{ format }
+		, m_cacheFolder{ std::move( cacheFolder ) }
+	{
+		if ( !threadCount )
+		{
+			threadCount = std::max( 1u, std::thread::hardware_concurrency() );
+		}
+
+		for ( uint32_t i = 0u; i < threadCount; ++i )
+		{
+			m_threads.emplace_back( [this]()
+			{
+				doRun();
+			} );
+		}
+	}
+
+	ImageLoader::~ImageLoader()
+	{
+		{
+			std::unique_lock< std::mutex > lock{ m_mutex };
+			m_stopped = true;
+		}
+
+		m_condition.notify_all();
+
+		for ( auto & thread : m_threads )
+		{
+			thread.join();
+		}
+	}
+
+	std::shared_future< ImagePtr > ImageLoader::load( StringArray paths )
+	{
+		std::packaged_task< ImagePtr() > job{ [paths, format = m_format, cacheFolder = m_cacheFolder]()
+		{
+			for ( auto & path : paths )
+			{
+				try
+				{
+					auto result = std::make_shared< Image >( loadImage( path ) );
+					generateMipmaps( *result );
+
+					if ( format != renderer::Format::eUndefined )
+					{
+						compressMipmaps( *result, format, cacheFolder );
+					}
+
+					return result;
+				}
+				catch ( std::runtime_error & )
+				{
+				}
+			}
+
+			return ImagePtr{};
+		} };
+		auto result = job.get_future().share();
+
+		{
+			std::unique_lock< std::mutex > lock{ m_mutex };
+			m_jobs.push_back( std::move( job ) );
+		}
+
+		m_condition.notify_one();
+		return result;
+	}
+
+	void ImageLoader::doRun()
+	{
+		while ( true )
+		{
+			std::packaged_task< ImagePtr() > job;
+
+			{
+				std::unique_lock< std::mutex > lock{ m_mutex };
+				m_condition.wait( lock
+					, [this]()
+					{
+						return m_stopped || !m_jobs.empty();
+					} );
+
+				if ( m_stopped )
+				{
+					return;
+				}
+
+				job = std::move( m_jobs.front() );
+				m_jobs.pop_front();
+			}
+
+			job();
+		}
+	}
+}
@@ -0,0 +1,137 @@
+/*
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "FileUtils.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+
+namespace common
+{
+	/**
+	*\~english
+	*\brief
+	*	Generates the mip levels of an RGBA8 image, using a box filter.
+	*\remarks
+	*	The levels are appended to the image data, after the first one.
+	*\param[in,out] image
+	*	The image, holding only its first level.
+	*\~french
+	*\brief
+	*	Génère les niveaux de mip d'une image RGBA8, en utilisant un filtre boîte.
+	*\remarks
+	*	Les niveaux sont ajoutés aux données de l'image, après le premier.
+	*\param[in,out] image
+	*	L'image, ne contenant que son premier niveau.
+	*/
+	void generateMipmaps( Image & image );
+	/**
+	*\~english
+	*\brief
+	*	Block compresses the mip chain of an RGBA8 image, or reads it from the cache.
+	*\param[in,out] image
+	*	The image, holding all its levels.
+	*\param[in] format
+	*	The compressed format.
+	*\param[in] cacheFolder
+	*	The folder of the compressed textures cache (empty to disable the cache).
+	*\~french
+	*\brief
+	*	Compresse par blocs la chaîne de mips d'une image RGBA8, ou la lit depuis le cache.
+	*\param[in,out] image
+	*	L'image, contenant tous ses niveaux.
+	*\param[in] format
+	*	Le format compressé.
+	*\param[in] cacheFolder
+	*	Le dossier du cache des textures compressées (vide pour ne pas utiliser de cache).
+	*/
+	void compressMipmaps( Image & image
+		, renderer::Format format
+		, std::string const & cacheFolder );
+	/**
+	*\~english
+	*\brief
+	*	Decodes images and builds their mip chain, on worker threads.
+	*\remarks
+	*	When a compressed format is given, the chains are also compressed by the workers.
+	*\~french
+	*\brief
+	*	Décode des images et construit leur chaîne de mips, sur des threads de travail.
+	*\remarks
+	*	Quand un format compressé est donné, les chaînes sont aussi compressées par les threads de travail.
+	*/
+	class ImageLoader
+	{
+	public:
+		/**
+		*\~english
+		*\brief
+		*	Constructor, starts the worker threads.
+		*\param[in] format
+		*	The compressed format of the loaded images (renderer::Format::eUndefined to keep them in RGBA8).
+		*\param[in] cacheFolder
+		*	The folder of the compressed textures cache (empty to disable the cache).
+		*\param[in] threadCount
+		*	The number of worker threads (0 to use the hardware concurrency).
+		*\~french
+		*\brief
+		*	Constructeur, démarre les threads de travail.
+		*\param[in] format
+		*	Le format compressé des images chargées (renderer::Format::eUndefined pour les garder en RGBA8).
+		*\param[in] cacheFolder
+		*	Le dossier du cache des textures compressées (vide pour ne pas utiliser de cache).
+		*\param[in] threadCount
+		*	Le nombre de threads de travail (0 pour utiliser la concurrence matérielle).
+		*/
+		explicit ImageLoader( renderer::Format format = renderer::Format::eUndefined
+			, std::string cacheFolder = std::string{}
+			, uint32_t threadCount = 0u );
+		/**
+		*\~english
+		*\brief
+		*	Destructor, stops the worker threads.
+		*\remarks
+		*	The loads which haven't started yet are abandoned.
+		*\~french
+		*\brief
+		*	Destructeur, arrête les threads de travail.
+		*\remarks
+		*	Les chargements non démarrés sont abandonnés.
+		*/
+		~ImageLoader();
+		/**
+		*\~english
+		*\brief
+		*	Queues the load of an image.
+		*\param[in] paths
+		*	The candidate file paths, the first one that can be loaded is used.
+		*\return
+		*	The loaded image, null if none of the paths could be loaded.
+		*\~french
+		*\brief
+		*	Met en file le chargement d'une image.
+		*\param[in] paths
+		*	Les chemins candidats, le premier pouvant être chargé est utilisé.
+		*\return
+		*	L'image chargée, nulle si aucun des chemins n'a pu être chargé.
+		*/
+		std::shared_future< ImagePtr > load( StringArray paths );
+
+	private:
+		void doRun();
+
+	private:
+		renderer::Format m_format;
+		std::string m_cacheFolder;
+		std::vector< std::thread > m_threads;
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::deque< std::packaged_task< ImagePtr() > > m_jobs;
+		bool m_stopped{ false };
+	};
+}
@@ -5,7 +5,7 @@
 #include "Scene.hpp"
 
 #include <Buffer/Buffer.hpp>
-#include <Buffer/StagingBuffer.hpp>
+#include <Buffer/UploadBatcher.hpp>
 #include <Buffer/VertexBuffer.hpp>
 #include <Command/CommandBuffer.hpp>
 #include <Command/CommandPool.hpp>
@@ -39,6 +39,31 @@ namespace common
 {
 	namespace
 	{
+		template< typename NodeType >
+		bool doUpdateTextures( MaterialNode< NodeType > & node )
+		{
+			bool result = false;
+
+			for ( uint32_t index = 0u; index < node.textures.size(); ++index )
+			{
+				auto & view = getView( *node.textures[index] );
+				auto & info = node.descriptorSetTextures->getBinding( index ).imageInfo[0];
+
+				if ( &info.imageView.value().get() != &view )
+				{
+					info.imageView = std::ref( view );
+					result = true;
+				}
+			}
+
+			if ( result )
+			{
+				node.descriptorSetTextures->update();
+			}
+
+			return result;
+		}
+
 		std::vector< renderer::ShaderStageState > doCreateObjectProgram( renderer::Device const & device
 			, std::string const & fragmentShaderFile )
 		{
@@ -212,7 +237,6 @@ namespace common
 			, renderer::WrapMode::eClampToEdge
 			, renderer::Filter::eLinear
 			, renderer::Filter::eLinear ) }
-		, m_updateCommandBuffer{ m_device.getGraphicsCommandPool().createCommandBuffer() }
 		, m_commandBuffer{ m_device.getGraphicsCommandPool().createCommandBuffer() }
 		, m_renderPass{ doCreateRenderPass( m_device, formats, clearViews ) }
 		, m_queryPool{ m_device.createQueryPool( renderer::QueryType::eTimestamp, 2u, 0u ) }
@@ -236,8 +260,29 @@ namespace common
 		gpu = std::chrono::nanoseconds{ uint64_t( ( values[1] - values[0] ) / float( m_device.getTimestampPeriod() ) ) };
 	}
 
+	void NodesRenderer::updateTextures()
+	{
+		bool changed = false;
+
+		for ( auto & node : m_submeshRenderNodes )
+		{
+			changed = doUpdateTextures( node ) || changed;
+		}
+
+		for ( auto & node : m_billboardRenderNodes )
+		{
+			changed = doUpdateTextures( node ) || changed;
+		}
+
+		// The descriptor sets bound by the command buffer have changed, it must be recorded again.
+		if ( changed && m_frameBuffer )
+		{
+			doRecordCommandBuffer();
+		}
+	}
+
 	void NodesRenderer::initialise( Scene const & scene
-		, renderer::StagingBuffer & stagingBuffer
+		, renderer::UploadBatcher & uploader
 		, renderer::TextureViewCRefArray const & views
 		, common::TextureNodePtrArray const & textureNodes )
 	{
@@ -249,18 +294,17 @@ namespace common
 
 		uint32_t matIndex = 0u;
 		doInitialiseObject( scene.object
-			, stagingBuffer
+			, uploader
 			, textureNodes
 			, matIndex );
 		doInitialiseBillboard( scene.billboard
-			, stagingBuffer
+			, uploader
 			, textureNodes
 			, matIndex );
 
 		if ( m_objectsCount || m_billboardsCount )
 		{
-			stagingBuffer.uploadUniformData( *m_updateCommandBuffer
-				, m_materialsUbo->getDatas()
+			uploader.uploadUniformData( m_materialsUbo->getDatas()
 				, *m_materialsUbo
 				, renderer::PipelineStageFlag::eFragmentShader );
 		}
@@ -277,89 +321,98 @@ namespace common
 		{
 			m_size = size;
 			m_views.clear();
-			static renderer::ClearColorValue const colour{ 1.0f, 0.8f, 0.4f, 0.0f };
-			static renderer::DepthStencilClearValue const depth{ 1.0, 0 };
-			renderer::ClearValueArray clearValues;
 
 			for ( auto & view : views )
 			{
 				m_views.push_back( &view.get() );
-
-				if ( !renderer::isDepthOrStencilFormat( view.get().getFormat() ) )
-				{
-					clearValues.emplace_back( colour );
-				}
-				else
-				{
-					clearValues.emplace_back( depth );
-				}
 			}
 
 			m_frameBuffer = doCreateFrameBuffer( *m_renderPass, views );
-			m_commandBuffer->reset();
-			auto & commandBuffer = *m_commandBuffer;
-
-			commandBuffer.begin( renderer::CommandBufferUsageFlag::eSimultaneousUse );
-			commandBuffer.resetQueryPool( *m_queryPool, 0u, 2u );
-			commandBuffer.writeTimestamp( renderer::PipelineStageFlag::eTopOfPipe
-				, *m_queryPool
-				, 0u );
-			commandBuffer.beginRenderPass( *m_renderPass
-				, *m_frameBuffer
-				, clearValues
-				, renderer::SubpassContents::eInline );
-
-			for ( auto & node : m_submeshRenderNodes )
+			doRecordCommandBuffer();
+		}
+	}
+
+	void NodesRenderer::doRecordCommandBuffer()
+	{
+		static renderer::ClearColorValue const colour{ 1.0f, 0.8f, 0.4f, 0.0f };
+		static renderer::DepthStencilClearValue const depth{ 1.0, 0 };
+		renderer::ClearValueArray clearValues;
+
+		for ( auto & view : m_views )
+		{
+			if ( !renderer::isDepthOrStencilFormat( view->getFormat() ) )
 			{
-				commandBuffer.bindPipeline( *node.pipeline );
-				commandBuffer.setViewport( { size.width
-					, size.height
-					, 0
-					, 0 } );
-				commandBuffer.setScissor( { 0
-					, 0
-					, size.width
-					, size.height } );
-				m_commandBuffer->bindVertexBuffer( 0u, node.instance->vbo->getBuffer(), 0u );
-				m_commandBuffer->bindIndexBuffer( node.instance->ibo->getBuffer(), 0u, renderer::IndexType::eUInt32 );
-				commandBuffer.bindDescriptorSet( *node.descriptorSetUbos
-					, *node.pipelineLayout );
-				commandBuffer.bindDescriptorSet( *node.descriptorSetTextures
-					, *node.pipelineLayout );
-				commandBuffer.drawIndexed( node.instance->ibo->getCount() * 3u );
+				clearValues.emplace_back( colour );
 			}
-
-			for ( BillboardMaterialNode & node : m_billboardRenderNodes )
+			else
 			{
-				commandBuffer.bindPipeline( *node.pipeline );
-				commandBuffer.setViewport( { size.width
-					, size.height
-					, 0
-					, 0 } );
-				commandBuffer.setScissor( { 0
-					, 0
-					, size.width
-					, size.height } );
-				m_commandBuffer->bindVertexBuffers( 0u
-					, { node.instance->vbo->getBuffer(), node.instance->instance->getBuffer() }
-					, { 0u, 0u } );
-				commandBuffer.bindDescriptorSet( *node.descriptorSetUbos
-					, *node.pipelineLayout );
-				commandBuffer.bindDescriptorSet( *node.descriptorSetTextures
-					, *node.pipelineLayout );
-				commandBuffer.draw( 4u, node.instance->instance->getCount() );
+				clearValues.emplace_back( depth );
 			}
+		}
+
+		m_commandBuffer->reset();
+		auto & commandBuffer = *m_commandBuffer;
+
+		commandBuffer.begin( renderer::CommandBufferUsageFlag::eSimultaneousUse );
+		commandBuffer.resetQueryPool( *m_queryPool, 0u, 2u );
+		commandBuffer.writeTimestamp( renderer::PipelineStageFlag::eTopOfPipe
+			, *m_queryPool
+			, 0u );
+		commandBuffer.beginRenderPass( *m_renderPass
+			, *m_frameBuffer
+			, clearValues
+			, renderer::SubpassContents::eInline );
 
-			commandBuffer.endRenderPass();
-			commandBuffer.writeTimestamp( renderer::PipelineStageFlag::eBottomOfPipe
-				, *m_queryPool
-				, 1u );
-			commandBuffer.end();
+		for ( auto & node : m_submeshRenderNodes )
+		{
+			commandBuffer.bindPipeline( *node.pipeline );
+			commandBuffer.setViewport( { m_size.width
+				, m_size.height
+				, 0
+				, 0 } );
+			commandBuffer.setScissor( { 0
+				, 0
+				, m_size.width
+				, m_size.height } );
+			m_commandBuffer->bindVertexBuffer( 0u, node.instance->vbo->getBuffer(), 0u );
+			m_commandBuffer->bindIndexBuffer( node.instance->ibo->getBuffer(), 0u, renderer::IndexType::eUInt32 );
+			commandBuffer.bindDescriptorSet( *node.descriptorSetUbos
+				, *node.pipelineLayout );
+			commandBuffer.bindDescriptorSet( *node.descriptorSetTextures
+				, *node.pipelineLayout );
+			commandBuffer.drawIndexed( node.instance->ibo->getCount() * 3u );
 		}
+
+		for ( BillboardMaterialNode & node : m_billboardRenderNodes )
+		{
+			commandBuffer.bindPipeline( *node.pipeline );
+			commandBuffer.setViewport( { m_size.width
+				, m_size.height
+				, 0
+				, 0 } );
+			commandBuffer.setScissor( { 0
+				, 0
+				, m_size.width
+				, m_size.height } );
+			m_commandBuffer->bindVertexBuffers( 0u
+				, { node.instance->vbo->getBuffer(), node.instance->instance->getBuffer() }
+				, { 0u, 0u } );
+			commandBuffer.bindDescriptorSet( *node.descriptorSetUbos
+				, *node.pipelineLayout );
+			commandBuffer.bindDescriptorSet( *node.descriptorSetTextures
+				, *node.pipelineLayout );
+			commandBuffer.draw( 4u, node.instance->instance->getCount() );
+		}
+
+		commandBuffer.endRenderPass();
+		commandBuffer.writeTimestamp( renderer::PipelineStageFlag::eBottomOfPipe
+			, *m_queryPool
+			, 1u );
+		commandBuffer.end();
 	}
 
 	void NodesRenderer::doInitialiseBillboard( Billboard const & billboard
-		, renderer::StagingBuffer & stagingBuffer
+		, renderer::UploadBatcher & uploader
 		, TextureNodePtrArray const & textureNodes
 		, uint32_t & matIndex )
 	{
@@ -402,15 +455,13 @@ namespace common
 					, uint32_t( vertexData.size() )
 					, renderer::BufferTarget::eTransferDst
 					, renderer::MemoryPropertyFlag::eDeviceLocal );
-				stagingBuffer.uploadVertexData( *m_updateCommandBuffer
-					, vertexData
+				uploader.uploadVertexData( vertexData
 					, *billboardNode->vbo );
 				billboardNode->instance = renderer::makeVertexBuffer< BillboardInstanceData >( m_device
 					, uint32_t( billboard.list.size() )
 					, renderer::BufferTarget::eTransferDst
 					, renderer::MemoryPropertyFlag::eDeviceLocal );
-				stagingBuffer.uploadVertexData( *m_updateCommandBuffer
-					, billboard.list
+				uploader.uploadVertexData( billboard.list
 					, *billboardNode->instance );
 
 				auto & material = billboard.material;
@@ -451,7 +502,7 @@ namespace common
 				for ( uint32_t index = 0u; index < material.data.texturesCount; ++index )
 				{
 					materialNode.descriptorSetTextures->createBinding( materialNode.layout->getBinding( 0u, index )
-						, *materialNode.textures[index]->view
+						, getView( *materialNode.textures[index] )
 						, *m_sampler
 						, renderer::ImageLayout::eShaderReadOnlyOptimal
 						, index );
@@ -506,7 +557,7 @@ namespace common
 	}
 
 	void NodesRenderer::doInitialiseObject( Object const & object
-		, renderer::StagingBuffer & stagingBuffer
+		, renderer::UploadBatcher & uploader
 		, common::TextureNodePtrArray const & textureNodes
 		, uint32_t & matIndex )
 	{
@@ -548,15 +599,13 @@ namespace common
 					, uint32_t( submesh.vbo.data.size() )
 					, renderer::BufferTarget::eTransferDst
 					, renderer::MemoryPropertyFlag::eDeviceLocal );
-				stagingBuffer.uploadVertexData( *m_updateCommandBuffer
-					, submesh.vbo.data
+				uploader.uploadVertexData( submesh.vbo.data
 					, *submeshNode->vbo );
 				submeshNode->ibo = renderer::makeBuffer< common::Face >( m_device
 					, uint32_t( submesh.ibo.data.size() )
 					, renderer::BufferTarget::eIndexBuffer | renderer::BufferTarget::eTransferDst
 					, renderer::MemoryPropertyFlag::eDeviceLocal );
-				stagingBuffer.uploadBufferData( *m_updateCommandBuffer
-					, submesh.ibo.data
+				uploader.uploadBufferData( submesh.ibo.data
 					, *submeshNode->ibo );
 
 				for ( auto & material : compatibleMaterials )
@@ -598,7 +647,7 @@ namespace common
 					for ( uint32_t index = 0u; index < material.data.texturesCount; ++index )
 					{
 						materialNode.descriptorSetTextures->createBinding( materialNode.layout->getBinding( 0u, index )
-							, *materialNode.textures[index]->view
+							, getView( *materialNode.textures[index] )
 							, *m_sampler
 							, renderer::ImageLayout::eShaderReadOnlyOptimal
 							, index );
@@ -29,8 +29,9 @@ namespace common
 		virtual ~NodesRenderer() = default;
 		virtual void update( RenderTarget const & target );
 		void draw( std::chrono::nanoseconds & gpu )const;
+		void updateTextures();
 		void initialise( Scene const & scene
-			, renderer::StagingBuffer & stagingBuffer
+			, renderer::UploadBatcher & uploader
 			, renderer::TextureViewCRefArray const & views
 			, TextureNodePtrArray const & textureNodes );
 
@@ -41,14 +42,15 @@ namespace common
 
 	protected:
 		void doUpdate( renderer::TextureViewCRefArray const & views );
+		void doRecordCommandBuffer();
 
 	private:
 		void doInitialiseObject( Object const & object
-			, renderer::StagingBuffer & stagingBuffer
+			, renderer::UploadBatcher & uploader
 			, TextureNodePtrArray const & textureNodes
 			, uint32_t & matIndex );
 		void doInitialiseBillboard( Billboard const & billboard
-			, renderer::StagingBuffer & stagingBuffer
+			, renderer::UploadBatcher & uploader
 			, TextureNodePtrArray const & textureNodes
 			, uint32_t & matIndex );
 
@@ -77,7 +79,6 @@ namespace common
 		std::string m_fragmentShaderFile;
 		std::vector< renderer::TextureView const * > m_views;
 		renderer::SamplerPtr m_sampler;
-		renderer::CommandBufferPtr m_updateCommandBuffer;
 		renderer::CommandBufferPtr m_commandBuffer;
 		renderer::UniformBufferPtr< MaterialData > m_materialsUbo;
 
@@ -9,12 +9,13 @@ namespace common
 	public:
 		OpaqueRendering( NodesRendererPtr && renderer
 			, Scene const & scene
-			, renderer::StagingBuffer & stagingBuffer
+			, renderer::UploadBatcher & uploader
 			, renderer::TextureViewCRefArray const & views
 			, common::TextureNodePtrArray const & textureNodes );
 		virtual ~OpaqueRendering() = default;
 		virtual void update( RenderTarget const & target );
 		virtual void draw( std::chrono::nanoseconds & gpu )const;
+		void updateTextures();
 
 	protected:
 		NodesRendererPtr m_renderer;
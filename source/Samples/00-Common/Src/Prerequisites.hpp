@@ -68,9 +68,11 @@ namespace common
 	struct Image
 	{
 		renderer::Extent2D size;
+		// The mip levels, one after the other, from the biggest one.
 		renderer::ByteArray data;
 		renderer::Format format;
 		bool opacity{ false };
+		uint32_t mipLevels{ 1u };
 	};
 
 	using ImagePtr = std::shared_ptr< Image >;
@@ -201,12 +203,23 @@ namespace common
 	{
 		ImagePtr image;
 		renderer::TexturePtr texture;
+		// The view on the resident mip levels, null until one is resident.
 		renderer::TextureViewPtr view;
+		// The view sampled until a mip level is resident.
+		renderer::TextureView const * placeholder{ nullptr };
 	};
 
 	using TextureNodePtr = std::shared_ptr< TextureNode >;
 	using TextureNodePtrArray = std::vector< TextureNodePtr >;
 
+	inline renderer::TextureView const & getView( TextureNode const & node )
+	{
+		assert( node.view || node.placeholder );
+		return node.view
+			? *node.view
+			: *node.placeholder;
+	}
+
 	template< typename NodeType >
 	struct MaterialNode
 	{
@@ -257,9 +270,11 @@ namespace common
 	class OpaqueRendering;
 	class RenderPanel;
 	class RenderTarget;
+	class TextureStreamer;
 	class TransparentRendering;
 
 	using NodesRendererPtr = std::unique_ptr< NodesRenderer >;
 	using OpaqueRenderingPtr = std::unique_ptr< OpaqueRendering >;
+	using TextureStreamerPtr = std::unique_ptr< TextureStreamer >;
 	using TransparentRenderingPtr = std::unique_ptr< TransparentRendering >;
 }
@@ -1,10 +1,12 @@
 #include "RenderTarget.hpp"
 
 #include "OpaqueRendering.hpp"
+#include "TextureStreamer.hpp"
 #include "TransparentRendering.hpp"
 
 #include <Buffer/StagingBuffer.hpp>
 #include <Buffer/UniformBuffer.hpp>
+#include <Buffer/UploadBatcher.hpp>
 #include <Command/Queue.hpp>
 #include <Descriptor/DescriptorSet.hpp>
 #include <Descriptor/DescriptorSetLayout.hpp>
@@ -78,6 +80,13 @@ namespace common
 
 	void RenderTarget::update( std::chrono::microseconds const & duration )
 	{
+		// The previous frame is done, the textures descriptors can be updated.
+		if ( m_streamer->update() )
+		{
+			m_opaque->updateTextures();
+			m_transparent->updateTextures();
+		}
+
 		doUpdate( duration );
 	}
 
@@ -93,21 +102,24 @@ namespace common
 	void RenderTarget::doInitialise()
 	{
 		m_opaque = doCreateOpaqueRendering( m_device
-			, *m_stagingBuffer
+			, *m_uploader
 			, { *m_depthView, *m_colourView }
 			, m_scene
 			, m_textureNodes );
 		m_transparent = doCreateTransparentRendering( m_device
-			, *m_stagingBuffer
+			, *m_uploader
 			, { *m_depthView, *m_colourView }
 			, m_scene
 			, m_textureNodes );
+		m_uploader->waitAll();
 	}
 
 	void RenderTarget::doCleanup()
 	{
 		m_updateCommandBuffer.reset();
 
+		m_streamer.reset();
+		m_uploader.reset();
 		m_stagingBuffer.reset();
 
 		m_transparent.reset();
@@ -127,38 +139,18 @@ namespace common
 		m_stagingBuffer = std::make_unique< renderer::StagingBuffer >( m_device
 			, 0u
 			, 200u * 1024u * 1024u );
+		m_uploader = std::make_unique< renderer::UploadBatcher >( m_device );
 	}
 
 	void RenderTarget::doCreateTextures()
 	{
+		// The textures are sampled through a placeholder, until their levels are streamed in.
+		m_streamer = std::make_unique< TextureStreamer >( m_device
+			, *m_uploader );
+
 		for ( auto & image : m_images )
 		{
-			common::TextureNodePtr textureNode = std::make_shared< common::TextureNode >();
-			textureNode->image = image;
-			textureNode->texture = m_device.createTexture(
-				{
-					0u,
-					renderer::TextureType::e2D,
-					image->format,
-					renderer::Extent3D{ image->size.width, image->size.height, 1u },
-					4u,
-					1u,
-					renderer::SampleCountFlag::e1,
-					renderer::ImageTiling::eOptimal,
-					renderer::ImageUsageFlag::eTransferSrc | renderer::ImageUsageFlag::eTransferDst | renderer::ImageUsageFlag::eSampled
-				}
-				, renderer::MemoryPropertyFlag::eDeviceLocal );
-			textureNode->view = textureNode->texture->createView( renderer::TextureViewType( textureNode->texture->getType() )
-				, textureNode->texture->getFormat()
-				, 0u
-				, 4u );
-			auto view = textureNode->texture->createView( renderer::TextureViewType( textureNode->texture->getType() )
-				, textureNode->texture->getFormat() );
-			m_stagingBuffer->uploadTextureData( *m_updateCommandBuffer
-				, image->data
-				, *view );
-			textureNode->texture->generateMipmaps();
-			m_textureNodes.emplace_back( textureNode );
+			m_textureNodes.emplace_back( m_streamer->add( image ) );
 		}
 	}
 
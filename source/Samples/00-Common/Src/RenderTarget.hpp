@@ -55,12 +55,12 @@ namespace common
 		virtual void doResize( renderer::Extent2D const & size ) = 0;
 
 		virtual OpaqueRenderingPtr doCreateOpaqueRendering( renderer::Device const & device
-			, renderer::StagingBuffer & stagingBuffer
+			, renderer::UploadBatcher & uploader
 			, renderer::TextureViewCRefArray const & views
 			, Scene const & scene
 			, TextureNodePtrArray const & textureNodes ) = 0;
 		virtual TransparentRenderingPtr doCreateTransparentRendering( renderer::Device const & device
-			, renderer::StagingBuffer & stagingBuffer
+			, renderer::UploadBatcher & uploader
 			, renderer::TextureViewCRefArray const & views
 			, Scene const & scene
 			, TextureNodePtrArray const & textureNodes ) = 0;
@@ -68,12 +68,14 @@ namespace common
 	protected:
 		renderer::Device const & m_device;
 		renderer::StagingBufferPtr m_stagingBuffer;
+		renderer::UploadBatcherPtr m_uploader;
 		renderer::CommandBufferPtr m_updateCommandBuffer;
 		renderer::Extent2D m_size;
 
 	private:
 		ImagePtrArray m_images;
 		Scene m_scene;
+		TextureStreamerPtr m_streamer;
 		TextureNodePtrArray m_textureNodes;
 		utils::Mat4 m_rotate;
 		renderer::TexturePtr m_colour;
@@ -0,0 +1,176 @@
+#include "TextureStreamer.hpp"
+
+#include "ImageLoader.hpp"
+
+#include <Core/Device.hpp>
+#include <Image/Texture.hpp>
+#include <Image/TextureView.hpp>
+
+#include <MipGenerator.hpp>
+
+#include <algorithm>
+
+namespace common
+{
+	namespace
+	{
+		renderer::TexturePtr doCreateTexture( renderer::Device const & device
+			, renderer::Format format
+			, renderer::Extent2D const & size
+			, uint32_t mipLevels )
+		{
+			return device.createTexture(
+				{
+					0u,
+					renderer::TextureType::e2D,
+					format,
+					renderer::Extent3D{ size.width, size.height, 1u },
+					mipLevels,
+					1u,
+					renderer::SampleCountFlag::e1,
+					renderer::ImageTiling::eOptimal,
+					renderer::ImageUsageFlag::eTransferDst | renderer::ImageUsageFlag::eSampled
+				}
+				, renderer::MemoryPropertyFlag::eDeviceLocal );
+		}
+	}
+
+	TextureStreamer::TextureStreamer( renderer::Device const & device
+		, renderer::UploadBatcher & uploader
+		, uint32_t budget )
+		: m_device{ device }
+		, m_uploader{ uploader }
+		, m_budget{ budget }
+		, m_placeholder{ doCreateTexture( device
+			, renderer::Format::eR8G8B8A8_UNORM
+			, renderer::Extent2D{ 1u, 1u }
+			, 1u ) }
+		, m_placeholderView{ m_placeholder->createView( renderer::TextureViewType::e2D
+			, m_placeholder->getFormat() ) }
+	{
+		// Opaque white, neutral for the material operators.
+		m_uploader.uploadTextureData( renderer::ByteArray{ 0xFF, 0xFF, 0xFF, 0xFF }
+			, *m_placeholderView );
+	}
+
+	TextureStreamer::~TextureStreamer()
+	{
+		// The levels views must outlive their uploads.
+		m_uploader.waitAll();
+	}
+
+	TextureNodePtr TextureStreamer::add( ImagePtr image )
+	{
+		// The images given by the ImageLoader already hold their whole chain, and may be compressed.
+		if ( image->mipLevels == 1u
+			&& utils::isMipGenerationSupported( image->format ) )
+		{
+			generateMipmaps( *image );
+		}
+
+		auto result = std::make_shared< TextureNode >();
+		result->image = image;
+		result->texture = doCreateTexture( m_device
+			, image->format
+			, image->size
+			, image->mipLevels );
+		result->placeholder = m_placeholderView.get();
+
+		auto levels = utils::getMipLevels( image->format
+			, image->size
+			, image->mipLevels );
+
+		for ( uint32_t level = 0u; level < image->mipLevels; ++level )
+		{
+			Level entry
+			{
+				result,
+				level,
+				image->mipLevels - 1u - level,
+				levels[level].offset,
+				levels[level].size,
+				nullptr,
+				0u
+			};
+			// The queue stays sorted by rank, so the smallest levels of all textures go first.
+			auto it = std::upper_bound( m_queued.begin()
+				, m_queued.end()
+				, entry.rank
+				, []( uint32_t rank, Level const & lookup )
+				{
+					return rank < lookup.rank;
+				} );
+			m_queued.insert( it, std::move( entry ) );
+		}
+
+		return result;
+	}
+
+	bool TextureStreamer::update()
+	{
+		bool result = false;
+
+		// The batches complete in order, and each texture's levels are uploaded from the smallest.
+		while ( !m_pending.empty()
+			&& m_uploader.isComplete( m_pending.front().ticket ) )
+		{
+			auto & pending = m_pending.front();
+			auto & node = *pending.node;
+			node.view = node.texture->createView( renderer::TextureViewType::e2D
+				, node.texture->getFormat()
+				, pending.level
+				, node.image->mipLevels - pending.level );
+
+			if ( !pending.level )
+			{
+				// The whole chain is resident, the CPU copy is not needed anymore.
+				renderer::ByteArray{}.swap( node.image->data );
+			}
+
+			m_pending.pop_front();
+			result = true;
+		}
+
+		uint32_t uploaded = 0u;
+
+		while ( !m_queued.empty()
+			&& ( !uploaded || uploaded + m_queued.front().size <= m_budget ) )
+		{
+			auto level = std::move( m_queued.front() );
+			m_queued.pop_front();
+			auto & node = *level.node;
+			auto dimensions = node.texture->getDimensions();
+			level.view = node.texture->createView( renderer::TextureViewType::e2D
+				, node.texture->getFormat()
+				, level.level
+				, 1u );
+			level.ticket = m_uploader.uploadTextureData( renderer::ImageSubresourceLayers
+				{
+					renderer::ImageAspectFlag::eColour,
+					level.level,
+					0u,
+					1u
+				}
+				, renderer::Offset3D{ 0, 0, 0 }
+				, renderer::Extent3D
+				{
+					std::max( 1u, dimensions.width >> level.level ),
+					std::max( 1u, dimensions.height >> level.level ),
+					1u
+				}
+				, node.image->data.data() + level.offset
+				, level.size
+				, *level.view
+				, renderer::ImageLayout::eUndefined );
+			uploaded += level.size;
+			m_pending.push_back( std::move( level ) );
+		}
+
+		if ( uploaded )
+		{
+			m_uploader.flush();
+		}
+
+		return result;
+	}
+}
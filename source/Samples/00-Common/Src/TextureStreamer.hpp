@@ -0,0 +1,143 @@
+/*
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Prerequisites.hpp"
+
+#include <Buffer/UploadBatcher.hpp>
+
+#include <deque>
+
+namespace common
+{
+	/**
+	*\~english
+	*\brief
+	*	Makes textures resident progressively, from their smallest mip level to their biggest one.
+	*\remarks
+	*	Each update uploads the next mip levels, in a bytes budget, starting with the smallest levels of all textures.
+	*	Until one of its levels is resident, a texture node is sampled through a placeholder view.
+	*	The images are uploaded in their format, block compressed when the ImageLoader did it.
+	*	Each time a level is resident, the node view is replaced, and the descriptor sets using it must be updated.
+	*\~french
+	*\brief
+	*	Rend les textures résidentes progressivement, de leur plus petit niveau de mip au plus grand.
+	*\remarks
+	*	Chaque mise à jour transfère les niveaux de mip suivants, dans un budget d'octets, en commençant par les plus petits niveaux de toutes les textures.
+	*	Tant qu'aucun de ses niveaux n'est résident, un noeud de texture est échantillonné via une vue temporaire.
+	*	Les images sont transférées dans leur format, compressées par blocs quand l'ImageLoader l'a fait.
+	*	Chaque fois qu'un niveau est résident, la vue du noeud est remplacée, et les descriptor sets l'utilisant doivent être mis à jour.
+	*/
+	class TextureStreamer
+	{
+	public:
+		/**
+		*\~english
+		*\brief
+		*	Constructor.
+		*\param[in] device
+		*	The logical device.
+		*\param[in] uploader
+		*	The uploader, used by the calling thread only.
+		*\param[in] budget
+		*	The bytes count uploaded by an update, at most.
+		*\~french
+		*\brief
+		*	Constructeur.
+		*\param[in] device
+		*	Le périphérique logique.
+		*\param[in] uploader
+		*	Le transféreur, utilisé uniquement par le thread appelant.
+		*\param[in] budget
+		*	Le nombre d'octets transférés par une mise à jour, au maximum.
+		*/
+		TextureStreamer( renderer::Device const & device
+			, renderer::UploadBatcher & uploader
+			, uint32_t budget = 16u * 1024u * 1024u );
+		/**
+		*\~english
+		*\brief
+		*	Destructor, waits for the pending uploads.
+		*\~french
+		*\brief
+		*	Destructeur, attend les transferts en cours.
+		*/
+		~TextureStreamer();
+		/**
+		*\~english
+		*\brief
+		*	Creates the texture of an image, and queues the upload of its mip levels.
+		*\remarks
+		*	If the image holds only one uncompressed level, its mip chain is generated here.
+		*	The decoding and the compression are left to the ImageLoader workers.
+		*\param[in] image
+		*	The image, in RGBA8 or block compressed.
+		*\return
+		*	The texture node, sampled through the placeholder view until its first level is resident.
+		*\~french
+		*\brief
+		*	Crée la texture d'une image, et met en file le transfert de ses niveaux de mip.
+		*\remarks
+		*	Si l'image ne contient qu'un niveau non compressé, sa chaîne de mips est générée ici.
+		*	Le décodage et la compression sont laissés aux threads de travail de l'ImageLoader.
+		*\param[in] image
+		*	L'image, en RGBA8 ou compressée par blocs.
+		*\return
+		*	Le noeud de texture, échantillonné via la vue temporaire jusqu'à ce que son premier niveau soit résident.
+		*/
+		TextureNodePtr add( ImagePtr image );
+		/**
+		*\~english
+		*\brief
+		*	Makes the uploaded levels resident, and uploads the next ones.
+		*\remarks
+		*	Must be called while the textures aren't used by the GPU.
+		*\return
+		*	\p true if a texture node view has changed.
+		*\~french
+		*\brief
+		*	Rend les niveaux transférés résidents, et transfère les suivants.
+		*\remarks
+		*	Doit être appelée quand les textures ne sont pas utilisées par le GPU.
+		*\return
+		*	\p true si la vue d'un noeud de texture a changé.
+		*/
+		bool update();
+		/**
+		*\~english
+		*\return
+		*	\p true if all the levels are resident.
+		*\~french
+		*\return
+		*	\p true si tous les niveaux sont résidents.
+		*/
+		inline bool isComplete()const
+		{
+			return m_queued.empty()
+				&& m_pending.empty();
+		}
+
+	private:
+		struct Level
+		{
+			TextureNodePtr node;
+			uint32_t level;
+			// The distance to the smallest level, the levels are uploaded in increasing rank.
+			uint32_t rank;
+			uint32_t offset;
+			uint32_t size;
+			renderer::TextureViewPtr view;
+			renderer::UploadTicket ticket;
+		};
+
+	private:
+		renderer::Device const & m_device;
+		renderer::UploadBatcher & m_uploader;
+		uint32_t m_budget;
+		renderer::TexturePtr m_placeholder;
+		renderer::TextureViewPtr m_placeholderView;
+		std::deque< Level > m_queued;
+		std::deque< Level > m_pending;
+	};
+}
@@ -9,13 +9,13 @@ namespace common
 {
 	TransparentRendering::TransparentRendering( NodesRendererPtr && renderer
 		, Scene const & scene
-		, renderer::StagingBuffer & stagingBuffer
+		, renderer::UploadBatcher & uploader
 		, renderer::TextureViewCRefArray const & views
 		, common::TextureNodePtrArray const & textureNodes )
 		: m_renderer{ std::move( renderer ) }
 	{
 		m_renderer->initialise( scene
-			, stagingBuffer
+			, uploader
 			, views
 			, textureNodes );
 	}
@@ -29,4 +29,9 @@ namespace common
 	{
 		m_renderer->draw( gpu );
 	}
+
+	void TransparentRendering::updateTextures()
+	{
+		m_renderer->updateTextures();
+	}
 }
@@ -9,16 +9,17 @@ namespace common
 	public:
 		TransparentRendering( NodesRendererPtr && renderer
 			, Scene const & scene
-			, renderer::StagingBuffer & stagingBuffer
+			, renderer::UploadBatcher & uploader
 			, renderer::TextureViewCRefArray const & views
 			, common::TextureNodePtrArray const & textureNodes );
 		virtual ~TransparentRendering() = default;
 		virtual void update( RenderTarget const & target );
 		virtual void draw( std::chrono::nanoseconds & gpu )const;
+		void updateTextures();
 
 	protected:
 		void doInitialise( Object const & submeshes
-			, renderer::StagingBuffer & stagingBuffer
+			, renderer::UploadBatcher & uploader
 			, renderer::TextureViewCRefArray const & views
 			, common::TextureNodePtrArray const & textureNodes );
 
@@ -55,7 +55,7 @@ namespace vkapp
 	}
 
 	common::OpaqueRenderingPtr RenderTarget::doCreateOpaqueRendering( renderer::Device const & device
-		, renderer::StagingBuffer & stagingBuffer
+		, renderer::UploadBatcher & uploader
 		, renderer::TextureViewCRefArray const & views
 		, common::Scene const & scene
 		, common::TextureNodePtrArray const & textureNodes )
@@ -68,13 +68,13 @@ namespace vkapp
 				, *m_sceneUbo
 				, *m_objectUbo )
 			, scene
-			, stagingBuffer
+			, uploader
 			, views
 			, textureNodes );
 	}
 
 	common::TransparentRenderingPtr RenderTarget::doCreateTransparentRendering( renderer::Device const & device
-		, renderer::StagingBuffer & stagingBuffer
+		, renderer::UploadBatcher & uploader
 		, renderer::TextureViewCRefArray const & views
 		, common::Scene const & scene
 		, common::TextureNodePtrArray const & textureNodes )
@@ -87,7 +87,7 @@ namespace vkapp
 				, *m_sceneUbo
 				, *m_objectUbo )
 			, scene
-			, stagingBuffer
+			, uploader
 			, views
 			, textureNodes );
 	}
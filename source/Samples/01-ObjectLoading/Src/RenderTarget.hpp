@@ -19,12 +19,12 @@ namespace vkapp
 		void doUpdate( std::chrono::microseconds const & duration )override;
 		virtual void doResize( renderer::Extent2D const & size )override;
 		common::OpaqueRenderingPtr doCreateOpaqueRendering( renderer::Device const & device
-			, renderer::StagingBuffer & stagingBuffer
+			, renderer::UploadBatcher & uploader
 			, renderer::TextureViewCRefArray const & views
 			, common::Scene const & scene
 			, common::TextureNodePtrArray const & textureNodes )override;
 		common::TransparentRenderingPtr doCreateTransparentRendering( renderer::Device const & device
-			, renderer::StagingBuffer & stagingBuffer
+			, renderer::UploadBatcher & uploader
 			, renderer::TextureViewCRefArray const & views
 			, common::Scene const & scene
 			, common::TextureNodePtrArray const & textureNodes )override;
@@ -60,7 +60,7 @@ namespace vkapp
 	}
 
 	common::OpaqueRenderingPtr RenderTarget::doCreateOpaqueRendering( renderer::Device const & device
-		, renderer::StagingBuffer & stagingBuffer
+		, renderer::UploadBatcher & uploader
 		, renderer::TextureViewCRefArray const & views
 		, common::Scene const & scene
 		, common::TextureNodePtrArray const & textureNodes )
@@ -74,13 +74,13 @@ namespace vkapp
 				, *m_objectUbo
 				, *m_lightsUbo )
 			, scene
-			, stagingBuffer
+			, uploader
 			, views
 			, textureNodes );
 	}
 
 	common::TransparentRenderingPtr RenderTarget::doCreateTransparentRendering( renderer::Device const & device
-		, renderer::StagingBuffer & stagingBuffer
+		, renderer::UploadBatcher & uploader
 		, renderer::TextureViewCRefArray const & views
 		, common::Scene const & scene
 		, common::TextureNodePtrArray const & textureNodes )
@@ -94,7 +94,7 @@ namespace vkapp
 				, *m_objectUbo
 				, *m_lightsUbo )
 			, scene
-			, stagingBuffer
+			, uploader
 			, views
 			, textureNodes );
 	}
@@ -4,6 +4,7 @@
 
 #include <AssimpLoader.hpp>
 #include <FileUtils.hpp>
+#include <TextureCompressor.hpp>
 
 #include <Buffer/UniformBuffer.hpp>
 
@@ -23,7 +24,12 @@ namespace vkapp
 	{
 		common::ImagePtrArray images;
 		common::Scene scene;
-		scene.object = common::loadObject( common::getPath( common::getExecutableDirectory() ) / "share" / "Assets" / "Nyra", "Nyra_pose.fbx", images );
+		// The textures are compressed by the loader threads, when the GPU supports a compressed format.
+		scene.object = common::loadObject( common::getPath( common::getExecutableDirectory() ) / "share" / "Assets" / "Nyra"
+			, "Nyra_pose.fbx"
+			, images
+			, utils::selectCompressedFormat( device.getPhysicalDevice(), true, false )
+			, common::getPath( common::getExecutableDirectory() ) / "share" / "Cache" );
 		m_renderTarget = std::make_unique< RenderTarget >( device
 			, size
 			, std::move( scene )
@@ -55,6 +55,7 @@ namespace vkapp
 
 	OpaqueRendering::OpaqueRendering( std::unique_ptr< GeometryPass > && renderer
 		, common::Scene const & scene
+		, renderer::UploadBatcher & uploader
 		, renderer::StagingBuffer & stagingBuffer
 		, GeometryPassResult const & gbuffer
 		, renderer::TextureViewCRefArray const & views
@@ -63,7 +64,7 @@ namespace vkapp
 		, renderer::UniformBuffer< common::LightsData > const & lightsUbo )
 		: common::OpaqueRendering{ std::move( renderer )
 			, scene
-			, stagingBuffer
+			, uploader
 			, doGetViews( gbuffer, views )
 			, textureNodes }
 		, m_sceneUbo{ sceneUbo }
@@ -13,6 +13,7 @@ namespace vkapp
 	public:
 		OpaqueRendering( std::unique_ptr< GeometryPass > && renderer
 			, common::Scene const & scene
+			, renderer::UploadBatcher & uploader
 			, renderer::StagingBuffer & stagingBuffer
 			, GeometryPassResult const & gbuffer
 			, renderer::TextureViewCRefArray const & views
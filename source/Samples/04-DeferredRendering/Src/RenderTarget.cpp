@@ -63,7 +63,7 @@ namespace vkapp
 	}
 
 	common::OpaqueRenderingPtr RenderTarget::doCreateOpaqueRendering( renderer::Device const & device
-		, renderer::StagingBuffer & stagingBuffer
+		, renderer::UploadBatcher & uploader
 		, renderer::TextureViewCRefArray const & views
 		, common::Scene const & scene
 		, common::TextureNodePtrArray const & textureNodes )
@@ -75,7 +75,8 @@ namespace vkapp
 				, *m_sceneUbo
 				, *m_objectUbo )
 			, scene
-			, stagingBuffer
+			, uploader
+			, *m_stagingBuffer
 			, m_gbuffer
 			, views
 			, textureNodes
@@ -84,7 +85,7 @@ namespace vkapp
 	}
 
 	common::TransparentRenderingPtr RenderTarget::doCreateTransparentRendering( renderer::Device const & device
-		, renderer::StagingBuffer & stagingBuffer
+		, renderer::UploadBatcher & uploader
 		, renderer::TextureViewCRefArray const & views
 		, common::Scene const & scene
 		, common::TextureNodePtrArray const & textureNodes )
@@ -96,7 +97,7 @@ namespace vkapp
 				, *m_objectUbo
 				, *m_lightsUbo )
 			, scene
-			, stagingBuffer
+			, uploader
 			, views
 			, textureNodes );
 	}
@@ -70,7 +70,7 @@ namespace vkapp
 	}
 
 	common::OpaqueRenderingPtr RenderTarget::doCreateOpaqueRendering( renderer::Device const & device
-		, renderer::StagingBuffer & stagingBuffer
+		, renderer::UploadBatcher & uploader
 		, renderer::TextureViewCRefArray const & views
 		, common::Scene const & scene
 		, common::TextureNodePtrArray const & textureNodes )
@@ -82,13 +82,13 @@ namespace vkapp
 				, true
 				, *m_sceneUbo )
 			, scene
-			, stagingBuffer
+			, uploader
 			, views
 			, textureNodes );
 	}
 
 	common::TransparentRenderingPtr RenderTarget::doCreateTransparentRendering( renderer::Device const & device
-		, renderer::StagingBuffer & stagingBuffer
+		, renderer::UploadBatcher & uploader
 		, renderer::TextureViewCRefArray const & views
 		, common::Scene const & scene
 		, common::TextureNodePtrArray const & textureNodes )
@@ -100,7 +100,7 @@ namespace vkapp
 				, false
 				, *m_sceneUbo )
 			, scene
-			, stagingBuffer
+			, uploader
 			, views
 			, textureNodes );
 	}
@@ -0,0 +1,475 @@
+#include "TextureFile.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#if RENDERLIB_WIN32
+#	include <windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+namespace common
+{
+	namespace
+	{
+		struct BlockInfo
+		{
+			uint32_t width;
+			uint32_t height;
+			uint32_t size;
+		};
+
+		uint32_t read32( uint8_t const * data, size_t offset )
+		{
+			// The mapping gives no alignment guarantee for the header fields.
+			uint32_t result;
+			std::memcpy( &result, data + offset, sizeof( result ) );
+			return result;
+		}
+
+		BlockInfo getBlockInfo( renderer::Format format )
+		{
+			switch ( format )
+			{
+			case renderer::Format::eR8G8B8A8_UNORM:
+			case renderer::Format::eR8G8B8A8_SRGB:
+			case renderer::Format::eB8G8R8A8_UNORM:
+				return { 1u, 1u, 4u };
+			case renderer::Format::eBC1_RGB_UNORM_BLOCK:
+			case renderer::Format::eBC1_RGB_SRGB_BLOCK:
+			case renderer::Format::eBC1_RGBA_UNORM_BLOCK:
+			case renderer::Format::eBC1_RGBA_SRGB_BLOCK:
+			case renderer::Format::eBC4_UNORM_BLOCK:
+			case renderer::Format::eBC4_SNORM_BLOCK:
+				return { 4u, 4u, 8u };
+			default:
+				return { 4u, 4u, 16u };
+			}
+		}
+
+		renderer::Format convertGlFormat( uint32_t internalFormat )
+		{
+			// ASTC formats are laid out the same way in both enumerations, UNORM and SRGB interleaved.
+			if ( internalFormat >= 0x93B0 && internalFormat <= 0x93BD )
+			{
+				return renderer::Format( uint32_t( renderer::Format::eASTC_4x4_UNORM_BLOCK ) + 2u * ( internalFormat - 0x93B0 ) );
+			}
+
+			if ( internalFormat >= 0x93D0 && internalFormat <= 0x93DD )
+			{
+				return renderer::Format( uint32_t( renderer::Format::eASTC_4x4_SRGB_BLOCK ) + 2u * ( internalFormat - 0x93D0 ) );
+			}
+
+			switch ( internalFormat )
+			{
+			case 0x8058:
+				return renderer::Format::eR8G8B8A8_UNORM;
+			case 0x8C43:
+				return renderer::Format::eR8G8B8A8_SRGB;
+			case 0x83F0:
+				return renderer::Format::eBC1_RGB_UNORM_BLOCK;
+			case 0x83F1:
+				return renderer::Format::eBC1_RGBA_UNORM_BLOCK;
+			case 0x83F2:
+				return renderer::Format::eBC2_UNORM_BLOCK;
+			case 0x83F3:
+				return renderer::Format::eBC3_UNORM_BLOCK;
+			case 0x8C4C:
+				return renderer::Format::eBC1_RGB_SRGB_BLOCK;
+			case 0x8C4D:
+				return renderer::Format::eBC1_RGBA_SRGB_BLOCK;
+			case 0x8C4E:
+				return renderer::Format::eBC2_SRGB_BLOCK;
+			case 0x8C4F:
+				return renderer::Format::eBC3_SRGB_BLOCK;
+			case 0x8DBB:
+				return renderer::Format::eBC4_UNORM_BLOCK;
+			case 0x8DBC:
+				return renderer::Format::eBC4_SNORM_BLOCK;
+			case 0x8DBD:
+				return renderer::Format::eBC5_UNORM_BLOCK;
+			case 0x8DBE:
+				return renderer::Format::eBC5_SNORM_BLOCK;
+			case 0x8E8C:
+				return renderer::Format::eBC7_UNORM_BLOCK;
+			case 0x8E8D:
+				return renderer::Format::eBC7_SRGB_BLOCK;
+			case 0x8E8E:
+				return renderer::Format::eBC6H_SFLOAT_BLOCK;
+			case 0x8E8F:
+				return renderer::Format::eBC6H_UFLOAT_BLOCK;
+			case 0x9270:
+				return renderer::Format::eEAC_R11_UNORM_BLOCK;
+			case 0x9271:
+				return renderer::Format::eEAC_R11_SNORM_BLOCK;
+			case 0x9272:
+				return renderer::Format::eEAC_R11G11_UNORM_BLOCK;
+			case 0x9273:
+				return renderer::Format::eEAC_R11G11_SNORM_BLOCK;
+			case 0x9274:
+				return renderer::Format::eETC2_R8G8B8_UNORM_BLOCK;
+			case 0x9275:
+				return renderer::Format::eETC2_R8G8B8_SRGB_BLOCK;
+			case 0x9276:
+				return renderer::Format::eETC2_R8G8B8A1_UNORM_BLOCK;
+			case 0x9277:
+				return renderer::Format::eETC2_R8G8B8A1_SRGB_BLOCK;
+			case 0x9278:
+				return renderer::Format::eETC2_R8G8B8A8_UNORM_BLOCK;
+			case 0x9279:
+				return renderer::Format::eETC2_R8G8B8A8_SRGB_BLOCK;
+			default:
+				throw std::runtime_error{ "Unsupported KTX internal format." };
+			}
+		}
+
+		renderer::Format convertDxgiFormat( uint32_t format )
+		{
+			switch ( format )
+			{
+			case 28:
+				return renderer::Format::eR8G8B8A8_UNORM;
+			case 29:
+				return renderer::Format::eR8G8B8A8_SRGB;
+			case 71:
+				return renderer::Format::eBC1_RGBA_UNORM_BLOCK;
+			case 72:
+				return renderer::Format::eBC1_RGBA_SRGB_BLOCK;
+			case 74:
+				return renderer::Format::eBC2_UNORM_BLOCK;
+			case 75:
+				return renderer::Format::eBC2_SRGB_BLOCK;
+			case 77:
+				return renderer::Format::eBC3_UNORM_BLOCK;
+			case 78:
+				return renderer::Format::eBC3_SRGB_BLOCK;
+			case 80:
+				return renderer::Format::eBC4_UNORM_BLOCK;
+			case 81:
+				return renderer::Format::eBC4_SNORM_BLOCK;
+			case 83:
+				return renderer::Format::eBC5_UNORM_BLOCK;
+			case 84:
+				return renderer::Format::eBC5_SNORM_BLOCK;
+			case 87:
+				return renderer::Format::eB8G8R8A8_UNORM;
+			case 95:
+				return renderer::Format::eBC6H_UFLOAT_BLOCK;
+			case 96:
+				return renderer::Format::eBC6H_SFLOAT_BLOCK;
+			case 98:
+				return renderer::Format::eBC7_UNORM_BLOCK;
+			case 99:
+				return renderer::Format::eBC7_SRGB_BLOCK;
+			default:
+				throw std::runtime_error{ "Unsupported DDS DXGI format." };
+			}
+		}
+
+		uint32_t makeFourCC( char a, char b, char c, char d )
+		{
+			return uint32_t( uint8_t( a ) )
+				| ( uint32_t( uint8_t( b ) ) << 8u )
+				| ( uint32_t( uint8_t( c ) ) << 16u )
+				| ( uint32_t( uint8_t( d ) ) << 24u );
+		}
+
+		void unmapFile( uint8_t const * data, size_t size )
+		{
+#if RENDERLIB_WIN32
+			::UnmapViewOfFile( data );
+#else
+			::munmap( const_cast< uint8_t * >( data ), size );
+#endif
+		}
+
+		uint8_t const * mapFile( std::string const & path, size_t & size )
+		{
+			uint8_t const * result = nullptr;
+#if RENDERLIB_WIN32
+			HANDLE file = ::CreateFileA( path.c_str()
+				, GENERIC_READ
+				, FILE_SHARE_READ
+				, nullptr
+				, OPEN_EXISTING
+				, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN
+				, nullptr );
+
+			if ( file != INVALID_HANDLE_VALUE )
+			{
+				LARGE_INTEGER fileSize;
+
+				if ( ::GetFileSizeEx( file, &fileSize ) && fileSize.QuadPart )
+				{
+					HANDLE mapping = ::CreateFileMappingA( file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+
+					if ( mapping )
+					{
+						// The view keeps the mapping alive, the handles can be closed.
+						result = reinterpret_cast< uint8_t const * >( ::MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 ) );
+						size = size_t( fileSize.QuadPart );
+						::CloseHandle( mapping );
+					}
+				}
+
+				::CloseHandle( file );
+			}
+#else
+			int fd = ::open( path.c_str(), O_RDONLY );
+
+			if ( fd != -1 )
+			{
+				struct stat status;
+
+				if ( !::fstat( fd, &status ) && status.st_size )
+				{
+					// The mapping outlives the descriptor.
+					auto data = ::mmap( nullptr, size_t( status.st_size ), PROT_READ, MAP_PRIVATE, fd, 0 );
+
+					if ( data != MAP_FAILED )
+					{
+						result = reinterpret_cast< uint8_t const * >( data );
+						size = size_t( status.st_size );
+					}
+				}
+
+				::close( fd );
+			}
+#endif
+
+			if ( !result )
+			{
+				throw std::runtime_error{ "Couldn't map the file [" + path + "]." };
+			}
+
+			return result;
+		}
+	}
+
+	TextureFile::TextureFile( std::string const & path )
+		: m_data{ mapFile( path, m_size ) }
+	{
+		static uint8_t const KtxIdentifier[12]
+		{
+			0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A
+		};
+
+		try
+		{
+			if ( m_size >= 64u
+				&& !std::memcmp( m_data, KtxIdentifier, sizeof( KtxIdentifier ) ) )
+			{
+				doParseKtx();
+			}
+			else if ( m_size >= 128u
+				&& read32( m_data, 0u ) == makeFourCC( 'D', 'D', 'S', ' ' ) )
+			{
+				doParseDds();
+			}
+			else
+			{
+				throw std::runtime_error{ "Unsupported texture container." };
+			}
+		}
+		catch ( std::runtime_error & exc )
+		{
+			unmapFile( m_data, m_size );
+			throw std::runtime_error{ "[" + path + "]: " + exc.what() };
+		}
+	}
+
+	TextureFile::~TextureFile()
+	{
+		unmapFile( m_data, m_size );
+	}
+
+	std::vector< renderer::BufferImageCopy > TextureFile::copyTo( uint8_t * dst )const
+	{
+		std::vector< renderer::BufferImageCopy > result;
+		result.reserve( m_subresources.size() );
+		uint32_t offset = 0u;
+
+		for ( auto & subresource : m_subresources )
+		{
+			std::memcpy( dst + offset, subresource.data, subresource.size );
+			renderer::BufferImageCopy copy{};
+			copy.bufferOffset = offset;
+			copy.imageSubresource.aspectMask = renderer::ImageAspectFlag::eColour;
+			copy.imageSubresource.mipLevel = subresource.level;
+			copy.imageSubresource.baseArrayLayer = subresource.layer;
+			copy.imageSubresource.layerCount = 1u;
+			copy.imageExtent = subresource.extent;
+			copy.levelSize = subresource.size;
+			result.push_back( copy );
+			offset += subresource.size;
+		}
+
+		return result;
+	}
+
+	void TextureFile::doParseKtx()
+	{
+		if ( read32( m_data, 12u ) != 0x04030201 )
+		{
+			throw std::runtime_error{ "Big endian KTX files are not supported." };
+		}
+
+		m_format = convertGlFormat( read32( m_data, 28u ) );
+		m_dimensions.width = read32( m_data, 36u );
+		m_dimensions.height = std::max( 1u, read32( m_data, 40u ) );
+		m_dimensions.depth = std::max( 1u, read32( m_data, 44u ) );
+		auto arrayElements = read32( m_data, 48u );
+		auto faces = std::max( 1u, read32( m_data, 52u ) );
+		m_mipLevels = std::max( 1u, read32( m_data, 56u ) );
+		m_cube = faces == 6u;
+		m_arrayLayers = std::max( 1u, arrayElements ) * faces;
+		m_subresources.resize( m_arrayLayers * m_mipLevels );
+		size_t offset = 64u + read32( m_data, 60u );
+
+		for ( uint32_t level = 0u; level < m_mipLevels; ++level )
+		{
+			if ( offset + 4u > m_size )
+			{
+				throw std::runtime_error{ "Truncated KTX file." };
+			}
+
+			auto imageSize = read32( m_data, offset );
+			offset += 4u;
+			// For non array cube maps, imageSize is the size of one face, otherwise it covers the whole level.
+			auto faceSize = ( m_cube && !arrayElements )
+				? imageSize
+				: imageSize / m_arrayLayers;
+
+			for ( uint32_t layer = 0u; layer < m_arrayLayers; ++layer )
+			{
+				doAddSubresource( layer, level, offset, faceSize );
+				// Cube faces and mip levels are 4 bytes aligned.
+				offset += ( faceSize + 3u ) & ~size_t( 3u );
+			}
+		}
+	}
+
+	void TextureFile::doParseDds()
+	{
+		// The DDS_HEADER follows the magic number.
+		auto flags = read32( m_data, 8u );
+		m_dimensions.height = read32( m_data, 12u );
+		m_dimensions.width = read32( m_data, 16u );
+		m_dimensions.depth = ( flags & 0x800000u )
+			? std::max( 1u, read32( m_data, 24u ) )
+			: 1u;
+		m_mipLevels = ( flags & 0x20000u )
+			? std::max( 1u, read32( m_data, 28u ) )
+			: 1u;
+		auto pixelFlags = read32( m_data, 80u );
+		auto fourCC = read32( m_data, 84u );
+		auto caps2 = read32( m_data, 112u );
+		size_t offset = 128u;
+
+		if ( ( pixelFlags & 0x4u ) && fourCC == makeFourCC( 'D', 'X', '1', '0' ) )
+		{
+			if ( m_size < 148u )
+			{
+				throw std::runtime_error{ "Truncated DDS file." };
+			}
+
+			m_format = convertDxgiFormat( read32( m_data, 128u ) );
+			m_cube = ( read32( m_data, 136u ) & 0x4u ) != 0u;
+			m_arrayLayers = std::max( 1u, read32( m_data, 140u ) ) * ( m_cube ? 6u : 1u );
+			offset = 148u;
+		}
+		else
+		{
+			if ( !( pixelFlags & 0x4u ) )
+			{
+				// Uncompressed data, only the RGBA8 layout is supported.
+				if ( read32( m_data, 88u ) != 32u
+					|| read32( m_data, 92u ) != 0x000000FFu
+					|| read32( m_data, 100u ) != 0x00FF0000u )
+				{
+					throw std::runtime_error{ "Unsupported DDS pixel layout." };
+				}
+
+				m_format = renderer::Format::eR8G8B8A8_UNORM;
+			}
+			else if ( fourCC == makeFourCC( 'D', 'X', 'T', '1' ) )
+			{
+				m_format = renderer::Format::eBC1_RGBA_UNORM_BLOCK;
+			}
+			else if ( fourCC == makeFourCC( 'D', 'X', 'T', '3' ) )
+			{
+				m_format = renderer::Format::eBC2_UNORM_BLOCK;
+			}
+			else if ( fourCC == makeFourCC( 'D', 'X', 'T', '5' ) )
+			{
+				m_format = renderer::Format::eBC3_UNORM_BLOCK;
+			}
+			else if ( fourCC == makeFourCC( 'A', 'T', 'I', '1' ) )
+			{
+				m_format = renderer::Format::eBC4_UNORM_BLOCK;
+			}
+			else if ( fourCC == makeFourCC( 'A', 'T', 'I', '2' ) )
+			{
+				m_format = renderer::Format::eBC5_UNORM_BLOCK;
+			}
+			else
+			{
+				throw std::runtime_error{ "Unsupported DDS FourCC." };
+			}
+
+			// Legacy cube maps are expected to hold all their faces.
+			m_cube = ( caps2 & 0x200u ) != 0u;
+			m_arrayLayers = m_cube ? 6u : 1u;
+		}
+
+		m_subresources.resize( m_arrayLayers * m_mipLevels );
+		auto block = getBlockInfo( m_format );
+
+		// Unlike KTX, the DDS subresources are sorted by layer, then by level.
+		for ( uint32_t layer = 0u; layer < m_arrayLayers; ++layer )
+		{
+			for ( uint32_t level = 0u; level < m_mipLevels; ++level )
+			{
+				auto width = std::max( 1u, m_dimensions.width >> level );
+				auto height = std::max( 1u, m_dimensions.height >> level );
+				auto depth = std::max( 1u, m_dimensions.depth >> level );
+				auto size = ( ( width + block.width - 1u ) / block.width )
+					* ( ( height + block.height - 1u ) / block.height )
+					* depth
+					* block.size;
+				doAddSubresource( layer, level, offset, size );
+				offset += size;
+			}
+		}
+	}
+
+	void TextureFile::doAddSubresource( uint32_t layer
+		, uint32_t level
+		, size_t offset
+		, uint32_t size )
+	{
+		if ( offset + size > m_size )
+		{
+			throw std::runtime_error{ "Truncated texture file." };
+		}
+
+		m_subresources[layer * m_mipLevels + level] = Subresource
+		{
+			layer,
+			level,
+			renderer::Extent3D
+			{
+				std::max( 1u, m_dimensions.width >> level ),
+				std::max( 1u, m_dimensions.height >> level ),
+				std::max( 1u, m_dimensions.depth >> level )
+			},
+			m_data + offset,
+			size
+		};
+		m_dataSize += size;
+	}
+}
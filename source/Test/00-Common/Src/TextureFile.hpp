@@ -0,0 +1,179 @@
+/*
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "Prerequisites.hpp"
+
+#include <Miscellaneous/BufferImageCopy.hpp>
+
+namespace common
+{
+	/**
+	*\~english
+	*\brief
+	*	A KTX or DDS texture file, memory mapped.
+	*\remarks
+	*	The headers are parsed in place, and the subresources payloads point inside the mapping.
+	*	They can then be copied straight to their destination (staging buffer, or host visible texture memory).
+	*\~french
+	*\brief
+	*	Un fichier de texture KTX ou DDS, mappé en mémoire.
+	*\remarks
+	*	Les en-têtes sont lus sur place, et les données des sous-ressources pointent dans le mapping.
+	*	Elles peuvent ensuite être copiées directement vers leur destination (tampon de transfert, ou mémoire de texture visible par l'hôte).
+	*/
+	class TextureFile
+	{
+	public:
+		/**
+		*\~english
+		*\brief
+		*	A subresource (mip level of an array layer, or of a cube face) payload.
+		*\~french
+		*\brief
+		*	Les données d'une sous-ressource (niveau de mip d'une couche de tableau, ou d'une face de cube).
+		*/
+		struct Subresource
+		{
+			//!\~english	The array layer (faces included).
+			//!\~french		La couche du tableau (faces incluses).
+			uint32_t layer;
+			//!\~english	The mip level.
+			//!\~french		Le niveau de mip.
+			uint32_t level;
+			//!\~english	The level dimensions.
+			//!\~french		Les dimensions du niveau.
+			renderer::Extent3D extent;
+			//!\~english	The payload, inside the mapping.
+			//!\~french		Les données, dans le mapping.
+			uint8_t const * data;
+			//!\~english	The payload size.
+			//!\~french		La taille des données.
+			uint32_t size;
+		};
+
+	public:
+		/**
+		*\~english
+		*\brief
+		*	Constructor, maps the file and parses its headers.
+		*\remarks
+		*	Throws a std::runtime_error if the file can't be mapped, or if its format isn't supported.
+		*\param[in] path
+		*	The file path, the container (KTX or DDS) is detected from its signature.
+		*\~french
+		*\brief
+		*	Constructeur, mappe le fichier et lit ses en-têtes.
+		*\remarks
+		*	Lance une std::runtime_error si le fichier ne peut être mappé, ou si son format n'est pas supporté.
+		*\param[in] path
+		*	Le chemin du fichier, le conteneur (KTX ou DDS) est détecté depuis sa signature.
+		*/
+		explicit TextureFile( std::string const & path );
+		/**
+		*\~english
+		*\brief
+		*	Destructor, unmaps the file.
+		*\~french
+		*\brief
+		*	Destructeur, démappe le fichier.
+		*/
+		~TextureFile();
+		TextureFile( TextureFile const & ) = delete;
+		TextureFile & operator=( TextureFile const & ) = delete;
+		/**
+		*\~english
+		*\brief
+		*	Copies all the subresources payloads, tightly packed.
+		*\param[out] dst
+		*	The destination, at least getDataSize() bytes.
+		*\return
+		*	The copy regions, relative to \p dst.
+		*\~french
+		*\brief
+		*	Copie les données de toutes les sous-ressources, de manière contiguë.
+		*\param[out] dst
+		*	La destination, d'au moins getDataSize() octets.
+		*\return
+		*	Les régions de copie, relatives à \p dst.
+		*/
+		std::vector< renderer::BufferImageCopy > copyTo( uint8_t * dst )const;
+		/**
+		*\~english
+		*\param[in] layer, level
+		*	The subresource indices.
+		*\return
+		*	The subresource.
+		*\~french
+		*\param[in] layer, level
+		*	Les indices de la sous-ressource.
+		*\return
+		*	La sous-ressource.
+		*/
+		inline Subresource const & getSubresource( uint32_t layer, uint32_t level )const
+		{
+			return m_subresources[layer * m_mipLevels + level];
+		}
+		/**
+		*\~english
+		*name
+		*	Getters.
+		*\~french
+		*name
+		*	Accesseurs.
+		*/
+		/**@{*/
+		inline renderer::Format getFormat()const
+		{
+			return m_format;
+		}
+
+		inline renderer::Extent3D const & getDimensions()const
+		{
+			return m_dimensions;
+		}
+
+		inline uint32_t getMipLevels()const
+		{
+			return m_mipLevels;
+		}
+
+		inline uint32_t getArrayLayers()const
+		{
+			return m_arrayLayers;
+		}
+
+		inline bool isCube()const
+		{
+			return m_cube;
+		}
+
+		inline uint32_t getDataSize()const
+		{
+			return m_dataSize;
+		}
+		/**@}*/
+
+	private:
+		void doParseKtx();
+		void doParseDds();
+		void doAddSubresource( uint32_t layer
+			, uint32_t level
+			, size_t offset
+			, uint32_t size );
+
+	private:
+		// Declared first, the mapping fills it.
+		size_t m_size{ 0u };
+		uint8_t const * m_data{ nullptr };
+		renderer::Format m_format{ renderer::Format::eUndefined };
+		renderer::Extent3D m_dimensions{};
+		uint32_t m_mipLevels{ 1u };
+		uint32_t m_arrayLayers{ 1u };
+		bool m_cube{ false };
+		uint32_t m_dataSize{ 0u };
+		// Sorted by layer, then by level.
+		std::vector< Subresource > m_subresources;
+	};
+}
@@ -27,8 +27,7 @@
 #include <Sync/ImageMemoryBarrier.hpp>
 
 #include <FileUtils.hpp>
-
-#include <gli/gli.hpp>
+#include <TextureFile.hpp>
 
 #include <fstream>
 #include <cstring>
@@ -156,39 +155,39 @@ namespace vkapp
 	void RenderPanel::doCreateTexture()
 	{
 		std::string assetsFolder = common::getPath( common::getExecutableDirectory() ) / "share" / "Assets";
-		gli::texture2d tex2D;
-		renderer::Format format;
+		std::string fileName;
 
 		if ( m_device->getFeatures().textureCompressionASTC_LDR )
 		{
-			format = renderer::Format::eASTC_8x8_UNORM_BLOCK;
-			tex2D = gli::texture2d( gli::load( assetsFolder / "stonefloor01_color_astc_8x8_unorm.ktx" ) );
+			fileName = "stonefloor01_color_astc_8x8_unorm.ktx";
 		}
 		else if ( m_device->getFeatures().textureCompressionBC )
 		{
-			format = renderer::Format::eBC3_UNORM_BLOCK;
-			tex2D = gli::texture2d( gli::load( assetsFolder / "stonefloor01_color_bc3_unorm.ktx" ) );
+			fileName = "stonefloor01_color_bc3_unorm.ktx";
 		}
 		else if ( m_device->getFeatures().textureCompressionETC2 )
 		{
-			format = renderer::Format::eETC2_R8G8B8_UNORM_BLOCK;
-			tex2D = gli::texture2d( gli::load( assetsFolder / "stonefloor01_color_etc2_unorm.ktx" ) );
+			fileName = "stonefloor01_color_etc2_unorm.ktx";
 		}
 		else
 		{
 			throw std::runtime_error{ "No compressed texture format supported." };
 		}
 
+		// Map the file, its levels are read in place
+		common::TextureFile file{ assetsFolder / fileName };
+		auto format = file.getFormat();
+
 		// Create a host-visible staging buffer that contains the raw image data
-		renderer::BufferBasePtr stagingBuffer = m_device->createBuffer( uint32_t( tex2D.size() )
+		renderer::BufferBasePtr stagingBuffer = m_device->createBuffer( file.getDataSize()
 			, renderer::BufferTarget::eTransferSrc
 			, renderer::MemoryPropertyFlag::eHostVisible | renderer::MemoryPropertyFlag::eHostCoherent );
 
-		// Copy texture data into staging buffer
+		// Copy the levels from the mapped file into staging buffer, and prepare copy regions
 		uint8_t * data = stagingBuffer->lock( 0u
 			, stagingBuffer->getSize()
 			, renderer::MemoryMapFlag::eWrite );
-		memcpy( data, tex2D.data(), tex2D.size() );
+		auto bufferCopyRegions = file.copyTo( data );
 		stagingBuffer->unlock();
 
 		// Create the texture image
@@ -197,8 +196,8 @@ namespace vkapp
 				0u,
 				renderer::TextureType::e2D,
 				format,
-				{ uint32_t( tex2D.extent().x ), uint32_t( tex2D.extent().y ), 1u },
-				uint32_t( tex2D.levels() ),
+				file.getDimensions(),
+				file.getMipLevels(),
 				1u,
 				renderer::SampleCountFlag::e1,
 				renderer::ImageTiling::eOptimal,
@@ -206,35 +205,12 @@ namespace vkapp
 			}
 			, renderer::MemoryPropertyFlag::eDeviceLocal );
 
-		// Prepare copy regions
-		std::vector< renderer::BufferImageCopy > bufferCopyRegions;
-		uint32_t offset{ 0u };
-
-		for ( uint32_t level = 0; level < tex2D.levels(); level++ )
-		{
-			renderer::BufferImageCopy bufferCopyRegion = {};
-			bufferCopyRegion.imageSubresource.aspectMask = renderer::ImageAspectFlag::eColour;
-			bufferCopyRegion.imageSubresource.mipLevel = level;
-			bufferCopyRegion.imageSubresource.baseArrayLayer = 0u;
-			bufferCopyRegion.imageSubresource.layerCount = 1u;
-			bufferCopyRegion.imageExtent.width = static_cast< uint32_t >( tex2D[level].extent().x );
-			bufferCopyRegion.imageExtent.height = static_cast< uint32_t >( tex2D[level].extent().y );
-			bufferCopyRegion.imageExtent.depth = 1;
-			bufferCopyRegion.bufferOffset = offset;
-			bufferCopyRegion.levelSize = tex2D[level].size();
-
-			bufferCopyRegions.push_back( bufferCopyRegion );
-
-			// Increase offset into staging buffer for next level / face
-			offset += uint32_t( tex2D[level].size() );
-		}
-
 		auto cmdBuffer = m_device->getGraphicsCommandPool().createCommandBuffer();
 		renderer::ImageSubresourceRange subresourceRange
 		{
 			renderer::ImageAspectFlag::eColour,
 			0,
-			uint32_t( tex2D.levels() ),
+			file.getMipLevels(),
 			0,
 			1,
 		};
@@ -285,7 +261,7 @@ namespace vkapp
 		m_view = m_texture->createView( renderer::TextureViewType::e2D
 			, format
 			, 0u
-			, uint32_t( tex2D.levels() ) );
+			, file.getMipLevels() );
 	}
 
 	void RenderPanel::doCreateDescriptorSet()
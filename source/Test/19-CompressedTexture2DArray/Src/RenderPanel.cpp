@@ -27,8 +27,7 @@
 #include <Sync/ImageMemoryBarrier.hpp>
 
 #include <FileUtils.hpp>
-
-#include <gli/gli.hpp>
+#include <TextureFile.hpp>
 
 #include <fstream>
 #include <cstring>
@@ -167,39 +166,39 @@ namespace vkapp
 	void RenderPanel::doCreateTexture()
 	{
 		std::string assetsFolder = common::getPath( common::getExecutableDirectory() ) / "share" / "Assets";
-		gli::texture2d_array tex2DArray;
-		renderer::Format format;
+		std::string fileName;
 
 		if ( m_device->getFeatures().textureCompressionASTC_LDR )
 		{
-			format = renderer::Format::eASTC_8x8_UNORM_BLOCK;
-			tex2DArray = gli::texture2d_array( gli::load( assetsFolder / "terrain_texturearray_astc_8x8_unorm.ktx" ) );
+			fileName = "terrain_texturearray_astc_8x8_unorm.ktx";
 		}
 		else if ( m_device->getFeatures().textureCompressionBC )
 		{
-			format = renderer::Format::eBC3_UNORM_BLOCK;
-			tex2DArray = gli::texture2d_array( gli::load( assetsFolder / "terrain_texturearray_bc3_unorm.ktx" ) );
+			fileName = "terrain_texturearray_bc3_unorm.ktx";
 		}
 		else if ( m_device->getFeatures().textureCompressionETC2 )
 		{
-			format = renderer::Format::eETC2_R8G8B8_UNORM_BLOCK;
-			tex2DArray = gli::texture2d_array( gli::load( assetsFolder / "terrain_texturearray_etc2_unorm.ktx" ) );
+			fileName = "terrain_texturearray_etc2_unorm.ktx";
 		}
 		else
 		{
 			throw std::runtime_error{ "No compressed texture format supported." };
 		}
 
+		// Map the file, its layers and levels are read in place
+		common::TextureFile file{ assetsFolder / fileName };
+		auto format = file.getFormat();
+
 		// Create a host-visible staging buffer that contains the raw image data
-		renderer::BufferBasePtr stagingBuffer = m_device->createBuffer( uint32_t( tex2DArray.size() )
+		renderer::BufferBasePtr stagingBuffer = m_device->createBuffer( file.getDataSize()
 			, renderer::BufferTarget::eTransferSrc
 			, renderer::MemoryPropertyFlag::eHostVisible | renderer::MemoryPropertyFlag::eHostCoherent );
 
-		// Copy texture data into staging buffer
+		// Copy the layers levels from the mapped file into staging buffer, and prepare copy regions
 		uint8_t * data = stagingBuffer->lock( 0u
 			, stagingBuffer->getSize()
 			, renderer::MemoryMapFlag::eWrite );
-		memcpy( data, tex2DArray.data(), tex2DArray.size() );
+		auto bufferCopyRegions = file.copyTo( data );
 		stagingBuffer->unlock();
 
 		// Create the texture image
@@ -208,49 +207,23 @@ namespace vkapp
 				0u,
 				renderer::TextureType::e2D,
 				format,
-				{ uint32_t( tex2DArray.extent().x ), uint32_t( tex2DArray.extent().y ), 1u },
-				uint32_t( tex2DArray.levels() ),
-				uint32_t( tex2DArray.layers() ),
+				file.getDimensions(),
+				file.getMipLevels(),
+				file.getArrayLayers(),
 				renderer::SampleCountFlag::e1,
 				renderer::ImageTiling::eOptimal,
 				renderer::ImageUsageFlag::eTransferDst | renderer::ImageUsageFlag::eSampled
 			}
 			, renderer::MemoryPropertyFlag::eDeviceLocal );
 
-		// Prepare copy regions
-		std::vector< renderer::BufferImageCopy > bufferCopyRegions;
-		uint32_t offset{ 0u };
-
-		for ( uint32_t layer = 0; layer < tex2DArray.layers(); layer++ )
-		{
-			for ( uint32_t level = 0; level < tex2DArray.levels(); level++ )
-			{
-				renderer::BufferImageCopy bufferCopyRegion = {};
-				bufferCopyRegion.imageSubresource.aspectMask = renderer::ImageAspectFlag::eColour;
-				bufferCopyRegion.imageSubresource.mipLevel = level;
-				bufferCopyRegion.imageSubresource.baseArrayLayer = layer;
-				bufferCopyRegion.imageSubresource.layerCount = 1u;
-				bufferCopyRegion.imageExtent.width = static_cast< uint32_t >( tex2DArray[layer][level].extent().x );
-				bufferCopyRegion.imageExtent.height = static_cast< uint32_t >( tex2DArray[layer][level].extent().y );
-				bufferCopyRegion.imageExtent.depth = 1;
-				bufferCopyRegion.bufferOffset = offset;
-				bufferCopyRegion.levelSize = tex2DArray[layer][level].size();
-
-				bufferCopyRegions.push_back( bufferCopyRegion );
-
-				// Increase offset into staging buffer for next level / face
-				offset += uint32_t( tex2DArray[layer][level].size() );
-			}
-		}
-
 		auto cmdBuffer = m_device->getGraphicsCommandPool().createCommandBuffer();
 		renderer::ImageSubresourceRange subresourceRange
 		{
 			renderer::ImageAspectFlag::eColour,
 			0,
-			uint32_t( tex2DArray.levels() ),
+			file.getMipLevels(),
 			0,
-			uint32_t( tex2DArray.layers() ),
+			file.getArrayLayers(),
 		};
 		cmdBuffer->begin();
 
@@ -299,9 +272,9 @@ namespace vkapp
 		m_view = m_texture->createView( renderer::TextureViewType::e2DArray
 			, format
 			, 0u
-			, uint32_t( tex2DArray.levels() )
+			, file.getMipLevels()
 			, 0u
-			, uint32_t( tex2DArray.layers() ) );
+			, file.getArrayLayers() );
 	}
 
 	void RenderPanel::doCreateDescriptorSet()
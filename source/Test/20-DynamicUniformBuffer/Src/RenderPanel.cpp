@@ -4,6 +4,7 @@
 #include "MainFrame.hpp"
 
 #include <Buffer/PushConstantsBuffer.hpp>
+#include <Buffer/RingBuffer.hpp>
 #include <Buffer/StagingBuffer.hpp>
 #include <Buffer/UniformBuffer.hpp>
 #include <Buffer/VertexBuffer.hpp>
@@ -197,7 +198,7 @@ namespace vkapp
 			m_stagingBuffer.reset();
 
 			m_matrixUbo.reset();
-			m_objectUbo.reset();
+			m_objectRing.reset();
 			m_mainDescriptorSet.reset();
 			m_mainDescriptorPool.reset();
 			m_mainDescriptorLayout.reset();
@@ -299,10 +300,12 @@ namespace vkapp
 			, 1u
 			, renderer::BufferTarget::eTransferDst
 			, renderer::MemoryPropertyFlag::eDeviceLocal );
-		m_objectUbo = std::make_unique< renderer::UniformBuffer< utils::Mat4 > >( *m_device
-			, 2u
-			, renderer::BufferTarget::eTransferDst
-			, renderer::MemoryPropertyFlag::eDeviceLocal );
+		// The objects matrices are rewritten each frame, in the current region of the ring buffer.
+		auto objectSize = std::max( uint64_t( sizeof( utils::Mat4 ) )
+			, m_device->getProperties().limits.minUniformBufferOffsetAlignment );
+		m_objectRing = std::make_unique< renderer::RingBuffer >( *m_device
+			, renderer::BufferTarget::eUniformBuffer
+			, uint32_t( 2u * objectSize ) );
 	}
 
 	void RenderPanel::doCreateStagingBuffer()
@@ -332,9 +335,9 @@ namespace vkapp
 			, 0u
 			, 1u );
 		m_offscreenDescriptorSet->createDynamicBinding( m_offscreenDescriptorLayout->getBinding( 2u )
-			, *m_objectUbo
+			, m_objectRing->getBuffer()
 			, 0u
-			, 1u );
+			, uint32_t( sizeof( utils::Mat4 ) ) );
 		m_offscreenDescriptorSet->update();
 	}
 
@@ -539,50 +542,6 @@ namespace vkapp
 			, 2u
 			, 0u );
 		m_commandBuffer = m_device->getGraphicsCommandPool().createCommandBuffer();
-		wxSize size{ GetClientSize() };
-		auto & commandBuffer = *m_commandBuffer;
-		auto & frameBuffer = *m_frameBuffer;
-
-		commandBuffer.begin( renderer::CommandBufferUsageFlag::eSimultaneousUse );
-		auto dimensions = m_swapChain->getDimensions();
-		commandBuffer.resetQueryPool( *m_queryPool
-			, 0u
-			, 2u );
-		commandBuffer.beginRenderPass( *m_offscreenRenderPass
-			, frameBuffer
-			, { renderer::ClearValue{ m_swapChain->getClearColour() }, renderer::ClearValue{ renderer::DepthStencilClearValue{ 1.0f, 0u } } }
-			, renderer::SubpassContents::eInline );
-		commandBuffer.writeTimestamp( renderer::PipelineStageFlag::eTopOfPipe
-			, *m_queryPool
-			, 0u );
-		commandBuffer.bindPipeline( *m_offscreenPipeline );
-		commandBuffer.setViewport( { dimensions.width
-			, dimensions.height
-			, 0
-			, 0 } );
-		commandBuffer.setScissor( { 0
-			, 0
-			, dimensions.width
-			, dimensions.height } );
-		commandBuffer.bindVertexBuffer( 0u, m_offscreenVertexBuffer->getBuffer(), 0u );
-		commandBuffer.bindIndexBuffer( m_offscreenIndexBuffer->getBuffer(), 0u, renderer::IndexType::eUInt16 );
-		commandBuffer.bindDescriptorSet( *m_offscreenDescriptorSet
-			, *m_offscreenPipelineLayout
-			, renderer::UInt32Array{ 0u } );
-		commandBuffer.pushConstants( *m_offscreenPipelineLayout
-			, m_objectPcbs[0] );
-		commandBuffer.drawIndexed( uint32_t( m_offscreenIndexData.size() ) );
-		commandBuffer.bindDescriptorSet( *m_offscreenDescriptorSet
-			, *m_offscreenPipelineLayout
-			, renderer::UInt32Array{ m_objectUbo->getAlignedSize() } );
-		commandBuffer.pushConstants( *m_offscreenPipelineLayout
-			, m_objectPcbs[1] );
-		commandBuffer.drawIndexed( uint32_t( m_offscreenIndexData.size() ) );
-		commandBuffer.writeTimestamp( renderer::PipelineStageFlag::eBottomOfPipe
-			, *m_queryPool
-			, 1u );
-		commandBuffer.endRenderPass();
-		commandBuffer.end();
 	}
 
 	void RenderPanel::doCreateMainVertexBuffer()
@@ -700,12 +659,66 @@ namespace vkapp
 		m_rotate[1] = utils::rotate( m_rotate[1]
 			, -float( utils::DegreeToRadian )
 			, { 0, 1, 0 } );
-		m_objectUbo->getData( 0u ) = originalTranslate1 * m_rotate[0] * originalRotate;
-		m_objectUbo->getData( 1u ) = originalTranslate2 * m_rotate[1] * originalRotate;
-		m_stagingBuffer->uploadUniformData( *m_updateCommandBuffer
-			, m_objectUbo->getDatas()
-			, *m_objectUbo
-			, renderer::PipelineStageFlag::eVertexShader );
+		m_objectRing->beginFrame();
+		auto object1 = m_objectRing->allocate< utils::Mat4 >( m_objectOffsets[0] );
+		auto object2 = m_objectRing->allocate< utils::Mat4 >( m_objectOffsets[1] );
+
+		if ( object1 && object2 )
+		{
+			*object1 = originalTranslate1 * m_rotate[0] * originalRotate;
+			*object2 = originalTranslate2 * m_rotate[1] * originalRotate;
+		}
+
+		m_objectRing->endFrame();
+		// The dynamic offsets change with the region, so the offscreen frame is recorded again.
+		doRecordOffscreenFrame();
+	}
+
+	void RenderPanel::doRecordOffscreenFrame()
+	{
+		auto & commandBuffer = *m_commandBuffer;
+		auto & frameBuffer = *m_frameBuffer;
+
+		commandBuffer.begin( renderer::CommandBufferUsageFlag::eOneTimeSubmit );
+		auto dimensions = m_swapChain->getDimensions();
+		commandBuffer.resetQueryPool( *m_queryPool
+			, 0u
+			, 2u );
+		commandBuffer.beginRenderPass( *m_offscreenRenderPass
+			, frameBuffer
+			, { renderer::ClearValue{ m_swapChain->getClearColour() }, renderer::ClearValue{ renderer::DepthStencilClearValue{ 1.0f, 0u } } }
+			, renderer::SubpassContents::eInline );
+		commandBuffer.writeTimestamp( renderer::PipelineStageFlag::eTopOfPipe
+			, *m_queryPool
+			, 0u );
+		commandBuffer.bindPipeline( *m_offscreenPipeline );
+		commandBuffer.setViewport( { dimensions.width
+			, dimensions.height
+			, 0
+			, 0 } );
+		commandBuffer.setScissor( { 0
+			, 0
+			, dimensions.width
+			, dimensions.height } );
+		commandBuffer.bindVertexBuffer( 0u, m_offscreenVertexBuffer->getBuffer(), 0u );
+		commandBuffer.bindIndexBuffer( m_offscreenIndexBuffer->getBuffer(), 0u, renderer::IndexType::eUInt16 );
+		commandBuffer.bindDescriptorSet( *m_offscreenDescriptorSet
+			, *m_offscreenPipelineLayout
+			, renderer::UInt32Array{ m_objectOffsets[0] } );
+		commandBuffer.pushConstants( *m_offscreenPipelineLayout
+			, m_objectPcbs[0] );
+		commandBuffer.drawIndexed( uint32_t( m_offscreenIndexData.size() ) );
+		commandBuffer.bindDescriptorSet( *m_offscreenDescriptorSet
+			, *m_offscreenPipelineLayout
+			, renderer::UInt32Array{ m_objectOffsets[1] } );
+		commandBuffer.pushConstants( *m_offscreenPipelineLayout
+			, m_objectPcbs[1] );
+		commandBuffer.drawIndexed( uint32_t( m_offscreenIndexData.size() ) );
+		commandBuffer.writeTimestamp( renderer::PipelineStageFlag::eBottomOfPipe
+			, *m_queryPool
+			, 1u );
+		commandBuffer.endRenderPass();
+		commandBuffer.end();
 	}
 
 	void RenderPanel::doDraw()
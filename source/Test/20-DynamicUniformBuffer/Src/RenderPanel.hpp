@@ -3,6 +3,7 @@
 #include "Prerequisites.hpp"
 
 #include <Buffer/PushConstantsBuffer.hpp>
+#include <Buffer/RingBuffer.hpp>
 #include <Core/Connection.hpp>
 #include <Core/Device.hpp>
 #include <Pipeline/Pipeline.hpp>
@@ -60,6 +61,7 @@ namespace vkapp
 		*/
 		/**@{*/
 		void doUpdate();
+		void doRecordOffscreenFrame();
 		void doDraw();
 		void doResetSwapChain();
 		/**@}*/
@@ -92,7 +94,8 @@ namespace vkapp
 		renderer::TextureViewPtr m_renderTargetDepthView;
 		renderer::FrameBufferPtr m_frameBuffer;
 		renderer::UniformBufferPtr< utils::Mat4 > m_matrixUbo;
-		renderer::UniformBufferPtr< utils::Mat4 > m_objectUbo;
+		std::unique_ptr< renderer::RingBuffer > m_objectRing;
+		uint32_t m_objectOffsets[2]{ 0u, 0u };
 		renderer::PushConstantsBuffer< utils::Vec4 > m_objectPcbs[2];
 		renderer::CommandBufferPtr m_updateCommandBuffer;
 		/**@}*/
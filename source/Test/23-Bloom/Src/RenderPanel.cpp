@@ -18,6 +18,7 @@
 #include <Descriptor/DescriptorSetPool.hpp>
 #include <Image/Texture.hpp>
 #include <Image/TextureView.hpp>
+#include <Image/TransientTextureAllocator.hpp>
 #include <Miscellaneous/QueryPool.hpp>
 #include <Pipeline/DepthStencilState.hpp>
 #include <Pipeline/InputAssemblyState.hpp>
@@ -51,6 +52,17 @@ namespace vkapp
 
 		static int const TimerTimeMs = 20;
 
+		// The passes of a frame, used to declare the transient textures lifetimes.
+		enum FramePass : uint32_t
+		{
+			eOffscreenPass,
+			eHiPass,
+			eBlurXPass,
+			eBlurYPass,
+			eCombinePass,
+			eMainPass,
+		};
+
 		std::vector< float > getHalfPascal( uint32_t height )
 		{
 			std::vector< float > result;
@@ -187,6 +199,8 @@ namespace vkapp
 			std::cout << "Offscreen frame prepared." << std::endl;
 			doCreateMainVertexBuffer();
 			std::cout << "Main vertex buffer created." << std::endl;
+			doCreateBloomTextures();
+			std::cout << "Bloom textures created." << std::endl;
 			doPrepareHiPass();
 			std::cout << "Hi pass created." << std::endl;
 			doPrepareBlurXPass();
@@ -261,6 +275,8 @@ namespace vkapp
 				Pass dummyHi;
 				std::swap( m_passes.hi, dummyHi );
 			}
+
+			m_bloomTextures.reset();
 			m_blurConfiguration.reset();
 
 			for ( auto & sampler : m_blurSamplers )
@@ -360,6 +376,8 @@ namespace vkapp
 				Pass dummyHi;
 				std::swap( m_passes.hi, dummyHi );
 			}
+
+			doCreateBloomTextures();
 			doPrepareHiPass();
 			doPrepareBlurXPass();
 			doPrepareBlurYPass();
@@ -673,23 +691,9 @@ namespace vkapp
 		commandBuffer.end();
 	}
 
-	void RenderPanel::doPrepareHiPass()
+	void RenderPanel::doCreateBloomTextures()
 	{
 		auto dimensions = m_swapChain->getDimensions();
-		std::vector< renderer::DescriptorSetLayoutBinding > bindings
-		{
-			renderer::DescriptorSetLayoutBinding{ 0u, renderer::DescriptorType::eCombinedImageSampler, renderer::ShaderStageFlag::eFragment },
-		};
-		m_passes.hi.descriptorLayout = m_device->createDescriptorSetLayout( std::move( bindings ) );
-		m_passes.hi.descriptorPool = m_passes.hi.descriptorLayout->createPool( 1u );
-		m_passes.hi.descriptorSet = m_passes.hi.descriptorPool->createDescriptorSet();
-		m_passes.hi.descriptorSet->createBinding( m_passes.hi.descriptorLayout->getBinding( 0u )
-			, *m_renderTargetColourView
-			, *m_sampler );
-		m_passes.hi.descriptorSet->update();
-		m_passes.hi.semaphore = m_device->createSemaphore();
-		m_passes.hi.pipelineLayout = m_device->createPipelineLayout( *m_passes.hi.descriptorLayout );
-
 		renderer::ImageCreateInfo image{};
 		image.arrayLayers = 1u;
 		image.extent = renderer::Extent3D{ dimensions.width, dimensions.height, 1u };
@@ -704,10 +708,39 @@ namespace vkapp
 			| renderer::ImageUsageFlag::eSampled
 			| renderer::ImageUsageFlag::eTransferDst
 			| renderer::ImageUsageFlag::eTransferSrc;
-		m_passes.hi.image = m_device->createTexture( image, renderer::MemoryPropertyFlag::eDeviceLocal );
+
+		// The horizontal blur result is dead once the combine pass starts, so the combine result can reuse its memory.
+		m_bloomTextures = std::make_unique< renderer::TransientTextureAllocator >( *m_device );
+		m_passes.hi.transientIndex = m_bloomTextures->declare( image, eHiPass, eCombinePass );
+		m_passes.blurX[0].transientIndex = m_bloomTextures->declare( image, eBlurXPass, eBlurYPass );
+		m_passes.combine.transientIndex = m_bloomTextures->declare( image, eCombinePass, eMainPass );
+		m_bloomTextures->allocate( renderer::MemoryPropertyFlag::eDeviceLocal );
+		std::cout << "Bloom textures: " << m_bloomTextures->getAllocatedSize() << " bytes allocated, out of " << m_bloomTextures->getRequiredSize() << " bytes required." << std::endl;
+
+		m_passes.hi.image = &m_bloomTextures->getTexture( m_passes.hi.transientIndex );
+		m_passes.blurX[0].image = &m_bloomTextures->getTexture( m_passes.blurX[0].transientIndex );
+		m_passes.combine.image = &m_bloomTextures->getTexture( m_passes.combine.transientIndex );
+	}
+
+	void RenderPanel::doPrepareHiPass()
+	{
+		auto dimensions = m_swapChain->getDimensions();
+		std::vector< renderer::DescriptorSetLayoutBinding > bindings
+		{
+			renderer::DescriptorSetLayoutBinding{ 0u, renderer::DescriptorType::eCombinedImageSampler, renderer::ShaderStageFlag::eFragment },
+		};
+		m_passes.hi.descriptorLayout = m_device->createDescriptorSetLayout( std::move( bindings ) );
+		m_passes.hi.descriptorPool = m_passes.hi.descriptorLayout->createPool( 1u );
+		m_passes.hi.descriptorSet = m_passes.hi.descriptorPool->createDescriptorSet();
+		m_passes.hi.descriptorSet->createBinding( m_passes.hi.descriptorLayout->getBinding( 0u )
+			, *m_renderTargetColourView
+			, *m_sampler );
+		m_passes.hi.descriptorSet->update();
+		m_passes.hi.semaphore = m_device->createSemaphore();
+		m_passes.hi.pipelineLayout = m_device->createPipelineLayout( *m_passes.hi.descriptorLayout );
 
 		renderer::ImageViewCreateInfo view{};
-		view.format = image.format;
+		view.format = m_passes.hi.image->getFormat();
 		view.viewType = renderer::TextureViewType::e2D;
 		view.subresourceRange.aspectMask = renderer::ImageAspectFlag::eColour;
 		view.subresourceRange.baseArrayLayer = 0u;
@@ -722,7 +755,7 @@ namespace vkapp
 
 		renderer::RenderPassCreateInfo renderPass{};
 		renderPass.attachments.resize( 1u );
-		renderPass.attachments[0].format = image.format;
+		renderPass.attachments[0].format = m_passes.hi.image->getFormat();
 		renderPass.attachments[0].loadOp = renderer::AttachmentLoadOp::eClear;
 		renderPass.attachments[0].storeOp = renderer::AttachmentStoreOp::eStore;
 		renderPass.attachments[0].stencilLoadOp = renderer::AttachmentLoadOp::eDontCare;
@@ -837,25 +870,9 @@ namespace vkapp
 
 		m_blurConfiguration->upload( 0u, uint32_t( m_passes.blurX.size() ) );
 
-		renderer::ImageCreateInfo image{};
-		image.arrayLayers = 1u;
-		image.extent = renderer::Extent3D{ dimensions.width, dimensions.height, 1u };
-		image.flags = 0u;
-		image.format = m_renderTargetColourView->getFormat();
-		image.imageType = renderer::TextureType::e2D;
-		image.initialLayout = renderer::ImageLayout::eUndefined;
-		image.mipLevels = uint32_t( m_passes.blurX.size() );
-		image.samples = renderer::SampleCountFlag::e1;
-		image.tiling = renderer::ImageTiling::eOptimal;
-		image.usage = renderer::ImageUsageFlag::eColourAttachment
-			| renderer::ImageUsageFlag::eSampled
-			| renderer::ImageUsageFlag::eTransferDst
-			| renderer::ImageUsageFlag::eTransferSrc;
-		m_passes.blurX[0].image = m_device->createTexture( image, renderer::MemoryPropertyFlag::eDeviceLocal );
-
 		renderer::RenderPassCreateInfo renderPass{};
 		renderPass.attachments.resize( 1u );
-		renderPass.attachments[0].format = image.format;
+		renderPass.attachments[0].format = m_passes.blurX[0].image->getFormat();
 		renderPass.attachments[0].loadOp = renderer::AttachmentLoadOp::eClear;
 		renderPass.attachments[0].storeOp = renderer::AttachmentStoreOp::eStore;
 		renderPass.attachments[0].stencilLoadOp = renderer::AttachmentLoadOp::eDontCare;
@@ -908,7 +925,7 @@ namespace vkapp
 			blur.pipelineLayout = m_device->createPipelineLayout( *blur.descriptorLayout );
 
 			renderer::ImageViewCreateInfo view{};
-			view.format = image.format;
+			view.format = m_passes.blurX[0].image->getFormat();
 			view.viewType = renderer::TextureViewType::e2D;
 			view.subresourceRange.aspectMask = renderer::ImageAspectFlag::eColour;
 			view.subresourceRange.baseArrayLayer = 0u;
@@ -960,6 +977,17 @@ namespace vkapp
 			auto & cmd = *blur.commandBuffer;
 
 			cmd.begin();
+
+			if ( i == 0u
+				&& m_bloomTextures->isAliased( m_passes.blurX[0].transientIndex ) )
+			{
+				cmd.memoryBarrier( m_bloomTextures->getAliasingSrcStages( m_passes.blurX[0].transientIndex )
+					, renderer::PipelineStageFlag::eColourAttachmentOutput
+					, m_bloomTextures->makeAliasingBarrier( m_passes.blurX[0].transientIndex
+						, renderer::ImageLayout::eColourAttachmentOptimal
+						, renderer::AccessFlag::eColourAttachmentWrite ) );
+			}
+
 			cmd.beginRenderPass( *m_passes.blurX[0].renderPass
 				, *blur.frameBuffer
 				, { renderer::ClearColorValue{ 0.0, 0.0, 0.0, 0.0 } }
@@ -1134,24 +1162,8 @@ namespace vkapp
 		m_passes.combine.semaphore = m_device->createSemaphore();
 		m_passes.combine.pipelineLayout = m_device->createPipelineLayout( *m_passes.combine.descriptorLayout );
 
-		renderer::ImageCreateInfo image{};
-		image.arrayLayers = 1u;
-		image.extent = renderer::Extent3D{ dimensions.width, dimensions.height, 1u };
-		image.flags = 0u;
-		image.format = m_renderTargetColourView->getFormat();
-		image.imageType = renderer::TextureType::e2D;
-		image.initialLayout = renderer::ImageLayout::eUndefined;
-		image.mipLevels = uint32_t( m_passes.blurX.size() );
-		image.samples = renderer::SampleCountFlag::e1;
-		image.tiling = renderer::ImageTiling::eOptimal;
-		image.usage = renderer::ImageUsageFlag::eColourAttachment
-			| renderer::ImageUsageFlag::eSampled
-			| renderer::ImageUsageFlag::eTransferDst
-			| renderer::ImageUsageFlag::eTransferSrc;
-		m_passes.combine.image = m_device->createTexture( image, renderer::MemoryPropertyFlag::eDeviceLocal );
-
 		view = renderer::ImageViewCreateInfo{};
-		view.format = image.format;
+		view.format = m_passes.combine.image->getFormat();
 		view.viewType = renderer::TextureViewType::e2D;
 		view.subresourceRange.aspectMask = renderer::ImageAspectFlag::eColour;
 		view.subresourceRange.baseArrayLayer = 0u;
@@ -1162,7 +1174,7 @@ namespace vkapp
 
 		renderer::RenderPassCreateInfo renderPass{};
 		renderPass.attachments.resize( 1u );
-		renderPass.attachments[0].format = image.format;
+		renderPass.attachments[0].format = m_passes.combine.image->getFormat();
 		renderPass.attachments[0].loadOp = renderer::AttachmentLoadOp::eClear;
 		renderPass.attachments[0].storeOp = renderer::AttachmentStoreOp::eStore;
 		renderPass.attachments[0].stencilLoadOp = renderer::AttachmentLoadOp::eDontCare;
@@ -1235,6 +1247,16 @@ namespace vkapp
 		auto & cmd = *m_passes.combine.commandBuffer;
 
 		cmd.begin();
+
+		if ( m_bloomTextures->isAliased( m_passes.combine.transientIndex ) )
+		{
+			cmd.memoryBarrier( m_bloomTextures->getAliasingSrcStages( m_passes.combine.transientIndex )
+				, renderer::PipelineStageFlag::eColourAttachmentOutput
+				, m_bloomTextures->makeAliasingBarrier( m_passes.combine.transientIndex
+					, renderer::ImageLayout::eColourAttachmentOptimal
+					, renderer::AccessFlag::eColourAttachmentWrite ) );
+		}
+
 		cmd.beginRenderPass( *m_passes.combine.renderPass
 			, *m_passes.combine.frameBuffer
 			, { renderer::ClearColorValue{ 0.0, 0.0, 0.0, 0.0 } }
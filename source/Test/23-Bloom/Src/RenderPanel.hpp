@@ -47,6 +47,7 @@ namespace vkapp
 		void doCreateOffscreenVertexBuffer();
 		void doCreateOffscreenPipeline();
 		void doPrepareOffscreenFrame();
+		void doCreateBloomTextures();
 		void doPrepareHiPass();
 		void doPrepareBlurXPass();
 		void doPrepareBlurYPass();
@@ -130,7 +131,8 @@ namespace vkapp
 			renderer::RenderPassPtr renderPass;
 			renderer::FrameBufferPtr frameBuffer;
 			renderer::PipelinePtr pipeline;
-			renderer::TexturePtr image;
+			uint32_t transientIndex{ 0u };
+			renderer::Texture const * image{ nullptr };
 			std::vector< renderer::TextureViewPtr > views;
 			renderer::SemaphorePtr semaphore;
 		};
@@ -141,6 +143,7 @@ namespace vkapp
 			std::array< Pass, 4u > blurY;
 			Pass combine;
 		} m_passes;
+		renderer::TransientTextureAllocatorPtr m_bloomTextures;
 		renderer::TextureViewPtr m_blurMipView;
 		renderer::SamplerPtr m_mipSampler;
 		std::array< renderer::SamplerPtr, 4 > m_blurSamplers;
@@ -0,0 +1,15 @@
+layout( location = 0 ) in vec4 position;
+layout( location = 1 ) in vec2 texcoord;
+
+out gl_PerVertex
+{
+  vec4 gl_Position;
+};
+
+layout( location = 0 ) out vec2 vtx_texcoord;
+
+void main()
+{
+    gl_Position = rendererScalePosition( position );
+    vtx_texcoord = texcoord;
+}
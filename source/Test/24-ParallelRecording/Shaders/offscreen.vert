@@ -0,0 +1,38 @@
+layout( set=0, binding=1 ) uniform Matrix
+{
+	mat4 mtxProjection;
+};
+
+#ifdef VULKAN
+layout( push_constant ) uniform Object
+{
+	mat4 mtxModel;
+	vec4 colour;
+} object;
+#else
+layout( location=2 ) uniform mat4 mtxModel;
+layout( location=6 ) uniform vec4 colour;
+#endif
+
+layout( location=0 ) in vec4 position;
+layout( location=1 ) in vec2 texcoord;
+
+out gl_PerVertex
+{
+  vec4 gl_Position;
+};
+
+layout( location = 0 ) out vec2 vtx_texcoord;
+layout( location = 1 ) out vec4 vtx_colour;
+
+void main()
+{
+#ifdef VULKAN
+	gl_Position = mtxProjection * object.mtxModel * rendererScalePosition( position );
+	vtx_colour = object.colour;
+#else
+	gl_Position = mtxProjection * mtxModel * rendererScalePosition( position );
+	vtx_colour = colour;
+#endif
+	vtx_texcoord = texcoord;
+}
@@ -0,0 +1,5 @@
+#include "Prerequisites.hpp"
+
+namespace vkapp
+{
+}
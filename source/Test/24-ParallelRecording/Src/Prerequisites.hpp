@@ -0,0 +1,24 @@
+#pragma once
+
+#include <Prerequisites.hpp>
+
+namespace vkapp
+{
+	struct TexturedVertexData
+	{
+		utils::Vec4 position;
+		utils::Vec2 uv;
+	};
+
+	struct ObjectData
+	{
+		utils::Mat4 mtxModel;
+		utils::Vec4 colour;
+	};
+
+	static wxString const AppName = wxT( "24-ParallelRecording" );
+
+	class RenderPanel;
+	class MainFrame;
+	class Application;
+}
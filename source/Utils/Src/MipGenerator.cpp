@@ -0,0 +1,917 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#include "MipGenerator.hpp"
+
+#include "ParallelFor.hpp"
+#include "Simd.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+namespace utils
+{
+	namespace
+	{
+		// The filtering is done on RGBA float texels, whatever the format components count.
+		static uint32_t constexpr TexelFloats = 4u;
+		static uint32_t constexpr KaiserRadius = 3u;
+		static uint32_t constexpr KaiserTaps = 2u * KaiserRadius;
+		static double constexpr KaiserAlpha = 4.0;
+		// Below this texels count, a level is not worth spreading between threads.
+		static uint32_t constexpr MinTexelsPerThread = 16384u;
+
+		enum class ComponentKind
+		{
+			eUnorm8,
+			eSrgb8,
+			eFloat16,
+			eFloat32,
+		};
+
+		struct FormatInfo
+		{
+			ComponentKind kind;
+			uint32_t components;
+		};
+
+		bool getFormatInfo( renderer::Format format
+			, FormatInfo & info )noexcept
+		{
+			switch ( format )
+			{
+			case renderer::Format::eR8_UNORM:
+				info = { ComponentKind::eUnorm8, 1u };
+				return true;
+			case renderer::Format::eR8G8_UNORM:
+				info = { ComponentKind::eUnorm8, 2u };
+				return true;
+			case renderer::Format::eR8G8B8_UNORM:
+			case renderer::Format::eB8G8R8_UNORM:
+				info = { ComponentKind::eUnorm8, 3u };
+				return true;
+			case renderer::Format::eR8G8B8A8_UNORM:
+			case renderer::Format::eB8G8R8A8_UNORM:
+			case renderer::Format::eA8B8G8R8_UNORM_PACK32:
+				info = { ComponentKind::eUnorm8, 4u };
+				return true;
+			case renderer::Format::eR8_SRGB:
+				info = { ComponentKind::eSrgb8, 1u };
+				return true;
+			case renderer::Format::eR8G8_SRGB:
+				info = { ComponentKind::eSrgb8, 2u };
+				return true;
+			case renderer::Format::eR8G8B8_SRGB:
+			case renderer::Format::eB8G8R8_SRGB:
+				info = { ComponentKind::eSrgb8, 3u };
+				return true;
+			case renderer::Format::eR8G8B8A8_SRGB:
+			case renderer::Format::eB8G8R8A8_SRGB:
+			case renderer::Format::eA8B8G8R8_SRGB_PACK32:
+				info = { ComponentKind::eSrgb8, 4u };
+				return true;
+			case renderer::Format::eR16_SFLOAT:
+				info = { ComponentKind::eFloat16, 1u };
+				return true;
+			case renderer::Format::eR16G16_SFLOAT:
+				info = { ComponentKind::eFloat16, 2u };
+				return true;
+			case renderer::Format::eR16G16B16_SFLOAT:
+				info = { ComponentKind::eFloat16, 3u };
+				return true;
+			case renderer::Format::eR16G16B16A16_SFLOAT:
+				info = { ComponentKind::eFloat16, 4u };
+				return true;
+			case renderer::Format::eR32_SFLOAT:
+				info = { ComponentKind::eFloat32, 1u };
+				return true;
+			case renderer::Format::eR32G32_SFLOAT:
+				info = { ComponentKind::eFloat32, 2u };
+				return true;
+			case renderer::Format::eR32G32B32_SFLOAT:
+				info = { ComponentKind::eFloat32, 3u };
+				return true;
+			case renderer::Format::eR32G32B32A32_SFLOAT:
+				info = { ComponentKind::eFloat32, 4u };
+				return true;
+			default:
+				return false;
+			}
+		}
+
+		uint32_t getTexelSize( FormatInfo const & info )
+		{
+			switch ( info.kind )
+			{
+			case ComponentKind::eFloat16:
+				return 2u * info.components;
+			case ComponentKind::eFloat32:
+				return 4u * info.components;
+			default:
+				return info.components;
+			}
+		}
+
+		struct BlockInfo
+		{
+			uint32_t width;
+			uint32_t height;
+			uint32_t size;
+		};
+
+		bool getBlockInfo( renderer::Format format
+			, BlockInfo & block )noexcept
+		{
+			switch ( format )
+			{
+			case renderer::Format::eBC1_RGB_UNORM_BLOCK:
+			case renderer::Format::eBC1_RGB_SRGB_BLOCK:
+			case renderer::Format::eBC1_RGBA_UNORM_BLOCK:
+			case renderer::Format::eBC1_RGBA_SRGB_BLOCK:
+			case renderer::Format::eBC4_UNORM_BLOCK:
+			case renderer::Format::eBC4_SNORM_BLOCK:
+			case renderer::Format::eETC2_R8G8B8_UNORM_BLOCK:
+			case renderer::Format::eETC2_R8G8B8_SRGB_BLOCK:
+			case renderer::Format::eETC2_R8G8B8A1_UNORM_BLOCK:
+			case renderer::Format::eETC2_R8G8B8A1_SRGB_BLOCK:
+			case renderer::Format::eEAC_R11_UNORM_BLOCK:
+			case renderer::Format::eEAC_R11_SNORM_BLOCK:
+				block = { 4u, 4u, 8u };
+				return true;
+			case renderer::Format::eBC2_UNORM_BLOCK:
+			case renderer::Format::eBC2_SRGB_BLOCK:
+			case renderer::Format::eBC3_UNORM_BLOCK:
+			case renderer::Format::eBC3_SRGB_BLOCK:
+			case renderer::Format::eBC5_UNORM_BLOCK:
+			case renderer::Format::eBC5_SNORM_BLOCK:
+			case renderer::Format::eBC6H_UFLOAT_BLOCK:
+			case renderer::Format::eBC6H_SFLOAT_BLOCK:
+			case renderer::Format::eBC7_UNORM_BLOCK:
+			case renderer::Format::eBC7_SRGB_BLOCK:
+			case renderer::Format::eETC2_R8G8B8A8_UNORM_BLOCK:
+			case renderer::Format::eETC2_R8G8B8A8_SRGB_BLOCK:
+			case renderer::Format::eEAC_R11G11_UNORM_BLOCK:
+			case renderer::Format::eEAC_R11G11_SNORM_BLOCK:
+				block = { 4u, 4u, 16u };
+				return true;
+			default:
+				return false;
+			}
+		}
+
+		//*********************************************************************************************
+
+		float srgbToLinear( float value )
+		{
+			return value <= 0.04045f
+				? value / 12.92f
+				: std::pow( ( value + 0.055f ) / 1.055f, 2.4f );
+		}
+
+		std::array< float, 256u > const & getSrgbDecodeTable()
+		{
+			static std::array< float, 256u > const result = []()
+			{
+				std::array< float, 256u > table;
+
+				for ( uint32_t i = 0u; i < 256u; ++i )
+				{
+					table[i] = srgbToLinear( float( i ) / 255.0f );
+				}
+
+				return table;
+			}();
+			return result;
+		}
+
+		std::array< float, 255u > const & getSrgbEncodeThresholds()
+		{
+			// The linear values halfway between two consecutive sRGB codes, for an exact rounding in sRGB space.
+			static std::array< float, 255u > const result = []()
+			{
+				std::array< float, 255u > table;
+
+				for ( uint32_t i = 0u; i < 255u; ++i )
+				{
+					table[i] = srgbToLinear( ( float( i ) + 0.5f ) / 255.0f );
+				}
+
+				return table;
+			}();
+			return result;
+		}
+
+		float halfToFloat( uint16_t value )
+		{
+			uint32_t sign = uint32_t( value & 0x8000u ) << 16u;
+			uint32_t exponent = ( value >> 10u ) & 0x1Fu;
+			uint32_t mantissa = value & 0x3FFu;
+			uint32_t bits;
+
+			if ( !exponent )
+			{
+				if ( !mantissa )
+				{
+					bits = sign;
+				}
+				else
+				{
+					// Subnormal half, normalised in the float.
+					exponent = 127u - 15u + 1u;
+
+					while ( !( mantissa & 0x400u ) )
+					{
+						mantissa <<= 1u;
+						--exponent;
+					}
+
+					bits = sign | ( exponent << 23u ) | ( ( mantissa & 0x3FFu ) << 13u );
+				}
+			}
+			else if ( exponent == 0x1Fu )
+			{
+				bits = sign | 0x7F800000u | ( mantissa << 13u );
+			}
+			else
+			{
+				bits = sign | ( ( exponent + 127u - 15u ) << 23u ) | ( mantissa << 13u );
+			}
+
+			float result;
+			std::memcpy( &result, &bits, sizeof( result ) );
+			return result;
+		}
+
+		uint16_t floatToHalf( float value )
+		{
+			uint32_t bits;
+			std::memcpy( &bits, &value, sizeof( bits ) );
+			uint32_t sign = ( bits >> 16u ) & 0x8000u;
+			uint32_t mantissa = bits & 0x7FFFFFu;
+			int32_t exponent = int32_t( ( bits >> 23u ) & 0xFFu ) - 127 + 15;
+
+			if ( ( ( bits >> 23u ) & 0xFFu ) == 0xFFu )
+			{
+				return uint16_t( sign | 0x7C00u | ( mantissa ? 0x200u : 0u ) );
+			}
+
+			if ( exponent >= 0x1F )
+			{
+				return uint16_t( sign | 0x7C00u );
+			}
+
+			// Round to nearest even, in both the normal and subnormal cases.
+			if ( exponent <= 0 )
+			{
+				if ( exponent < -10 )
+				{
+					return uint16_t( sign );
+				}
+
+				mantissa |= 0x800000u;
+				uint32_t shift = uint32_t( 14 - exponent );
+				uint32_t half = mantissa >> shift;
+				uint32_t remainder = mantissa & ( ( 1u << shift ) - 1u );
+				uint32_t middle = 1u << ( shift - 1u );
+
+				if ( remainder > middle || ( remainder == middle && ( half & 1u ) ) )
+				{
+					++half;
+				}
+
+				return uint16_t( sign | half );
+			}
+
+			uint32_t half = sign | ( uint32_t( exponent ) << 10u ) | ( mantissa >> 13u );
+			uint32_t remainder = mantissa & 0x1FFFu;
+
+			// A carry into the exponent gives the right result, up to infinity.
+			if ( remainder > 0x1000u || ( remainder == 0x1000u && ( half & 1u ) ) )
+			{
+				++half;
+			}
+
+			return uint16_t( half );
+		}
+
+		void decodeRow( FormatInfo const & info
+			, uint8_t const * src
+			, uint32_t width
+			, float * dst )
+		{
+			auto count = info.components;
+			// Alpha is never gamma encoded.
+			auto colours = count == 4u ? 3u : count;
+			std::memset( dst, 0, size_t( width ) * TexelFloats * sizeof( float ) );
+
+			switch ( info.kind )
+			{
+			case ComponentKind::eUnorm8:
+				for ( uint32_t x = 0u; x < width; ++x, src += count, dst += TexelFloats )
+				{
+					for ( uint32_t c = 0u; c < count; ++c )
+					{
+						dst[c] = float( src[c] ) * ( 1.0f / 255.0f );
+					}
+				}
+				break;
+
+			case ComponentKind::eSrgb8:
+				{
+					auto & srgb = getSrgbDecodeTable();
+
+					for ( uint32_t x = 0u; x < width; ++x, src += count, dst += TexelFloats )
+					{
+						for ( uint32_t c = 0u; c < colours; ++c )
+						{
+							dst[c] = srgb[src[c]];
+						}
+
+						for ( uint32_t c = colours; c < count; ++c )
+						{
+							dst[c] = float( src[c] ) * ( 1.0f / 255.0f );
+						}
+					}
+				}
+				break;
+
+			case ComponentKind::eFloat16:
+				for ( uint32_t x = 0u; x < width; ++x, src += 2u * count, dst += TexelFloats )
+				{
+					for ( uint32_t c = 0u; c < count; ++c )
+					{
+						uint16_t half;
+						std::memcpy( &half, src + 2u * c, sizeof( half ) );
+						dst[c] = halfToFloat( half );
+					}
+				}
+				break;
+
+			case ComponentKind::eFloat32:
+				for ( uint32_t x = 0u; x < width; ++x, src += 4u * count, dst += TexelFloats )
+				{
+					std::memcpy( dst, src, 4u * count );
+				}
+				break;
+			}
+		}
+
+		inline uint8_t encodeUnorm8( float value )
+		{
+			return uint8_t( std::min( 1.0f, std::max( 0.0f, value ) ) * 255.0f + 0.5f );
+		}
+
+		static uint32_t constexpr SrgbEncodeBuckets = 4096u;
+
+		std::array< uint8_t, SrgbEncodeBuckets + 1u > const & getSrgbEncodeStarts()
+		{
+			// For each bucket of linear values, the sRGB code of its lower bound, from where the thresholds are searched.
+			static std::array< uint8_t, SrgbEncodeBuckets + 1u > const result = []()
+			{
+				auto & thresholds = getSrgbEncodeThresholds();
+				std::array< uint8_t, SrgbEncodeBuckets + 1u > table;
+
+				for ( uint32_t i = 0u; i <= SrgbEncodeBuckets; ++i )
+				{
+					auto value = float( i ) / float( SrgbEncodeBuckets );
+					table[i] = uint8_t( std::upper_bound( thresholds.begin(), thresholds.end(), value ) - thresholds.begin() );
+				}
+
+				return table;
+			}();
+			return result;
+		}
+
+		inline uint8_t encodeSrgb8( float value
+			, std::array< float, 255u > const & thresholds
+			, std::array< uint8_t, SrgbEncodeBuckets + 1u > const & starts )
+		{
+			value = std::min( 1.0f, std::max( 0.0f, value ) );
+			uint32_t result = starts[uint32_t( value * float( SrgbEncodeBuckets ) )];
+
+			// A bucket spans at most a few codes.
+			while ( result < 255u && thresholds[result] <= value )
+			{
+				++result;
+			}
+
+			return uint8_t( result );
+		}
+
+		void encodeRow( FormatInfo const & info
+			, float const * src
+			, uint32_t width
+			, uint8_t * dst )
+		{
+			auto count = info.components;
+			auto colours = count == 4u ? 3u : count;
+
+			switch ( info.kind )
+			{
+			case ComponentKind::eUnorm8:
+				for ( uint32_t x = 0u; x < width; ++x, src += TexelFloats, dst += count )
+				{
+					for ( uint32_t c = 0u; c < count; ++c )
+					{
+						dst[c] = encodeUnorm8( src[c] );
+					}
+				}
+				break;
+
+			case ComponentKind::eSrgb8:
+				{
+					auto & thresholds = getSrgbEncodeThresholds();
+					auto & starts = getSrgbEncodeStarts();
+
+					for ( uint32_t x = 0u; x < width; ++x, src += TexelFloats, dst += count )
+					{
+						for ( uint32_t c = 0u; c < colours; ++c )
+						{
+							dst[c] = encodeSrgb8( src[c], thresholds, starts );
+						}
+
+						for ( uint32_t c = colours; c < count; ++c )
+						{
+							dst[c] = encodeUnorm8( src[c] );
+						}
+					}
+				}
+				break;
+
+			case ComponentKind::eFloat16:
+				for ( uint32_t x = 0u; x < width; ++x, src += TexelFloats, dst += 2u * count )
+				{
+					for ( uint32_t c = 0u; c < count; ++c )
+					{
+						auto half = floatToHalf( src[c] );
+						std::memcpy( dst + 2u * c, &half, sizeof( half ) );
+					}
+				}
+				break;
+
+			case ComponentKind::eFloat32:
+				for ( uint32_t x = 0u; x < width; ++x, src += TexelFloats, dst += 4u * count )
+				{
+					std::memcpy( dst, src, 4u * count );
+				}
+				break;
+			}
+		}
+
+		//*********************************************************************************************
+
+#if UTILS_SIMD_SSE
+
+		using Texel = __m128;
+
+		inline Texel loadTexel( float const * src )
+		{
+			return _mm_loadu_ps( src );
+		}
+
+		inline void storeTexel( float * dst, Texel value )
+		{
+			_mm_storeu_ps( dst, value );
+		}
+
+		inline Texel zeroTexel()
+		{
+			return _mm_setzero_ps();
+		}
+
+		inline Texel addTexel( Texel lhs, Texel rhs )
+		{
+			return _mm_add_ps( lhs, rhs );
+		}
+
+		inline Texel mulTexel( Texel lhs, float rhs )
+		{
+			return _mm_mul_ps( lhs, _mm_set1_ps( rhs ) );
+		}
+
+		inline Texel maddTexel( Texel acc, Texel value, float weight )
+		{
+			return _mm_add_ps( acc, _mm_mul_ps( value, _mm_set1_ps( weight ) ) );
+		}
+
+#elif UTILS_SIMD_NEON
+
+		using Texel = float32x4_t;
+
+		inline Texel loadTexel( float const * src )
+		{
+			return vld1q_f32( src );
+		}
+
+		inline void storeTexel( float * dst, Texel value )
+		{
+			vst1q_f32( dst, value );
+		}
+
+		inline Texel zeroTexel()
+		{
+			return vdupq_n_f32( 0.0f );
+		}
+
+		inline Texel addTexel( Texel lhs, Texel rhs )
+		{
+			return vaddq_f32( lhs, rhs );
+		}
+
+		inline Texel mulTexel( Texel lhs, float rhs )
+		{
+			return vmulq_n_f32( lhs, rhs );
+		}
+
+		inline Texel maddTexel( Texel acc, Texel value, float weight )
+		{
+			return vmlaq_n_f32( acc, value, weight );
+		}
+
+#else
+
+		struct Texel
+		{
+			float v[TexelFloats];
+		};
+
+		inline Texel loadTexel( float const * src )
+		{
+			return Texel{ { src[0], src[1], src[2], src[3] } };
+		}
+
+		inline void storeTexel( float * dst, Texel const & value )
+		{
+			std::memcpy( dst, value.v, sizeof( value.v ) );
+		}
+
+		inline Texel zeroTexel()
+		{
+			return Texel{ { 0.0f, 0.0f, 0.0f, 0.0f } };
+		}
+
+		inline Texel addTexel( Texel const & lhs, Texel const & rhs )
+		{
+			return Texel{ { lhs.v[0] + rhs.v[0], lhs.v[1] + rhs.v[1], lhs.v[2] + rhs.v[2], lhs.v[3] + rhs.v[3] } };
+		}
+
+		inline Texel mulTexel( Texel const & lhs, float rhs )
+		{
+			return Texel{ { lhs.v[0] * rhs, lhs.v[1] * rhs, lhs.v[2] * rhs, lhs.v[3] * rhs } };
+		}
+
+		inline Texel maddTexel( Texel const & acc, Texel const & value, float weight )
+		{
+			return addTexel( acc, mulTexel( value, weight ) );
+		}
+
+#endif
+
+		//*********************************************************************************************
+
+		double besselI0( double value )
+		{
+			double result = 1.0;
+			double term = 1.0;
+
+			for ( uint32_t k = 1u; k < 32u; ++k )
+			{
+				auto factor = value / ( 2.0 * k );
+				term *= factor * factor;
+				result += term;
+			}
+
+			return result;
+		}
+
+		std::array< float, KaiserTaps > const & getKaiserWeights()
+		{
+			static std::array< float, KaiserTaps > const result = []()
+			{
+				static double constexpr Pi = 3.14159265358979323846;
+				std::array< double, KaiserTaps > weights;
+				double total = 0.0;
+
+				for ( uint32_t k = 0u; k < KaiserTaps; ++k )
+				{
+					// Distance between the source texel centre and the destination texel centre, in source texels.
+					auto distance = double( k ) + 0.5 - double( KaiserRadius );
+					auto t = distance / double( KaiserRadius );
+					auto window = besselI0( KaiserAlpha * std::sqrt( std::max( 0.0, 1.0 - t * t ) ) ) / besselI0( KaiserAlpha );
+					// Half the source frequency, for a 2:1 reduction.
+					auto x = Pi * distance / 2.0;
+					weights[k] = window * std::sin( x ) / x;
+					total += weights[k];
+				}
+
+				std::array< float, KaiserTaps > table;
+
+				for ( uint32_t k = 0u; k < KaiserTaps; ++k )
+				{
+					table[k] = float( weights[k] / total );
+				}
+
+				return table;
+			}();
+			return result;
+		}
+
+		void boxRow( float const * row0
+			, float const * row1
+			, uint32_t srcWidth
+			, float * dst
+			, uint32_t dstWidth )
+		{
+			uint32_t x = 0u;
+#if UTILS_SIMD_AVX
+			auto quarter = _mm256_set1_ps( 0.25f );
+
+			// Two destination texels per iteration, from four source texels inside the row.
+			// The additions are done in the same order as the scalar path, for identical results.
+			for ( ; x + 1u < dstWidth && 2u * x + 3u < srcWidth; x += 2u )
+			{
+				auto lo0 = _mm256_loadu_ps( row0 + 8u * x );
+				auto hi0 = _mm256_loadu_ps( row0 + 8u * x + 8u );
+				auto lo1 = _mm256_loadu_ps( row1 + 8u * x );
+				auto hi1 = _mm256_loadu_ps( row1 + 8u * x + 8u );
+				auto sum0 = _mm256_add_ps( _mm256_permute2f128_ps( lo0, hi0, 0x20 )
+					, _mm256_permute2f128_ps( lo0, hi0, 0x31 ) );
+				auto sum1 = _mm256_add_ps( _mm256_permute2f128_ps( lo1, hi1, 0x20 )
+					, _mm256_permute2f128_ps( lo1, hi1, 0x31 ) );
+				_mm256_storeu_ps( dst + TexelFloats * x, _mm256_mul_ps( _mm256_add_ps( sum0, sum1 ), quarter ) );
+			}
+#endif
+
+			for ( ; x < dstWidth; ++x )
+			{
+				// A one texel dimension is not halved, the same texel is then read twice.
+				auto col0 = std::min( 2u * x, srcWidth - 1u ) * TexelFloats;
+				auto col1 = std::min( 2u * x + 1u, srcWidth - 1u ) * TexelFloats;
+				auto sum = addTexel( addTexel( loadTexel( row0 + col0 ), loadTexel( row0 + col1 ) )
+					, addTexel( loadTexel( row1 + col0 ), loadTexel( row1 + col1 ) ) );
+				storeTexel( dst + TexelFloats * x, mulTexel( sum, 0.25f ) );
+			}
+		}
+
+		void kaiserColumn( std::array< float const *, KaiserTaps > const & rows
+			, uint32_t count
+			, float * dst )
+		{
+			auto & weights = getKaiserWeights();
+			uint32_t i = 0u;
+#if UTILS_SIMD_AVX
+			__m256 wideWeights[KaiserTaps];
+
+			for ( uint32_t k = 0u; k < KaiserTaps; ++k )
+			{
+				wideWeights[k] = _mm256_set1_ps( weights[k] );
+			}
+
+			for ( ; i + 8u <= count; i += 8u )
+			{
+				auto acc = _mm256_setzero_ps();
+
+				for ( uint32_t k = 0u; k < KaiserTaps; ++k )
+				{
+					acc = _mm256_add_ps( acc, _mm256_mul_ps( _mm256_loadu_ps( rows[k] + i ), wideWeights[k] ) );
+				}
+
+				_mm256_storeu_ps( dst + i, acc );
+			}
+#endif
+
+			for ( ; i < count; i += TexelFloats )
+			{
+				auto acc = zeroTexel();
+
+				for ( uint32_t k = 0u; k < KaiserTaps; ++k )
+				{
+					acc = maddTexel( acc, loadTexel( rows[k] + i ), weights[k] );
+				}
+
+				storeTexel( dst + i, acc );
+			}
+		}
+
+		void kaiserRow( float const * src
+			, uint32_t srcWidth
+			, float * dst
+			, uint32_t dstWidth )
+		{
+			auto & weights = getKaiserWeights();
+			auto last = int32_t( srcWidth ) - 1;
+
+			for ( uint32_t x = 0u; x < dstWidth; ++x )
+			{
+				auto acc = zeroTexel();
+				auto first = int32_t( 2u * x ) - int32_t( KaiserRadius ) + 1;
+
+				for ( uint32_t k = 0u; k < KaiserTaps; ++k )
+				{
+					auto col = std::min( last, std::max( 0, first + int32_t( k ) ) );
+					acc = maddTexel( acc, loadTexel( src + TexelFloats * uint32_t( col ) ), weights[k] );
+				}
+
+				storeTexel( dst + TexelFloats * x, acc );
+			}
+		}
+
+		//*********************************************************************************************
+
+		struct SourceLevel
+		{
+			FormatInfo info;
+			renderer::Extent2D extent;
+			// The first level is read from the caller's data, the next ones from the float texels of the previous level.
+			uint8_t const * data;
+			float const * texels;
+
+			float const * getRow( uint32_t y
+				, float * scratch )const
+			{
+				if ( texels )
+				{
+					return texels + size_t( y ) * extent.width * TexelFloats;
+				}
+
+				decodeRow( info
+					, data + size_t( y ) * extent.width * getTexelSize( info )
+					, extent.width
+					, scratch );
+				return scratch;
+			}
+		};
+
+		void filterRows( MipFilter filter
+			, SourceLevel const & source
+			, renderer::Extent2D const & extent
+			, uint32_t begin
+			, uint32_t end
+			, float * dst )
+		{
+			auto rowFloats = source.extent.width * TexelFloats;
+			auto last = int32_t( source.extent.height ) - 1;
+			std::vector< float > scratch( size_t( rowFloats ) * ( KaiserTaps + 1u ) );
+
+			for ( uint32_t y = begin; y < end; ++y )
+			{
+				auto dstRow = dst + size_t( y ) * extent.width * TexelFloats;
+
+				if ( filter == MipFilter::eBox )
+				{
+					auto row0 = source.getRow( std::min( 2u * y, uint32_t( last ) )
+						, scratch.data() );
+					auto row1 = source.getRow( std::min( 2u * y + 1u, uint32_t( last ) )
+						, scratch.data() + rowFloats );
+					boxRow( row0, row1, source.extent.width, dstRow, extent.width );
+				}
+				else
+				{
+					// Vertical pass on full source rows, then horizontal pass on the result.
+					std::array< float const *, KaiserTaps > rows;
+					auto first = int32_t( 2u * y ) - int32_t( KaiserRadius ) + 1;
+
+					for ( uint32_t k = 0u; k < KaiserTaps; ++k )
+					{
+						auto row = std::min( last, std::max( 0, first + int32_t( k ) ) );
+						rows[k] = source.getRow( uint32_t( row )
+							, scratch.data() + size_t( k ) * rowFloats );
+					}
+
+					auto column = scratch.data() + size_t( KaiserTaps ) * rowFloats;
+					kaiserColumn( rows, rowFloats, column );
+					kaiserRow( column, source.extent.width, dstRow, extent.width );
+				}
+			}
+		}
+	}
+
+	//*********************************************************************************************
+
+	bool isMipGenerationSupported( renderer::Format format )noexcept
+	{
+		FormatInfo info;
+		return getFormatInfo( format, info );
+	}
+
+	uint32_t getMipLevelCount( renderer::Extent2D const & extent )noexcept
+	{
+		auto size = std::max( extent.width, extent.height );
+		uint32_t result = 1u;
+
+		while ( size > 1u )
+		{
+			size >>= 1u;
+			++result;
+		}
+
+		return result;
+	}
+
+	std::vector< MipLevel > getMipLevels( renderer::Format format
+		, renderer::Extent2D const & extent
+		, uint32_t levelCount )
+	{
+		BlockInfo block;
+		FormatInfo info;
+
+		if ( getFormatInfo( format, info ) )
+		{
+			block = { 1u, 1u, getTexelSize( info ) };
+		}
+		else if ( !getBlockInfo( format, block ) )
+		{
+			throw std::runtime_error{ "Unsupported format for mip levels layout." };
+		}
+
+		std::vector< MipLevel > result;
+		auto width = extent.width;
+		auto height = extent.height;
+		uint32_t offset = 0u;
+
+		for ( uint32_t level = 0u; level < levelCount; ++level )
+		{
+			auto size = ( ( width + block.width - 1u ) / block.width )
+				* ( ( height + block.height - 1u ) / block.height )
+				* block.size;
+			result.push_back( MipLevel
+			{
+				renderer::Extent2D{ width, height },
+				offset,
+				size
+			} );
+			offset += size;
+			width = std::max( 1u, width / 2u );
+			height = std::max( 1u, height / 2u );
+		}
+
+		return result;
+	}
+
+	MipChain generateMipmaps( renderer::Format format
+		, renderer::Extent2D const & extent
+		, uint8_t const * data
+		, MipFilter filter
+		, uint32_t threadCount )
+	{
+		FormatInfo info;
+
+		if ( !getFormatInfo( format, info ) )
+		{
+			throw std::runtime_error{ "Unsupported format for mipmaps generation." };
+		}
+
+		if ( !threadCount )
+		{
+			threadCount = std::max( 1u, std::thread::hardware_concurrency() );
+		}
+
+		MipChain result;
+		result.format = format;
+		auto texelSize = getTexelSize( info );
+		auto levelCount = getMipLevelCount( extent );
+		result.levels = getMipLevels( format, extent, levelCount );
+		auto & last = result.levels.back();
+		result.data.resize( last.offset + last.size );
+		std::memcpy( result.data.data(), data, result.levels[0].size );
+		std::vector< float > source;
+		std::vector< float > destination;
+
+		for ( uint32_t level = 1u; level < levelCount; ++level )
+		{
+			auto & dst = result.levels[level];
+			destination.resize( size_t( dst.extent.width ) * dst.extent.height * TexelFloats );
+			SourceLevel src
+			{
+				info,
+				result.levels[level - 1u].extent,
+				data,
+				level == 1u ? nullptr : source.data()
+			};
+			auto threads = std::min( threadCount
+				, std::max( 1u, dst.extent.width * dst.extent.height / MinTexelsPerThread ) );
+			parallelFor( dst.extent.height
+				, threads
+				, [&]( uint32_t begin, uint32_t end )
+				{
+					filterRows( filter, src, dst.extent, begin, end, destination.data() );
+
+					for ( uint32_t y = begin; y < end; ++y )
+					{
+						encodeRow( info
+							, destination.data() + size_t( y ) * dst.extent.width * TexelFloats
+							, dst.extent.width
+							, result.data.data() + dst.offset + size_t( y ) * dst.extent.width * texelSize );
+					}
+				} );
+			std::swap( source, destination );
+		}
+
+		return result;
+	}
+}
@@ -0,0 +1,113 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "UtilsPrerequisites.hpp"
+
+#include <Miscellaneous/Extent2D.hpp>
+
+namespace utils
+{
+	/**
+	*\brief
+	*	Les filtres de réduction utilisables pour générer les niveaux de mip.
+	*/
+	enum class MipFilter
+	{
+		//! Moyenne des 2x2 texels source.
+		eBox,
+		//! Sinc fenêtré par Kaiser, sur 6x6 texels source, plus net que la boîte.
+		eKaiser,
+	};
+	/**
+	*\brief
+	*	Un niveau d'une chaîne de mips.
+	*/
+	struct MipLevel
+	{
+		//! Les dimensions du niveau.
+		renderer::Extent2D extent;
+		//! Le décalage du niveau dans les données de la chaîne.
+		uint32_t offset;
+		//! La taille en octets du niveau.
+		uint32_t size;
+	};
+	/**
+	*\brief
+	*	Une chaîne de mips, les niveaux sont contigus dans les données, du plus grand au plus petit.
+	*\remarks
+	*	Chaque niveau peut être transféré tel quel via renderer::StagingBuffer::uploadTextureData.
+	*/
+	struct MipChain
+	{
+		//! Le format des texels.
+		renderer::Format format;
+		//! Les niveaux.
+		std::vector< MipLevel > levels;
+		//! Les données de tous les niveaux.
+		ByteArray data;
+	};
+	/**
+	*\brief
+	*	Dit si les niveaux de mip d'une image du format donné peuvent être générés par generateMipmaps.
+	*\remarks
+	*	Les formats supportés sont les formats non compressés à composantes 8 bits UNORM ou SRGB, 16 bits flottants et 32 bits flottants.
+	*\param[in] format
+	*	Le format des texels.
+	*\return
+	*	\p true si le format est supporté.
+	*/
+	bool isMipGenerationSupported( renderer::Format format )noexcept;
+	/**
+	*\param[in] extent
+	*	Les dimensions de l'image.
+	*\return
+	*	Le nombre de niveaux de la chaîne de mips complète, jusqu'à 1x1.
+	*/
+	uint32_t getMipLevelCount( renderer::Extent2D const & extent )noexcept;
+	/**
+	*\brief
+	*	Calcule la disposition des niveaux d'une chaîne de mips contiguë.
+	*\remarks
+	*	Les formats supportés sont ceux de generateMipmaps, et les formats compressés par blocs BC, ETC2 et EAC.
+	*	Lance une std::runtime_error si le format n'est pas supporté.
+	*\param[in] format
+	*	Le format des texels.
+	*\param[in] extent
+	*	Les dimensions du premier niveau.
+	*\param[in] levelCount
+	*	Le nombre de niveaux.
+	*\return
+	*	Les niveaux, du plus grand au plus petit.
+	*/
+	std::vector< MipLevel > getMipLevels( renderer::Format format
+		, renderer::Extent2D const & extent
+		, uint32_t levelCount );
+	/**
+	*\brief
+	*	Génère la chaîne de mips complète d'une image, sur le CPU.
+	*\remarks
+	*	Le filtrage se fait en flottants, les composantes SRGB étant filtrées dans l'espace linéaire (l'alpha restant linéaire).
+	*	Les lignes de chaque niveau sont réparties entre les threads, et filtrées via AVX, SSE2 ou NEON, selon les options de compilation.
+	*	Lance une std::runtime_error si le format n'est pas supporté.
+	*\param[in] format
+	*	Le format des texels.
+	*\param[in] extent
+	*	Les dimensions de l'image.
+	*\param[in] data
+	*	Les texels du premier niveau, contigus.
+	*\param[in] filter
+	*	Le filtre de réduction.
+	*\param[in] threadCount
+	*	Le nombre maximal de threads (0 pour utiliser la concurrence matérielle).
+	*\return
+	*	La chaîne de mips, premier niveau inclus.
+	*/
+	MipChain generateMipmaps( renderer::Format format
+		, renderer::Extent2D const & extent
+		, uint8_t const * data
+		, MipFilter filter = MipFilter::eBox
+		, uint32_t threadCount = 0u );
+}
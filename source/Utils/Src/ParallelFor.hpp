@@ -0,0 +1,58 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "UtilsPrerequisites.hpp"
+
+#include <algorithm>
+#include <thread>
+
+namespace utils
+{
+	/**
+	*\brief
+	*	Répartit un intervalle d'indices en bandes contiguës, traitées chacune par un thread.
+	*\remarks
+	*	Le thread appelant traite la première bande, et attend la fin des autres.
+	*\param[in] count
+	*	Le nombre d'indices, l'intervalle est [0, count[.
+	*\param[in] threadCount
+	*	Le nombre maximal de threads, thread appelant inclus.
+	*\param[in] function
+	*	La fonction appelée pour chaque bande, avec ses bornes [begin, end[.
+	*/
+	template< typename FuncT >
+	void parallelFor( uint32_t count
+		, uint32_t threadCount
+		, FuncT const & function )
+	{
+		threadCount = std::min( threadCount, count );
+
+		if ( threadCount <= 1u )
+		{
+			function( 0u, count );
+			return;
+		}
+
+		auto band = ( count + threadCount - 1u ) / threadCount;
+		std::vector< std::thread > threads;
+
+		for ( uint32_t begin = band; begin < count; begin += band )
+		{
+			auto end = std::min( count, begin + band );
+			threads.emplace_back( [&function, begin, end]()
+			{
+				function( begin, end );
+			} );
+		}
+
+		function( 0u, band );
+
+		for ( auto & thread : threads )
+		{
+			thread.join();
+		}
+	}
+}
@@ -0,0 +1,24 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+/**
+*\brief
+*	Sélectionne le jeu d'instructions SIMD utilisé par les traitements d'images CPU, selon les options de compilation.
+*\remarks
+*	Définit UTILS_SIMD_AVX (qui implique UTILS_SIMD_SSE), UTILS_SIMD_SSE ou UTILS_SIMD_NEON.
+*	Si aucun n'est défini, les traitements utilisent leur version scalaire.
+*/
+#if defined( __AVX__ )
+#	include <immintrin.h>
+#	define UTILS_SIMD_AVX 1
+#	define UTILS_SIMD_SSE 1
+#elif defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#	include <emmintrin.h>
+#	define UTILS_SIMD_SSE 1
+#elif defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#	include <arm_neon.h>
+#	define UTILS_SIMD_NEON 1
+#endif
@@ -0,0 +1,1167 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#include "TextureCompressor.hpp"
+
+#include "ParallelFor.hpp"
+#include "Simd.hpp"
+
+#include <Core/PhysicalDevice.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#if defined( _WIN32 )
+#	include <direct.h>
+#else
+#	include <sys/stat.h>
+#endif
+
+namespace utils
+{
+	namespace
+	{
+		static uint32_t constexpr BlockTexels = 16u;
+		static uint32_t constexpr CacheMagic = 0x43544C52u;
+		static uint32_t constexpr CacheVersion = 1u;
+
+		enum class Encoding
+		{
+			eBC1,
+			eBC3,
+			eBC7,
+			eETC2RGB,
+			eETC2RGBA,
+		};
+
+		bool getEncoding( renderer::Format format
+			, Encoding & encoding )noexcept
+		{
+			switch ( format )
+			{
+			case renderer::Format::eBC1_RGB_UNORM_BLOCK:
+			case renderer::Format::eBC1_RGB_SRGB_BLOCK:
+				encoding = Encoding::eBC1;
+				return true;
+			case renderer::Format::eBC3_UNORM_BLOCK:
+			case renderer::Format::eBC3_SRGB_BLOCK:
+				encoding = Encoding::eBC3;
+				return true;
+			case renderer::Format::eBC7_UNORM_BLOCK:
+			case renderer::Format::eBC7_SRGB_BLOCK:
+				encoding = Encoding::eBC7;
+				return true;
+			case renderer::Format::eETC2_R8G8B8_UNORM_BLOCK:
+			case renderer::Format::eETC2_R8G8B8_SRGB_BLOCK:
+				encoding = Encoding::eETC2RGB;
+				return true;
+			case renderer::Format::eETC2_R8G8B8A8_UNORM_BLOCK:
+			case renderer::Format::eETC2_R8G8B8A8_SRGB_BLOCK:
+				encoding = Encoding::eETC2RGBA;
+				return true;
+			default:
+				return false;
+			}
+		}
+
+		uint32_t getBlockSize( Encoding encoding )
+		{
+			return ( encoding == Encoding::eBC1 || encoding == Encoding::eETC2RGB )
+				? 8u
+				: 16u;
+		}
+
+		//*********************************************************************************************
+
+		// The texels of a 4x4 block, one array per channel, values in [0, 255].
+		struct Block
+		{
+			std::array< std::array< float, BlockTexels >, 4u > channels;
+		};
+
+		using Colour = std::array< float, 4u >;
+
+		void extractBlock( uint8_t const * data
+			, renderer::Extent2D const & extent
+			, uint32_t bx
+			, uint32_t by
+			, Block & block )
+		{
+			for ( uint32_t y = 0u; y < 4u; ++y )
+			{
+				// The blocks crossing the level borders repeat its last row and column.
+				auto row = data + size_t( std::min( by * 4u + y, extent.height - 1u ) ) * extent.width * 4u;
+
+				for ( uint32_t x = 0u; x < 4u; ++x )
+				{
+					auto texel = row + std::min( bx * 4u + x, extent.width - 1u ) * 4u;
+
+					for ( uint32_t c = 0u; c < 4u; ++c )
+					{
+						block.channels[c][y * 4u + x] = float( texel[c] );
+					}
+				}
+			}
+		}
+
+		/**
+		*	Selects, for each texel, its nearest palette entry, for the first \p channelCount channels.
+		*	\p texelCount must be a multiple of 4.
+		*	Returns the sum of the squared distances.
+		*/
+		float selectIndices( float const * const * channels
+			, uint32_t channelCount
+			, uint32_t texelCount
+			, Colour const * palette
+			, uint32_t paletteCount
+			, uint8_t * indices )
+		{
+			float result = 0.0f;
+			uint32_t t = 0u;
+
+#if UTILS_SIMD_AVX
+			for ( ; t + 8u <= texelCount; t += 8u )
+			{
+				auto best = _mm256_set1_ps( std::numeric_limits< float >::max() );
+				auto bestIndex = _mm256_setzero_ps();
+
+				for ( uint32_t p = 0u; p < paletteCount; ++p )
+				{
+					auto distance = _mm256_setzero_ps();
+
+					for ( uint32_t c = 0u; c < channelCount; ++c )
+					{
+						auto diff = _mm256_sub_ps( _mm256_loadu_ps( channels[c] + t ), _mm256_set1_ps( palette[p][c] ) );
+						distance = _mm256_add_ps( distance, _mm256_mul_ps( diff, diff ) );
+					}
+
+					auto mask = _mm256_cmp_ps( distance, best, _CMP_LT_OQ );
+					best = _mm256_min_ps( distance, best );
+					bestIndex = _mm256_blendv_ps( bestIndex, _mm256_set1_ps( float( p ) ), mask );
+				}
+
+				alignas( 32 ) float errors[8];
+				alignas( 32 ) float selected[8];
+				_mm256_store_ps( errors, best );
+				_mm256_store_ps( selected, bestIndex );
+
+				for ( uint32_t i = 0u; i < 8u; ++i )
+				{
+					result += errors[i];
+					indices[t + i] = uint8_t( selected[i] );
+				}
+			}
+#endif
+#if UTILS_SIMD_SSE
+			for ( ; t + 4u <= texelCount; t += 4u )
+			{
+				auto best = _mm_set1_ps( std::numeric_limits< float >::max() );
+				auto bestIndex = _mm_setzero_ps();
+
+				for ( uint32_t p = 0u; p < paletteCount; ++p )
+				{
+					auto distance = _mm_setzero_ps();
+
+					for ( uint32_t c = 0u; c < channelCount; ++c )
+					{
+						auto diff = _mm_sub_ps( _mm_loadu_ps( channels[c] + t ), _mm_set1_ps( palette[p][c] ) );
+						distance = _mm_add_ps( distance, _mm_mul_ps( diff, diff ) );
+					}
+
+					auto mask = _mm_cmplt_ps( distance, best );
+					best = _mm_min_ps( distance, best );
+					bestIndex = _mm_or_ps( _mm_and_ps( mask, _mm_set1_ps( float( p ) ) )
+						, _mm_andnot_ps( mask, bestIndex ) );
+				}
+
+				alignas( 16 ) float errors[4];
+				alignas( 16 ) float selected[4];
+				_mm_store_ps( errors, best );
+				_mm_store_ps( selected, bestIndex );
+
+				for ( uint32_t i = 0u; i < 4u; ++i )
+				{
+					result += errors[i];
+					indices[t + i] = uint8_t( selected[i] );
+				}
+			}
+#elif UTILS_SIMD_NEON
+			for ( ; t + 4u <= texelCount; t += 4u )
+			{
+				auto best = vdupq_n_f32( std::numeric_limits< float >::max() );
+				auto bestIndex = vdupq_n_f32( 0.0f );
+
+				for ( uint32_t p = 0u; p < paletteCount; ++p )
+				{
+					auto distance = vdupq_n_f32( 0.0f );
+
+					for ( uint32_t c = 0u; c < channelCount; ++c )
+					{
+						auto diff = vsubq_f32( vld1q_f32( channels[c] + t ), vdupq_n_f32( palette[p][c] ) );
+						distance = vmlaq_f32( distance, diff, diff );
+					}
+
+					auto mask = vcltq_f32( distance, best );
+					best = vminq_f32( distance, best );
+					bestIndex = vbslq_f32( mask, vdupq_n_f32( float( p ) ), bestIndex );
+				}
+
+				float errors[4];
+				float selected[4];
+				vst1q_f32( errors, best );
+				vst1q_f32( selected, bestIndex );
+
+				for ( uint32_t i = 0u; i < 4u; ++i )
+				{
+					result += errors[i];
+					indices[t + i] = uint8_t( selected[i] );
+				}
+			}
+#endif
+
+			for ( ; t < texelCount; ++t )
+			{
+				auto best = std::numeric_limits< float >::max();
+
+				for ( uint32_t p = 0u; p < paletteCount; ++p )
+				{
+					auto distance = 0.0f;
+
+					for ( uint32_t c = 0u; c < channelCount; ++c )
+					{
+						auto diff = channels[c][t] - palette[p][c];
+						distance += diff * diff;
+					}
+
+					if ( distance < best )
+					{
+						best = distance;
+						indices[t] = uint8_t( p );
+					}
+				}
+
+				result += best;
+			}
+
+			return result;
+		}
+
+		/**
+		*	Computes the endpoints of the segment best fitting the texels, along their principal axis.
+		*/
+		void computeEndpoints( Block const & block
+			, uint32_t channelCount
+			, Colour & min
+			, Colour & max )
+		{
+			Colour mean{};
+
+			for ( uint32_t c = 0u; c < channelCount; ++c )
+			{
+				for ( auto value : block.channels[c] )
+				{
+					mean[c] += value;
+				}
+
+				mean[c] /= float( BlockTexels );
+			}
+
+			std::array< std::array< float, 4u >, 4u > covariance{};
+
+			for ( uint32_t t = 0u; t < BlockTexels; ++t )
+			{
+				for ( uint32_t i = 0u; i < channelCount; ++i )
+				{
+					for ( uint32_t j = i; j < channelCount; ++j )
+					{
+						covariance[i][j] += ( block.channels[i][t] - mean[i] ) * ( block.channels[j][t] - mean[j] );
+					}
+				}
+			}
+
+			// Power iteration, from the diagonal.
+			Colour axis{};
+
+			for ( uint32_t c = 0u; c < channelCount; ++c )
+			{
+				axis[c] = covariance[c][c];
+			}
+
+			for ( uint32_t iteration = 0u; iteration < 8u; ++iteration )
+			{
+				Colour next{};
+				float length = 0.0f;
+
+				for ( uint32_t i = 0u; i < channelCount; ++i )
+				{
+					for ( uint32_t j = 0u; j < channelCount; ++j )
+					{
+						next[i] += ( i <= j ? covariance[i][j] : covariance[j][i] ) * axis[j];
+					}
+
+					length = std::max( length, std::abs( next[i] ) );
+				}
+
+				if ( length <= 0.0f )
+				{
+					break;
+				}
+
+				for ( uint32_t c = 0u; c < channelCount; ++c )
+				{
+					axis[c] = next[c] / length;
+				}
+			}
+
+			float squaredLength = 0.0f;
+
+			for ( uint32_t c = 0u; c < channelCount; ++c )
+			{
+				squaredLength += axis[c] * axis[c];
+			}
+
+			min = mean;
+			max = mean;
+
+			if ( squaredLength <= 0.0f )
+			{
+				return;
+			}
+
+			auto lowest = std::numeric_limits< float >::max();
+			auto highest = std::numeric_limits< float >::lowest();
+
+			for ( uint32_t t = 0u; t < BlockTexels; ++t )
+			{
+				float projection = 0.0f;
+
+				for ( uint32_t c = 0u; c < channelCount; ++c )
+				{
+					projection += ( block.channels[c][t] - mean[c] ) * axis[c];
+				}
+
+				lowest = std::min( lowest, projection );
+				highest = std::max( highest, projection );
+			}
+
+			for ( uint32_t c = 0u; c < channelCount; ++c )
+			{
+				min[c] = std::min( 255.0f, std::max( 0.0f, mean[c] + axis[c] * lowest / squaredLength ) );
+				max[c] = std::min( 255.0f, std::max( 0.0f, mean[c] + axis[c] * highest / squaredLength ) );
+			}
+		}
+
+		inline uint32_t quantise( float value, uint32_t maximum )
+		{
+			return uint32_t( std::min( float( maximum ), std::max( 0.0f, value * float( maximum ) / 255.0f + 0.5f ) ) );
+		}
+
+		inline void writeLE( uint8_t * dst, uint64_t value, uint32_t bytes )
+		{
+			for ( uint32_t i = 0u; i < bytes; ++i )
+			{
+				dst[i] = uint8_t( value >> ( 8u * i ) );
+			}
+		}
+
+		inline void writeBE( uint8_t * dst, uint64_t value, uint32_t bytes )
+		{
+			for ( uint32_t i = 0u; i < bytes; ++i )
+			{
+				dst[i] = uint8_t( value >> ( 8u * ( bytes - 1u - i ) ) );
+			}
+		}
+
+		//*********************************************************************************************
+
+		uint32_t packRgb565( Colour const & colour )
+		{
+			return ( quantise( colour[0], 31u ) << 11u )
+				| ( quantise( colour[1], 63u ) << 5u )
+				| quantise( colour[2], 31u );
+		}
+
+		Colour unpackRgb565( uint32_t value )
+		{
+			auto r = ( value >> 11u ) & 0x1Fu;
+			auto g = ( value >> 5u ) & 0x3Fu;
+			auto b = value & 0x1Fu;
+			return Colour
+			{
+				float( ( r << 3u ) | ( r >> 2u ) ),
+				float( ( g << 2u ) | ( g >> 4u ) ),
+				float( ( b << 3u ) | ( b >> 2u ) ),
+				255.0f
+			};
+		}
+
+		void encodeBC1( Block const & block
+			, uint8_t * dst )
+		{
+			Colour min;
+			Colour max;
+			computeEndpoints( block, 3u, min, max );
+			auto colour0 = packRgb565( max );
+			auto colour1 = packRgb565( min );
+
+			// The four colours mode needs colour0 > colour1.
+			if ( colour0 < colour1 )
+			{
+				std::swap( colour0, colour1 );
+			}
+
+			std::array< uint8_t, BlockTexels > indices{};
+
+			if ( colour0 != colour1 )
+			{
+				std::array< Colour, 4u > palette;
+				palette[0] = unpackRgb565( colour0 );
+				palette[1] = unpackRgb565( colour1 );
+
+				for ( uint32_t c = 0u; c < 3u; ++c )
+				{
+					palette[2][c] = ( 2.0f * palette[0][c] + palette[1][c] ) / 3.0f;
+					palette[3][c] = ( palette[0][c] + 2.0f * palette[1][c] ) / 3.0f;
+				}
+
+				float const * channels[3]{ block.channels[0].data(), block.channels[1].data(), block.channels[2].data() };
+				selectIndices( channels, 3u, BlockTexels, palette.data(), 4u, indices.data() );
+			}
+
+			uint32_t bits = 0u;
+
+			for ( uint32_t t = 0u; t < BlockTexels; ++t )
+			{
+				bits |= uint32_t( indices[t] ) << ( 2u * t );
+			}
+
+			writeLE( dst, colour0, 2u );
+			writeLE( dst + 2u, colour1, 2u );
+			writeLE( dst + 4u, bits, 4u );
+		}
+
+		void encodeBC3Alpha( Block const & block
+			, uint8_t * dst )
+		{
+			auto & alpha = block.channels[3];
+			auto alpha0 = uint32_t( *std::max_element( alpha.begin(), alpha.end() ) );
+			auto alpha1 = uint32_t( *std::min_element( alpha.begin(), alpha.end() ) );
+			std::array< uint8_t, BlockTexels > indices{};
+
+			// alpha0 > alpha1 selects the eight values mode.
+			if ( alpha0 != alpha1 )
+			{
+				std::array< Colour, 8u > palette{};
+				palette[0][0] = float( alpha0 );
+				palette[1][0] = float( alpha1 );
+
+				for ( uint32_t i = 2u; i < 8u; ++i )
+				{
+					palette[i][0] = float( ( ( 8u - i ) * alpha0 + ( i - 1u ) * alpha1 ) / 7u );
+				}
+
+				float const * channels[1]{ alpha.data() };
+				selectIndices( channels, 1u, BlockTexels, palette.data(), 8u, indices.data() );
+			}
+
+			uint64_t bits = 0u;
+
+			for ( uint32_t t = 0u; t < BlockTexels; ++t )
+			{
+				bits |= uint64_t( indices[t] ) << ( 3u * t );
+			}
+
+			dst[0] = uint8_t( alpha0 );
+			dst[1] = uint8_t( alpha1 );
+			writeLE( dst + 2u, bits, 6u );
+		}
+
+		void encodeBC3( Block const & block
+			, uint8_t * dst )
+		{
+			encodeBC3Alpha( block, dst );
+			// The BC3 colour block is always read in four colours mode.
+			encodeBC1( block, dst + 8u );
+		}
+
+		//*********************************************************************************************
+
+		class BitWriter
+		{
+		public:
+			explicit BitWriter( uint8_t * dst )
+				: m_dst{ dst }
+			{
+				std::memset( m_dst, 0, 16u );
+			}
+
+			void write( uint32_t value, uint32_t count )
+			{
+				for ( uint32_t i = 0u; i < count; ++i, ++m_position )
+				{
+					m_dst[m_position / 8u] |= uint8_t( ( ( value >> i ) & 1u ) << ( m_position % 8u ) );
+				}
+			}
+
+		private:
+			uint8_t * m_dst;
+			uint32_t m_position{ 0u };
+		};
+
+		// BC7 mode 6: one subset, RGBA endpoints on 7 bits plus a P-bit each, 4 bits indices.
+		void encodeBC7( Block const & block
+			, uint8_t * dst )
+		{
+			static std::array< uint32_t, 16u > constexpr Weights{ 0u, 4u, 9u, 13u, 17u, 21u, 26u, 30u, 34u, 38u, 43u, 47u, 51u, 55u, 60u, 64u };
+			Colour min;
+			Colour max;
+			computeEndpoints( block, 4u, min, max );
+			std::array< std::array< uint32_t, 4u >, 2u > endpoints;
+			std::array< uint32_t, 2u > pbits;
+			Colour const * sources[2]{ &min, &max };
+
+			for ( uint32_t e = 0u; e < 2u; ++e )
+			{
+				auto bestError = std::numeric_limits< float >::max();
+
+				// The P-bit is the shared lowest bit of the endpoint components.
+				for ( uint32_t p = 0u; p < 2u; ++p )
+				{
+					std::array< uint32_t, 4u > quantised;
+					float error = 0.0f;
+
+					for ( uint32_t c = 0u; c < 4u; ++c )
+					{
+						auto value = ( *sources[e] )[c];
+						quantised[c] = uint32_t( std::min( 127.0f, std::max( 0.0f, ( value - float( p ) ) / 2.0f + 0.5f ) ) );
+						auto diff = float( ( quantised[c] << 1u ) | p ) - value;
+						error += diff * diff;
+					}
+
+					if ( error < bestError )
+					{
+						bestError = error;
+						endpoints[e] = quantised;
+						pbits[e] = p;
+					}
+				}
+			}
+
+			std::array< Colour, 16u > palette;
+
+			for ( uint32_t i = 0u; i < 16u; ++i )
+			{
+				for ( uint32_t c = 0u; c < 4u; ++c )
+				{
+					auto e0 = ( endpoints[0][c] << 1u ) | pbits[0];
+					auto e1 = ( endpoints[1][c] << 1u ) | pbits[1];
+					palette[i][c] = float( ( ( 64u - Weights[i] ) * e0 + Weights[i] * e1 + 32u ) >> 6u );
+				}
+			}
+
+			std::array< uint8_t, BlockTexels > indices;
+			float const * channels[4]{ block.channels[0].data(), block.channels[1].data(), block.channels[2].data(), block.channels[3].data() };
+			selectIndices( channels, 4u, BlockTexels, palette.data(), 16u, indices.data() );
+
+			// The first index is stored without its highest bit, which must then be 0.
+			if ( indices[0] & 0x8u )
+			{
+				std::swap( endpoints[0], endpoints[1] );
+				std::swap( pbits[0], pbits[1] );
+
+				for ( auto & index : indices )
+				{
+					index = uint8_t( 15u - index );
+				}
+			}
+
+			BitWriter writer{ dst };
+			writer.write( 1u << 6u, 7u );
+
+			for ( uint32_t c = 0u; c < 4u; ++c )
+			{
+				writer.write( endpoints[0][c], 7u );
+				writer.write( endpoints[1][c], 7u );
+			}
+
+			writer.write( pbits[0], 1u );
+			writer.write( pbits[1], 1u );
+			writer.write( indices[0], 3u );
+
+			for ( uint32_t t = 1u; t < BlockTexels; ++t )
+			{
+				writer.write( indices[t], 4u );
+			}
+		}
+
+		//*********************************************************************************************
+
+		static int32_t constexpr EtcModifiers[8][2]
+		{
+			{ 2, 8 },
+			{ 5, 17 },
+			{ 9, 29 },
+			{ 13, 42 },
+			{ 18, 60 },
+			{ 24, 80 },
+			{ 33, 106 },
+			{ 47, 183 },
+		};
+
+		static int32_t constexpr EacModifiers[16][8]
+		{
+			{ -3, -6, -9, -15, 2, 5, 8, 14 },
+			{ -3, -7, -10, -13, 2, 6, 9, 12 },
+			{ -2, -5, -8, -13, 1, 4, 7, 12 },
+			{ -2, -4, -6, -13, 1, 3, 5, 12 },
+			{ -3, -6, -8, -12, 2, 5, 7, 11 },
+			{ -3, -7, -9, -11, 2, 6, 8, 10 },
+			{ -4, -7, -8, -11, 3, 6, 7, 10 },
+			{ -3, -5, -8, -11, 2, 4, 7, 10 },
+			{ -2, -6, -8, -10, 1, 5, 7, 9 },
+			{ -2, -5, -8, -10, 1, 4, 7, 9 },
+			{ -2, -4, -8, -10, 1, 3, 7, 9 },
+			{ -2, -5, -7, -10, 1, 4, 6, 9 },
+			{ -3, -4, -7, -10, 2, 3, 6, 9 },
+			{ -1, -2, -3, -10, 0, 1, 2, 9 },
+			{ -4, -6, -8, -9, 3, 5, 7, 8 },
+			{ -3, -5, -7, -9, 2, 4, 6, 8 },
+		};
+
+		inline float clampByte( int32_t value )
+		{
+			return float( std::min( 255, std::max( 0, value ) ) );
+		}
+
+		struct EtcSubBlock
+		{
+			// The texels of the half block, and their position in the block.
+			std::array< std::array< float, 8u >, 3u > channels;
+			std::array< uint32_t, 8u > texels;
+		};
+
+		struct EtcSubBlockResult
+		{
+			float error;
+			uint32_t table;
+			std::array< uint8_t, 8u > indices;
+		};
+
+		EtcSubBlockResult encodeEtcSubBlock( EtcSubBlock const & subBlock
+			, std::array< int32_t, 3u > const & base )
+		{
+			EtcSubBlockResult result{ std::numeric_limits< float >::max(), 0u, {} };
+			float const * channels[3]{ subBlock.channels[0].data(), subBlock.channels[1].data(), subBlock.channels[2].data() };
+
+			for ( uint32_t table = 0u; table < 8u; ++table )
+			{
+				// The modifier indices order: +small, +large, -small, -large.
+				int32_t const modifiers[4]
+				{
+					EtcModifiers[table][0],
+					EtcModifiers[table][1],
+					-EtcModifiers[table][0],
+					-EtcModifiers[table][1],
+				};
+				std::array< Colour, 4u > palette;
+
+				for ( uint32_t i = 0u; i < 4u; ++i )
+				{
+					for ( uint32_t c = 0u; c < 3u; ++c )
+					{
+						palette[i][c] = clampByte( base[c] + modifiers[i] );
+					}
+				}
+
+				std::array< uint8_t, 8u > indices;
+				auto error = selectIndices( channels, 3u, 8u, palette.data(), 4u, indices.data() );
+
+				if ( error < result.error )
+				{
+					result.error = error;
+					result.table = table;
+					result.indices = indices;
+				}
+			}
+
+			return result;
+		}
+
+		void encodeEtc2Rgb( Block const & block
+			, uint8_t * dst )
+		{
+			auto bestError = std::numeric_limits< float >::max();
+
+			for ( uint32_t flip = 0u; flip < 2u; ++flip )
+			{
+				// Without flip, the sub blocks are the left and right 2x4 halves, with flip the top and bottom 4x2 halves.
+				std::array< EtcSubBlock, 2u > subBlocks;
+				std::array< std::array< float, 3u >, 2u > averages{};
+				std::array< uint32_t, 2u > counts{};
+
+				for ( uint32_t y = 0u; y < 4u; ++y )
+				{
+					for ( uint32_t x = 0u; x < 4u; ++x )
+					{
+						auto s = flip ? ( y / 2u ) : ( x / 2u );
+						auto & subBlock = subBlocks[s];
+						auto t = y * 4u + x;
+						subBlock.texels[counts[s]] = t;
+
+						for ( uint32_t c = 0u; c < 3u; ++c )
+						{
+							subBlock.channels[c][counts[s]] = block.channels[c][t];
+							averages[s][c] += block.channels[c][t] / 8.0f;
+						}
+
+						++counts[s];
+					}
+				}
+
+				// Differential mode: 5 bits base colours, the second one stored as a 3 bits signed delta.
+				std::array< std::array< uint32_t, 3u >, 2u > base5;
+				bool differential = true;
+
+				for ( uint32_t c = 0u; c < 3u; ++c )
+				{
+					base5[0][c] = quantise( averages[0][c], 31u );
+					base5[1][c] = quantise( averages[1][c], 31u );
+					auto delta = int32_t( base5[1][c] ) - int32_t( base5[0][c] );
+					differential = differential && delta >= -4 && delta <= 3;
+				}
+
+				for ( uint32_t mode = differential ? 0u : 1u; mode < 2u; ++mode )
+				{
+					std::array< std::array< uint32_t, 3u >, 2u > stored;
+					std::array< std::array< int32_t, 3u >, 2u > bases;
+
+					for ( uint32_t s = 0u; s < 2u; ++s )
+					{
+						for ( uint32_t c = 0u; c < 3u; ++c )
+						{
+							if ( mode == 0u )
+							{
+								stored[s][c] = base5[s][c];
+								bases[s][c] = int32_t( ( base5[s][c] << 3u ) | ( base5[s][c] >> 2u ) );
+							}
+							else
+							{
+								// Individual mode: 4 bits base colours.
+								stored[s][c] = quantise( averages[s][c], 15u );
+								bases[s][c] = int32_t( stored[s][c] * 17u );
+							}
+						}
+					}
+
+					auto first = encodeEtcSubBlock( subBlocks[0], bases[0] );
+					auto second = encodeEtcSubBlock( subBlocks[1], bases[1] );
+
+					if ( first.error + second.error >= bestError )
+					{
+						continue;
+					}
+
+					bestError = first.error + second.error;
+					uint64_t bits = 0u;
+
+					for ( uint32_t c = 0u; c < 3u; ++c )
+					{
+						auto shift = 56u - 8u * c;
+
+						if ( mode == 0u )
+						{
+							auto delta = uint32_t( int32_t( stored[1][c] ) - int32_t( stored[0][c] ) ) & 0x7u;
+							bits |= uint64_t( ( stored[0][c] << 3u ) | delta ) << shift;
+						}
+						else
+						{
+							bits |= uint64_t( ( stored[0][c] << 4u ) | stored[1][c] ) << shift;
+						}
+					}
+
+					bits |= uint64_t( ( first.table << 5u )
+						| ( second.table << 2u )
+						| ( ( mode == 0u ? 1u : 0u ) << 1u )
+						| flip ) << 32u;
+
+					// The texels indices are stored by column, most significant bits first.
+					for ( uint32_t s = 0u; s < 2u; ++s )
+					{
+						auto & indices = s == 0u ? first.indices : second.indices;
+
+						for ( uint32_t i = 0u; i < 8u; ++i )
+						{
+							auto t = subBlocks[s].texels[i];
+							auto position = ( t % 4u ) * 4u + t / 4u;
+							bits |= uint64_t( indices[i] >> 1u ) << ( 16u + position );
+							bits |= uint64_t( indices[i] & 1u ) << position;
+						}
+					}
+
+					writeBE( dst, bits, 8u );
+				}
+			}
+		}
+
+		void encodeEacAlpha( Block const & block
+			, uint8_t * dst )
+		{
+			auto & alpha = block.channels[3];
+			auto lowest = *std::min_element( alpha.begin(), alpha.end() );
+			auto highest = *std::max_element( alpha.begin(), alpha.end() );
+			float const * channels[1]{ alpha.data() };
+			auto bestError = std::numeric_limits< float >::max();
+			uint64_t bestBits = 0u;
+
+			for ( uint32_t table = 0u; table < 16u; ++table )
+			{
+				auto & modifiers = EacModifiers[table];
+				auto range = float( modifiers[7] - modifiers[3] );
+				auto multiplier = int32_t( ( highest - lowest ) / range + 0.5f );
+
+				for ( auto m = std::max( 1, multiplier - 1 ); m <= std::min( 15, multiplier + 1 ); ++m )
+				{
+					// The base centres the table range on the block range.
+					auto base = int32_t( std::min( 255.0f, std::max( 0.0f
+						, ( lowest - float( modifiers[3] * m ) + highest - float( modifiers[7] * m ) ) / 2.0f + 0.5f ) ) );
+					std::array< Colour, 8u > palette{};
+
+					for ( uint32_t i = 0u; i < 8u; ++i )
+					{
+						palette[i][0] = clampByte( base + modifiers[i] * m );
+					}
+
+					std::array< uint8_t, BlockTexels > indices;
+					auto error = selectIndices( channels, 1u, BlockTexels, palette.data(), 8u, indices.data() );
+
+					if ( error < bestError )
+					{
+						bestError = error;
+						bestBits = ( uint64_t( base ) << 56u )
+							| ( uint64_t( m ) << 52u )
+							| ( uint64_t( table ) << 48u );
+
+						// Stored by column, the first texel in the most significant bits.
+						for ( uint32_t t = 0u; t < BlockTexels; ++t )
+						{
+							auto position = ( t % 4u ) * 4u + t / 4u;
+							bestBits |= uint64_t( indices[t] ) << ( 45u - 3u * position );
+						}
+					}
+				}
+			}
+
+			writeBE( dst, bestBits, 8u );
+		}
+
+		void encodeEtc2Rgba( Block const & block
+			, uint8_t * dst )
+		{
+			encodeEacAlpha( block, dst );
+			encodeEtc2Rgb( block, dst + 8u );
+		}
+
+		//*********************************************************************************************
+
+		void encodeBlock( Encoding encoding
+			, Block const & block
+			, uint8_t * dst )
+		{
+			switch ( encoding )
+			{
+			case Encoding::eBC1:
+				encodeBC1( block, dst );
+				break;
+			case Encoding::eBC3:
+				encodeBC3( block, dst );
+				break;
+			case Encoding::eBC7:
+				encodeBC7( block, dst );
+				break;
+			case Encoding::eETC2RGB:
+				encodeEtc2Rgb( block, dst );
+				break;
+			case Encoding::eETC2RGBA:
+				encodeEtc2Rgba( block, dst );
+				break;
+			}
+		}
+
+		//*********************************************************************************************
+
+		uint64_t hashSource( MipChain const & source
+			, renderer::Format format )
+		{
+			// FNV-1a.
+			uint64_t result = 0xCBF29CE484222325ull;
+			auto hash = [&result]( uint8_t const * data, size_t size )
+			{
+				for ( size_t i = 0u; i < size; ++i )
+				{
+					result = ( result ^ data[i] ) * 0x100000001B3ull;
+				}
+			};
+			uint32_t const header[]{ CacheVersion, uint32_t( format ), uint32_t( source.format ), uint32_t( source.levels.size() ) };
+			hash( reinterpret_cast< uint8_t const * >( header ), sizeof( header ) );
+
+			for ( auto & level : source.levels )
+			{
+				hash( reinterpret_cast< uint8_t const * >( &level.extent ), sizeof( level.extent ) );
+			}
+
+			hash( source.data.data(), source.data.size() );
+			return result;
+		}
+
+		std::string getCachePath( std::string const & folder
+			, uint64_t hash )
+		{
+			char name[32];
+			std::snprintf( name, sizeof( name ), "%016llx.rltc", static_cast< unsigned long long >( hash ) );
+			return folder + "/" + name;
+		}
+
+		bool loadCache( std::string const & path
+			, MipChain const & source
+			, MipChain & result )
+		{
+			std::ifstream file{ path, std::ios::binary };
+
+			if ( !file )
+			{
+				return false;
+			}
+
+			uint32_t header[4];
+
+			if ( !file.read( reinterpret_cast< char * >( header ), sizeof( header ) )
+				|| header[0] != CacheMagic
+				|| header[1] != CacheVersion
+				|| header[2] != uint32_t( result.format )
+				|| header[3] != uint32_t( source.levels.size() ) )
+			{
+				return false;
+			}
+
+			result.levels = getMipLevels( result.format
+				, source.levels[0].extent
+				, uint32_t( source.levels.size() ) );
+			auto & last = result.levels.back();
+			result.data.resize( last.offset + last.size );
+			return bool( file.read( reinterpret_cast< char * >( result.data.data() ), std::streamsize( result.data.size() ) ) )
+				&& file.peek() == std::ifstream::traits_type::eof();
+		}
+
+		void makeDirectory( std::string const & folder )
+		{
+#if defined( _WIN32 )
+			_mkdir( folder.c_str() );
+#else
+			mkdir( folder.c_str(), 0755 );
+#endif
+		}
+
+		// Creates the folder and its missing parents, the existing ones are left as they are.
+		void makeDirectories( std::string const & folder )
+		{
+			for ( auto index = folder.find_first_of( "/\\", 1u );
+				index != std::string::npos;
+				index = folder.find_first_of( "/\\", index + 1u ) )
+			{
+				makeDirectory( folder.substr( 0u, index ) );
+			}
+
+			makeDirectory( folder );
+		}
+
+		void saveCache( std::string const & folder
+			, std::string const & path
+			, MipChain const & result )
+		{
+			makeDirectories( folder );
+			// Written aside then renamed, a concurrent reader never sees a partial file.
+			// Each writer has its own temporary file, the same chain can be compressed by several threads.
+			static std::atomic< uint32_t > counter{ 0u };
+			auto temporary = path
+				+ "." + std::to_string( std::hash< std::thread::id >{}( std::this_thread::get_id() ) )
+				+ "." + std::to_string( counter++ )
+				+ ".tmp";
+
+			{
+				std::ofstream file{ temporary, std::ios::binary | std::ios::trunc };
+				uint32_t const header[]{ CacheMagic, CacheVersion, uint32_t( result.format ), uint32_t( result.levels.size() ) };
+
+				if ( !file
+					|| !file.write( reinterpret_cast< char const * >( header ), sizeof( header ) )
+					|| !file.write( reinterpret_cast< char const * >( result.data.data() ), std::streamsize( result.data.size() ) ) )
+				{
+					file.close();
+					std::remove( temporary.c_str() );
+					return;
+				}
+			}
+
+			std::remove( path.c_str() );
+			std::rename( temporary.c_str(), path.c_str() );
+		}
+
+		bool isSampled( renderer::PhysicalDevice const & gpu
+			, renderer::Format format )
+		{
+			auto & features = gpu.getFeatures();
+			auto isBC = format >= renderer::Format::eBCCompressed_BEGIN
+				&& format <= renderer::Format::eBCCompressed_END;
+			return ( isBC ? features.textureCompressionBC : features.textureCompressionETC2 )
+				&& checkFlag( gpu.getFormatProperties( format ).optimalTilingFeatures
+					, renderer::FormatFeatureFlag::eSampledImage );
+		}
+	}
+
+	//*********************************************************************************************
+
+	renderer::Format selectCompressedFormat( renderer::PhysicalDevice const & gpu
+		, bool alpha
+		, bool srgb )
+	{
+		std::array< renderer::Format, 3u > candidates;
+
+		if ( srgb )
+		{
+			candidates =
+			{
+				renderer::Format::eBC7_SRGB_BLOCK,
+				alpha ? renderer::Format::eBC3_SRGB_BLOCK : renderer::Format::eBC1_RGB_SRGB_BLOCK,
+				alpha ? renderer::Format::eETC2_R8G8B8A8_SRGB_BLOCK : renderer::Format::eETC2_R8G8B8_SRGB_BLOCK,
+			};
+		}
+		else
+		{
+			candidates =
+			{
+				renderer::Format::eBC7_UNORM_BLOCK,
+				alpha ? renderer::Format::eBC3_UNORM_BLOCK : renderer::Format::eBC1_RGB_UNORM_BLOCK,
+				alpha ? renderer::Format::eETC2_R8G8B8A8_UNORM_BLOCK : renderer::Format::eETC2_R8G8B8_UNORM_BLOCK,
+			};
+		}
+
+		auto it = std::find_if( candidates.begin()
+			, candidates.end()
+			, [&gpu]( renderer::Format format )
+			{
+				return isSampled( gpu, format );
+			} );
+		return it == candidates.end()
+			? renderer::Format::eUndefined
+			: *it;
+	}
+
+	bool isCompressionSupported( renderer::Format format )noexcept
+	{
+		Encoding encoding;
+		return getEncoding( format, encoding );
+	}
+
+	MipChain compressMipmaps( MipChain const & source
+		, renderer::Format format
+		, std::string const & cacheFolder
+		, uint32_t threadCount )
+	{
+		Encoding encoding;
+
+		if ( !getEncoding( format, encoding ) )
+		{
+			throw std::runtime_error{ "Unsupported compressed format." };
+		}
+
+		if ( source.format != renderer::Format::eR8G8B8A8_UNORM
+			&& source.format != renderer::Format::eR8G8B8A8_SRGB )
+		{
+			throw std::runtime_error{ "Unsupported source format for compression." };
+		}
+
+		if ( source.levels.empty() )
+		{
+			throw std::runtime_error{ "Empty mip chain for compression." };
+		}
+
+		MipChain result;
+		result.format = format;
+		std::string cachePath;
+
+		if ( !cacheFolder.empty() )
+		{
+			cachePath = getCachePath( cacheFolder, hashSource( source, format ) );
+
+			if ( loadCache( cachePath, source, result ) )
+			{
+				return result;
+			}
+		}
+
+		if ( !threadCount )
+		{
+			threadCount = std::max( 1u, std::thread::hardware_concurrency() );
+		}
+
+		result.levels = getMipLevels( format
+			, source.levels[0].extent
+			, uint32_t( source.levels.size() ) );
+		auto & last = result.levels.back();
+		result.data.resize( last.offset + last.size );
+
+		// The blocks rows of all the levels are spread between the threads, the small levels don't get a thread each.
+		std::vector< uint32_t > firstRows;
+		uint32_t rowCount = 0u;
+
+		for ( auto & level : source.levels )
+		{
+			firstRows.push_back( rowCount );
+			rowCount += ( level.extent.height + 3u ) / 4u;
+		}
+
+		auto blockSize = getBlockSize( encoding );
+		parallelFor( rowCount
+			, threadCount
+			, [&]( uint32_t begin, uint32_t end )
+			{
+				Block block;
+
+				for ( uint32_t row = begin; row < end; ++row )
+				{
+					auto index = uint32_t( std::upper_bound( firstRows.begin(), firstRows.end(), row ) - firstRows.begin() ) - 1u;
+					auto & srcLevel = source.levels[index];
+					auto & dstLevel = result.levels[index];
+					auto by = row - firstRows[index];
+					auto blocksX = ( srcLevel.extent.width + 3u ) / 4u;
+					auto dst = result.data.data() + dstLevel.offset + size_t( by ) * blocksX * blockSize;
+
+					for ( uint32_t bx = 0u; bx < blocksX; ++bx, dst += blockSize )
+					{
+						extractBlock( source.data.data() + srcLevel.offset
+							, srcLevel.extent
+							, bx
+							, by
+							, block );
+						encodeBlock( encoding, block, dst );
+					}
+				}
+			} );
+
+		if ( !cachePath.empty() )
+		{
+			saveCache( cacheFolder, cachePath, result );
+		}
+
+		return result;
+	}
+}
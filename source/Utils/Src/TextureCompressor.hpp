@@ -0,0 +1,63 @@
+/*
+This file belongs to RendererLib.
+See LICENSE file in root folder
+*/
+#pragma once
+
+#include "MipGenerator.hpp"
+
+namespace utils
+{
+	/**
+	*\brief
+	*	Choisit le format compressé dans lequel transférer une image RGBA8, parmi ceux que le GPU sait échantillonner.
+	*\remarks
+	*	Par ordre de préférence : BC7, puis BC3 (ou BC1 sans alpha), puis ETC2 RGBA8 (ou ETC2 RGB8 sans alpha).
+	*\param[in] gpu
+	*	Le GPU.
+	*\param[in] alpha
+	*	Dit si l'alpha de l'image doit être conservé.
+	*\param[in] srgb
+	*	Dit si les couleurs de l'image sont dans l'espace sRGB.
+	*\return
+	*	Le format compressé, renderer::Format::eUndefined si aucun n'est supporté.
+	*/
+	renderer::Format selectCompressedFormat( renderer::PhysicalDevice const & gpu
+		, bool alpha
+		, bool srgb );
+	/**
+	*\brief
+	*	Dit si compressMipmaps sait produire le format donné.
+	*\remarks
+	*	Les formats supportés sont BC1 RGB, BC3, BC7, ETC2 RGB8 et ETC2 RGBA8, UNORM et SRGB.
+	*\param[in] format
+	*	Le format compressé.
+	*\return
+	*	\p true si le format est supporté.
+	*/
+	bool isCompressionSupported( renderer::Format format )noexcept;
+	/**
+	*\brief
+	*	Compresse une chaîne de mips RGBA8 en blocs.
+	*\remarks
+	*	Les lignes de blocs de tous les niveaux sont réparties entre les threads,
+	*	et la sélection des indices de chaque bloc se fait via AVX, SSE2 ou NEON, selon les options de compilation.
+	*	Le résultat est mis en cache sur disque, identifié par le format et le contenu de la chaîne source,
+	*	une compression suivante de la même chaîne le relit au lieu de recompresser.
+	*	Lance une std::runtime_error si le format source ou le format compressé n'est pas supporté, ou si la chaîne est vide.
+	*\param[in] source
+	*	La chaîne de mips, au format R8G8B8A8_UNORM ou R8G8B8A8_SRGB.
+	*\param[in] format
+	*	Le format compressé.
+	*\param[in] cacheFolder
+	*	Le dossier du cache, créé avec ses parents s'il n'existe pas (vide pour ne pas utiliser de cache).
+	*\param[in] threadCount
+	*	Le nombre maximal de threads (0 pour utiliser la concurrence matérielle).
+	*\return
+	*	La chaîne de mips compressée, avec les mêmes niveaux que la source.
+	*/
+	MipChain compressMipmaps( MipChain const & source
+		, renderer::Format format
+		, std::string const & cacheFolder = std::string{}
+		, uint32_t threadCount = 0u );
+}